@@ -0,0 +1,116 @@
+/**
+ * This file contains a benchmark of positional mutations at scattered indexes. The same
+ * sequence of insertions and removals is applied to a list once with ll_addIndex and ll_remove
+ * and once through a mutation batch.
+ * @file benchBatch.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * The number of elements in the list before the operations.
+ */
+#define BENCH_ELEMENTS 100000
+
+/**
+ * This function returns the current time in milliseconds.
+ * @return This returns the time of the monotonic clock in milliseconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return ((double)now.tv_sec * 1e3) + ((double)now.tv_nsec / 1e6);
+}
+
+/**
+ * This function fills a list with the same elements for every run.
+ * @param list This is a pointer to the list to fill.
+ */
+static void bench_fill(struct linkedList* list){
+	ll_init(list);
+	for(int i = 0; i < BENCH_ELEMENTS; i++){
+		ll_add(list, &i, sizeof(i));
+	}
+}
+
+/**
+ * This function applies a number of scattered operations to a list, half insertions and half
+ * removals, either one by one or through a batch.
+ * @param list This is a pointer to the list.
+ * @param operations This is the number of operations.
+ * @param batched This is true to queue the operations in a batch.
+ * @return This returns the time taken in milliseconds.
+ */
+static double bench_apply(struct linkedList* list, int operations, bool batched){
+	struct listBatch* batch = batched ? ll_batchBegin(list) : NULL;
+	uint32_t size = ll_size(list);
+	unsigned int seed = 7;
+	double start = bench_now();
+
+	for(int op = 0; op < operations; op++){
+		seed = seed * 1103515245u + 12345u;
+
+		if((op % 2) == 0){
+			uint32_t index = (seed >> 4) % (size + 1);
+
+			if(batched){
+				ll_batchAddIndex(batch, &op, sizeof(op), index);
+			}
+			else{
+				ll_addIndex(list, &op, sizeof(op), index);
+			}
+			size = size + 1;
+		}
+		else{
+			uint32_t index = (seed >> 4) % size;
+
+			if(batched){
+				ll_batchRemove(batch, index);
+			}
+			else{
+				ll_remove(list, index);
+			}
+			size = size - 1;
+		}
+	}
+
+	if(batched){
+		ll_batchCommit(batch);
+	}
+
+	return bench_now() - start;
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @return This returns 0.
+ */
+int main(void){
+	printf("operations  one by one (ms)  batch (ms)\n");
+
+	for(int operations = 10; operations <= 1000; operations = operations * 10){
+		struct linkedList list;
+		double sequential;
+		double batched;
+
+		bench_fill(&list);
+		sequential = bench_apply(&list, operations, false);
+		ll_clear(&list);
+
+		bench_fill(&list);
+		batched = bench_apply(&list, operations, true);
+		ll_clear(&list);
+
+		printf("%10d  %15.2f  %10.2f\n", operations, sequential, batched);
+	}
+
+	return 0;
+}
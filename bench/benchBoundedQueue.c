@@ -0,0 +1,190 @@
+/**
+ * This file contains a benchmark of the bounded queue. Producer threads enqueue timestamped
+ * messages and consumer threads dequeue them until the queue is closed, with one producer and
+ * one consumer, several producers and one consumer, and several of each. The throughput and
+ * the percentiles of the time a message spends from enqueue to dequeue are printed.
+ * @file benchBoundedQueue.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "boundedqueue.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * The number of messages sent in every configuration.
+ */
+#define BENCH_MESSAGES 200000
+
+/**
+ * The capacity of the queue.
+ */
+#define BENCH_CAPACITY 1024
+
+/**
+ * The most producer or consumer threads run at once.
+ */
+#define BENCH_MAX_THREADS 16
+
+/**
+ * This structure is the message passed through the queue.
+ */
+struct benchMessage {
+	double sent; // The time the message was enqueued at
+	uint32_t serial; // The number of the message
+};
+
+/**
+ * This structure is the argument of a producer or consumer thread.
+ */
+struct benchWorker {
+	struct boundedQueue* queue; // The queue shared by all threads
+	uint32_t messages; // The number of messages a producer sends
+	double* latencies; // The latencies a consumer measured, room for every message
+	uint32_t received; // The number of messages a consumer received
+};
+
+/**
+ * This function returns the current time in seconds.
+ * @return This returns the time of the monotonic clock in seconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/**
+ * This function compares two latencies for qsort.
+ * @param a This is a pointer to the first latency.
+ * @param b This is a pointer to the second latency.
+ * @return This returns less than, equal to or greater than 0 as a is shorter, equal or longer.
+ */
+static int bench_compareTimes(const void* a, const void* b){
+	double first = *(const double*)a;
+	double second = *(const double*)b;
+
+	return (first > second) - (first < second);
+}
+
+/**
+ * This function enqueues the messages of one producer.
+ * @param argument This is a pointer to the benchWorker of the thread.
+ * @return This always returns NULL.
+ */
+static void* bench_producer(void* argument){
+	struct benchWorker* worker = (struct benchWorker*)argument;
+	struct benchMessage message;
+
+	for(uint32_t i = 0; i < worker->messages; i++){
+		message.serial = i;
+		message.sent = bench_now();
+		bq_enqueue(worker->queue, &message, sizeof(message));
+	}
+
+	return NULL;
+}
+
+/**
+ * This function dequeues messages until the queue is closed and empty.
+ * @param argument This is a pointer to the benchWorker of the thread.
+ * @return This always returns NULL.
+ */
+static void* bench_consumer(void* argument){
+	struct benchWorker* worker = (struct benchWorker*)argument;
+	struct benchMessage* message;
+
+	while((message = (struct benchMessage*)bq_dequeue(worker->queue, NULL)) != NULL){
+		worker->latencies[worker->received] = bench_now() - message->sent;
+		worker->received = worker->received + 1;
+		free(message);
+	}
+
+	return NULL;
+}
+
+/**
+ * This function runs one configuration and prints its throughput and latencies.
+ * @param producers This is the number of producer threads.
+ * @param consumers This is the number of consumer threads.
+ */
+static void bench_run(uint32_t producers, uint32_t consumers){
+	struct boundedQueue queue;
+	pthread_t producerThreads[BENCH_MAX_THREADS];
+	pthread_t consumerThreads[BENCH_MAX_THREADS];
+	struct benchWorker producerArguments[BENCH_MAX_THREADS];
+	struct benchWorker consumerArguments[BENCH_MAX_THREADS];
+	double* latencies = (double*)malloc(BENCH_MESSAGES * sizeof(double));
+	uint32_t received = 0;
+	double start;
+	double elapsed;
+
+	bq_init(&queue, BENCH_CAPACITY);
+
+	start = bench_now();
+	for(uint32_t i = 0; i < consumers; i++){
+		consumerArguments[i].queue = &queue;
+		consumerArguments[i].messages = 0;
+		consumerArguments[i].latencies = (double*)malloc(BENCH_MESSAGES * sizeof(double));
+		consumerArguments[i].received = 0;
+		pthread_create(&consumerThreads[i], NULL, bench_consumer, &consumerArguments[i]);
+	}
+	for(uint32_t i = 0; i < producers; i++){
+		producerArguments[i].queue = &queue;
+		producerArguments[i].messages = BENCH_MESSAGES / producers;
+		producerArguments[i].latencies = NULL;
+		producerArguments[i].received = 0;
+		pthread_create(&producerThreads[i], NULL, bench_producer, &producerArguments[i]);
+	}
+
+	for(uint32_t i = 0; i < producers; i++){
+		pthread_join(producerThreads[i], NULL);
+	}
+	bq_close(&queue);
+	for(uint32_t i = 0; i < consumers; i++){
+		pthread_join(consumerThreads[i], NULL);
+	}
+	elapsed = bench_now() - start;
+
+	// Gather the latencies of every consumer into one distribution
+	for(uint32_t i = 0; i < consumers; i++){
+		for(uint32_t j = 0; j < consumerArguments[i].received; j++){
+			latencies[received] = consumerArguments[i].latencies[j];
+			received = received + 1;
+		}
+		free(consumerArguments[i].latencies);
+	}
+	qsort(latencies, received, sizeof(double), bench_compareTimes);
+
+	printf("%3u:%-3u  %8.2f M messages/s  %9.1f us p50  %9.1f us p99  %9.1f us p99.9  %9.1f us max\n",
+			producers, consumers, (double)received / elapsed / 1e6, latencies[received / 2] * 1e6,
+			latencies[(received / 100) * 99] * 1e6, latencies[(received / 1000) * 999] * 1e6,
+			latencies[received - 1] * 1e6);
+
+	bq_destroy(&queue);
+	free(latencies);
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @return This returns 0.
+ */
+int main(void){
+	printf("producers:consumers\n");
+
+	bench_run(1, 1);
+	for(uint32_t producers = 2; producers <= BENCH_MAX_THREADS; producers = producers * 2){
+		bench_run(producers, 1);
+	}
+	for(uint32_t threads = 2; threads <= BENCH_MAX_THREADS; threads = threads * 2){
+		bench_run(threads, threads);
+	}
+
+	return 0;
+}
@@ -0,0 +1,147 @@
+/**
+ * This file contains a benchmark of cold compression. A list of log-like records is built,
+ * its interior is packed into compressed segments, and the memory used and the cost of each
+ * step of a walk over the list are compared with the fully expanded list. A step that lands on
+ * a packed element expands its whole segment, so the slowest steps show the bound set by the
+ * segment size.
+ * @file benchCold.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * The number of elements in the list.
+ */
+#define BENCH_ELEMENTS 200000
+
+/**
+ * The number of elements at each end of the list that stay expanded.
+ */
+#define BENCH_HOT_WINDOW 1000
+
+/**
+ * The size of a record in bytes.
+ */
+#define BENCH_RECORD_SIZE 64
+
+/**
+ * This function returns the current time in seconds.
+ * @return This returns the time of the monotonic clock in seconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/**
+ * This function compares two step times for qsort.
+ * @param a This is a pointer to the first time.
+ * @param b This is a pointer to the second time.
+ * @return This returns less than, equal to or greater than 0 as a is shorter, equal or longer.
+ */
+static int bench_compareTimes(const void* a, const void* b){
+	double first = *(const double*)a;
+	double second = *(const double*)b;
+
+	return (first > second) - (first < second);
+}
+
+/**
+ * This function prints the memory a list uses.
+ * @param label This is the name of the state the list is in.
+ * @param list This is a pointer to the list.
+ */
+static void bench_memory(const char* label, struct linkedList* list){
+	struct memoryUsage usage;
+
+	ll_memoryUsage(list, &usage);
+	printf("%-10s %10llu payload bytes  %10llu allocated bytes  %6.1f bytes/element\n", label,
+			(unsigned long long)usage.payloadBytes, (unsigned long long)usage.allocatedBytes,
+			(double)usage.allocatedBytes / BENCH_ELEMENTS);
+}
+
+/**
+ * This function walks a list timing every step and prints the distribution of step times.
+ * @param label This is the name of the state the list is in.
+ * @param list This is a pointer to the list.
+ * @param times This is an array of BENCH_ELEMENTS entries used to hold the step times.
+ */
+static void bench_walk(const char* label, struct linkedList* list, double* times){
+	struct linkedListIterator* iter = ll_getIterator(list);
+	double total = 0;
+	uint64_t sum = 0;
+
+	for(uint32_t i = 0; i < BENCH_ELEMENTS; i++){
+		double start = bench_now();
+		const unsigned char* data = (const unsigned char*)ll_next(iter);
+
+		times[i] = bench_now() - start;
+		total = total + times[i];
+		sum = sum + data[12];
+	}
+	free(iter);
+
+	qsort(times, BENCH_ELEMENTS, sizeof(double), bench_compareTimes);
+	printf("%-10s %6.1f ns/step mean  %8.1f ns p50  %8.1f ns p99  %8.1f ns p99.9  %8.1f ns max  (checksum %llu)\n", label,
+			total * 1e9 / BENCH_ELEMENTS, times[BENCH_ELEMENTS / 2] * 1e9, times[(BENCH_ELEMENTS / 100) * 99] * 1e9,
+			times[(BENCH_ELEMENTS / 1000) * 999] * 1e9, times[BENCH_ELEMENTS - 1] * 1e9, (unsigned long long)sum);
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @return This returns 0.
+ */
+int main(void){
+	static const char* actions[] = {"view", "click", "purchase", "logout"};
+	double* times = (double*)malloc(BENCH_ELEMENTS * sizeof(double));
+	struct linkedList list;
+	struct coldStats stats;
+	char record[BENCH_RECORD_SIZE];
+	double start;
+	ll_size_t packed;
+
+	ll_init(&list);
+	ll_setColdCompression(&list, true, BENCH_HOT_WINDOW);
+
+	srand(42);
+	for(uint32_t i = 0; i < BENCH_ELEMENTS; i++){
+		memset(record, 0, sizeof(record));
+		snprintf(record, sizeof(record), "ts=%u user=%d action=%s status=ok", 1700000000u + i, rand() % 5000,
+				actions[rand() % 4]);
+		ll_add(&list, record, sizeof(record));
+	}
+
+	bench_memory("expanded", &list);
+	bench_walk("expanded", &list, times);
+
+	start = bench_now();
+	packed = ll_compressCold(&list);
+	printf("compress   %6.1f ns/element packed  %llu elements\n", (bench_now() - start) * 1e9 / packed,
+			(unsigned long long)packed);
+
+	ll_coldStats(&list, &stats);
+	printf("segments   %llu packed  %llu raw bytes  %llu compressed bytes  ratio %.2fx\n",
+			(unsigned long long)stats.compressions, (unsigned long long)stats.rawBytes,
+			(unsigned long long)stats.compressedBytes, (double)stats.rawBytes / (double)stats.compressedBytes);
+	bench_memory("packed", &list);
+	bench_walk("packed", &list, times);
+
+	ll_coldStats(&list, &stats);
+	printf("expanded   %llu segments on first touch\n", (unsigned long long)stats.decompressions);
+
+	ll_clear(&list);
+	ll_setColdCompression(&list, false, 0);
+	free(times);
+
+	return 0;
+}
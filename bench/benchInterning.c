@@ -0,0 +1,137 @@
+/**
+ * This file contains a benchmark of payload interning on a skewed dataset. The elements are
+ * fixed size records drawn from a Zipf distribution, so a few values make up most of the list,
+ * and the list is built once copying every payload and once interning them.
+ * @file benchInterning.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * The number of elements added to each list.
+ */
+#define BENCH_ELEMENTS 500000
+
+/**
+ * The number of distinct records the elements are drawn from.
+ */
+#define BENCH_DISTINCT 4096
+
+/**
+ * The size of a record in bytes.
+ */
+#define BENCH_RECORD_SIZE 64
+
+/**
+ * This function returns the current time in seconds.
+ * @return This returns the time of the monotonic clock in seconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/**
+ * This function draws the record index of every element from a Zipf distribution with
+ * exponent 1, where the k-th most common record appears with weight 1/k.
+ * @param picks This is an array of BENCH_ELEMENTS entries that receives the record indices.
+ */
+static void bench_zipf(uint32_t* picks){
+	double* cumulative = (double*)malloc(BENCH_DISTINCT * sizeof(double));
+	double total = 0;
+
+	for(uint32_t k = 0; k < BENCH_DISTINCT; k++){
+		total = total + (1.0 / (k + 1));
+		cumulative[k] = total;
+	}
+
+	srand(42);
+	for(uint32_t i = 0; i < BENCH_ELEMENTS; i++){
+		double target = ((double)rand() / RAND_MAX) * total;
+		uint32_t low = 0;
+		uint32_t high = BENCH_DISTINCT - 1;
+
+		while(low < high){
+			uint32_t middle = (low + high) / 2;
+
+			if(cumulative[middle] < target){
+				low = middle + 1;
+			}
+			else{
+				high = middle;
+			}
+		}
+		picks[i] = low;
+	}
+
+	free(cumulative);
+}
+
+/**
+ * This function builds a list from the drawn records and prints how long it took.
+ * @param records This is a pointer to the distinct records.
+ * @param picks This is an array of the record index of every element.
+ * @param interning This is true to build an interning list.
+ */
+static void bench_build(const char (*records)[BENCH_RECORD_SIZE], const uint32_t* picks, bool interning){
+	struct linkedList list;
+	struct internStats stats;
+	double start;
+	double elapsed;
+
+	ll_init(&list);
+	ll_setInterning(&list, interning);
+
+	start = bench_now();
+	for(uint32_t i = 0; i < BENCH_ELEMENTS; i++){
+		ll_add(&list, records[picks[i]], BENCH_RECORD_SIZE);
+	}
+	elapsed = bench_now() - start;
+
+	if(ll_internStats(&list, &stats)){
+		printf("interning  %6.1f ns/add  %8llu unique  %10llu logical bytes  %8llu stored bytes  dedup %.1fx  saved %llu bytes\n",
+				elapsed * 1e9 / BENCH_ELEMENTS, (unsigned long long)stats.uniquePayloads, (unsigned long long)stats.logicalBytes,
+				(unsigned long long)stats.storedBytes, (double)stats.logicalBytes / (double)stats.storedBytes,
+				(unsigned long long)(stats.logicalBytes - stats.storedBytes));
+	}
+	else{
+		printf("copying    %6.1f ns/add  %10llu bytes of payloads\n", elapsed * 1e9 / BENCH_ELEMENTS,
+				(unsigned long long)BENCH_ELEMENTS * BENCH_RECORD_SIZE);
+	}
+
+	ll_clear(&list);
+	ll_setInterning(&list, false);
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @return This returns 0.
+ */
+int main(void){
+	char (*records)[BENCH_RECORD_SIZE] = malloc(BENCH_DISTINCT * BENCH_RECORD_SIZE);
+	uint32_t* picks = (uint32_t*)malloc(BENCH_ELEMENTS * sizeof(uint32_t));
+
+	for(uint32_t k = 0; k < BENCH_DISTINCT; k++){
+		memset(records[k], 0, BENCH_RECORD_SIZE);
+		snprintf(records[k], BENCH_RECORD_SIZE, "record %u", k);
+	}
+	bench_zipf(picks);
+
+	bench_build((const char (*)[BENCH_RECORD_SIZE])records, picks, false);
+	bench_build((const char (*)[BENCH_RECORD_SIZE])records, picks, true);
+
+	free(records);
+	free(picks);
+
+	return 0;
+}
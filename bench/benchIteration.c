@@ -0,0 +1,126 @@
+/**
+ * This file contains a benchmark of the cost of iterating a list per element. It compares the
+ * generic iterator, which is inlined when built with LL_INLINE_FAST_PATH, with a list
+ * generated by LL_DEFINE_TYPED.
+ * @file benchIteration.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+#include "typedlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+LL_DEFINE_TYPED(benchInts, int)
+
+/**
+ * The total number of elements visited for each list size, split into rounds over the list.
+ */
+#define BENCH_VISITS 50000000
+
+/**
+ * This function returns the current time in nanoseconds.
+ * @return This returns the time of the monotonic clock in nanoseconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return ((double)now.tv_sec * 1e9) + (double)now.tv_nsec;
+}
+
+/**
+ * This function walks a generic list with its iterator.
+ * @param list This is a pointer to the list to walk.
+ * @return This returns the sum of the elements so the walk cannot be optimized away.
+ */
+static long bench_walkGeneric(struct linkedList* list){
+	struct linkedListIterator* iter = ll_getIterator(list);
+	long sum = 0;
+
+	while(ll_hasNext(iter)){
+		sum = sum + *(int*)ll_next(iter);
+	}
+
+	free(iter);
+
+	return sum;
+}
+
+/**
+ * This function walks a typed list with its iterator.
+ * @param list This is a pointer to the list to walk.
+ * @return This returns the sum of the elements so the walk cannot be optimized away.
+ */
+static long bench_walkTyped(struct benchInts_list* list){
+	struct benchInts_iterator iter = benchInts_iter(list);
+	long sum = 0;
+
+	while(benchInts_hasNext(&iter)){
+		sum = sum + *benchInts_next(&iter);
+	}
+
+	return sum;
+}
+
+/**
+ * This function measures both iterators on lists of a given size and prints the results.
+ * @param elements This is the number of elements in the lists.
+ * @return This returns 0 if both lists held the same elements.
+ */
+static long bench_run(int elements){
+	struct linkedList list;
+	struct benchInts_list typed;
+	int rounds = BENCH_VISITS / elements;
+	long check = 0;
+	double start;
+	double generic;
+	double specialized;
+
+	ll_init(&list);
+	benchInts_init(&typed);
+
+	for(int i = 0; i < elements; i++){
+		ll_add(&list, &i, sizeof(i));
+		benchInts_add(&typed, i);
+	}
+
+	start = bench_now();
+	for(int round = 0; round < rounds; round++){
+		check = check + bench_walkGeneric(&list);
+	}
+	generic = (bench_now() - start) / ((double)elements * rounds);
+
+	start = bench_now();
+	for(int round = 0; round < rounds; round++){
+		check = check - bench_walkTyped(&typed);
+	}
+	specialized = (bench_now() - start) / ((double)elements * rounds);
+
+#ifdef LL_INLINE_FAST_PATH
+	printf("%8d elements  generic iterator (inline):      %6.2f ns/element\n", elements, generic);
+#else
+	printf("%8d elements  generic iterator (out of line): %6.2f ns/element\n", elements, generic);
+#endif
+	printf("%8d elements  LL_DEFINE_TYPED iterator:       %6.2f ns/element\n", elements, specialized);
+
+	ll_clear(&list);
+	benchInts_clear(&typed);
+
+	return check;
+}
+
+/**
+ * This is the main function of the benchmark. It measures a list that fits in the cache, where
+ * the call overhead shows, and one that does not, where memory latency dominates.
+ * @return This returns 0 if the benchmark ran correctly.
+ */
+int main(void){
+	long check = bench_run(1000) + bench_run(1000000);
+
+	return (check == 0) ? 0 : 1;
+}
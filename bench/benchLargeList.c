@@ -0,0 +1,102 @@
+/**
+ * This file contains a benchmark of building and walking one very large list. It is meant for
+ * comparing builds with and without LL_HUGE_PAGES on a host with enough memory, for example
+ *   benchLargeList 2000000000
+ * which needs about 70 GB. Lists of more than 4294967295 elements need a build with
+ * LL_LARGE_LISTS. The elements borrow one shared value so that the nodes are the only memory
+ * the list uses and the walk measures the cost of following the node links.
+ * @file benchLargeList.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+#include "nodepool.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * This function returns the current time in seconds.
+ * @return This returns the time of the monotonic clock in seconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/**
+ * This function reads how much of the memory of the process is backed by transparent huge pages.
+ * @return This returns the size in KiB, or 0 if the kernel does not report it.
+ */
+static unsigned long bench_hugePages(void){
+	FILE* file = fopen("/proc/self/smaps_rollup", "r");
+	unsigned long kilobytes = 0;
+	char line[256];
+
+	if(file != NULL){
+		while(fgets(line, sizeof(line), file) != NULL){
+			if(strncmp(line, "AnonHugePages:", 14) == 0){
+				kilobytes = strtoul(line + 14, NULL, 10);
+			}
+		}
+		fclose(file);
+	}
+
+	return kilobytes;
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @param argc This is the number of arguments.
+ * @param argv This is the array of arguments, the first being the number of elements.
+ * @return This returns 0 if the list was built and walked, 1 otherwise.
+ */
+int main(int argc, char** argv){
+	unsigned long long elements = (argc > 1) ? strtoull(argv[1], NULL, 10) : 10000000ull;
+	struct nodePoolStats stats;
+	struct linkedList list;
+	static int value = 1;
+	unsigned long long sum = 0;
+	double start;
+	double built;
+	double walked;
+
+	if((elements == 0) || (elements > LL_SIZE_MAX)){
+		fprintf(stderr, "the number of elements must be between 1 and %llu, build with LL_LARGE_LISTS for more\n",
+				(unsigned long long)LL_SIZE_MAX);
+		return 1;
+	}
+
+	ll_init(&list);
+
+	start = bench_now();
+	for(unsigned long long i = 0; i < elements; i++){
+		ll_addBorrowed(&list, &value, sizeof(value));
+	}
+	built = bench_now() - start;
+
+	// The walk follows the raw links, which is what every traversal of the list pays for
+	start = bench_now();
+	for(struct listNode* node = list.head; node != NULL; node = node->nextNode){
+		sum = sum + *(const int*)node->data;
+	}
+	walked = bench_now() - start;
+
+	np_stats(&stats);
+	printf("%llu elements, %zu bytes per node, %s sizes, huge page store %s\n", elements, sizeof(struct listNode),
+			(sizeof(ll_size_t) == 8) ? "64-bit" : "32-bit", (stats.storeBytes != 0) ? "on" : "off");
+	printf("build %.2f s (%.1f ns/element), walk %.2f s (%.2f ns/element)\n", built, built * 1e9 / (double)elements,
+			walked, walked * 1e9 / (double)elements);
+	printf("node store %llu MiB, AnonHugePages %lu MiB\n", (unsigned long long)(stats.storeBytes >> 20),
+			bench_hugePages() >> 10);
+
+	ll_clear(&list);
+
+	return (sum == elements) ? 0 : 1;
+}
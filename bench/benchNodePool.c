@@ -0,0 +1,117 @@
+/**
+ * This file contains a benchmark of node allocation throughput. Every thread repeatedly
+ * allocates a batch of nodes and frees them again, once with malloc and free and once with
+ * the node pool, for a growing number of threads.
+ * @file benchNodePool.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+#include "nodepool.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * The number of nodes each thread holds at once.
+ */
+#define BENCH_BATCH 256
+
+/**
+ * The number of batches each thread allocates and frees.
+ */
+#define BENCH_ROUNDS 20000
+
+/**
+ * This function returns the current time in seconds.
+ * @return This returns the time of the monotonic clock in seconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/**
+ * This function allocates and frees batches of nodes with malloc and free.
+ * @param argument This is unused.
+ * @return This always returns NULL.
+ */
+static void* bench_system(void* argument){
+	void* nodes[BENCH_BATCH];
+
+	for(int round = 0; round < BENCH_ROUNDS; round++){
+		for(int i = 0; i < BENCH_BATCH; i++){
+			nodes[i] = malloc(sizeof(struct listNode));
+		}
+		for(int i = 0; i < BENCH_BATCH; i++){
+			free(nodes[i]);
+		}
+	}
+
+	return argument;
+}
+
+/**
+ * This function allocates and frees batches of nodes with the node pool.
+ * @param argument This is unused.
+ * @return This always returns NULL.
+ */
+static void* bench_pool(void* argument){
+	void* nodes[BENCH_BATCH];
+
+	for(int round = 0; round < BENCH_ROUNDS; round++){
+		for(int i = 0; i < BENCH_BATCH; i++){
+			nodes[i] = np_alloc();
+		}
+		for(int i = 0; i < BENCH_BATCH; i++){
+			np_free(nodes[i]);
+		}
+	}
+
+	return argument;
+}
+
+/**
+ * This function runs a benchmark function on a number of threads.
+ * @param function This is the function every thread runs.
+ * @param threads This is the number of threads.
+ * @return This returns the total throughput in millions of allocate and free pairs per second.
+ */
+static double bench_run(void* (*function)(void*), int threads){
+	pthread_t workers[64];
+	double start = bench_now();
+
+	for(int i = 0; i < threads; i++){
+		pthread_create(&workers[i], NULL, function, NULL);
+	}
+	for(int i = 0; i < threads; i++){
+		pthread_join(workers[i], NULL);
+	}
+
+	return ((double)threads * BENCH_ROUNDS * BENCH_BATCH) / ((bench_now() - start) * 1e6);
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @return This returns 0.
+ */
+int main(void){
+	printf("threads  malloc/free (M pairs/s)  node pool (M pairs/s)\n");
+
+	for(int threads = 1; threads <= 16; threads = threads * 2){
+		double system = bench_run(bench_system, threads);
+		double pool = bench_run(bench_pool, threads);
+
+		printf("%7d  %23.1f  %21.1f\n", threads, system, pool);
+	}
+
+	np_trim();
+
+	return 0;
+}
@@ -0,0 +1,219 @@
+/**
+ * This file contains a benchmark of parallel traversal. A parallel for-each and a parallel
+ * reduce run over the same list with one thread and then with twice as many up to every
+ * processor, once with a function that does almost nothing per element, which shows the cost
+ * of splitting the list and waking the workers, and once with one that does real work per
+ * element, which shows how far the traversal scales.
+ * @file benchParallel.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * The number of elements in the list.
+ */
+#define BENCH_ELEMENTS 1000000
+
+/**
+ * The number of hashing rounds the expensive functions do per element.
+ */
+#define BENCH_ROUNDS 200
+
+/**
+ * The number of times every configuration is repeated, the fastest time is kept.
+ */
+#define BENCH_REPEATS 5
+
+/**
+ * This function returns the current time in seconds.
+ * @return This returns the time of the monotonic clock in seconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/**
+ * This function hashes a value a number of times.
+ * @param value This is the value to hash.
+ * @param rounds This is the number of rounds.
+ * @return This returns the hashed value.
+ */
+static uint64_t bench_hash(uint64_t value, uint32_t rounds){
+	for(uint32_t i = 0; i < rounds; i++){
+		value ^= value << 13;
+		value ^= value >> 7;
+		value ^= value << 17;
+	}
+
+	return value;
+}
+
+/**
+ * This function increments an element.
+ * @param data This is a pointer to the element.
+ * @param size This is the size of the element.
+ * @param context This is unused.
+ */
+static void bench_cheapForEach(void* data, ll_size_t size, void* context){
+	(void)size;
+	(void)context;
+	*(uint64_t*)data = *(uint64_t*)data + 1;
+}
+
+/**
+ * This function replaces an element with its hash.
+ * @param data This is a pointer to the element.
+ * @param size This is the size of the element.
+ * @param context This is unused.
+ */
+static void bench_expensiveForEach(void* data, ll_size_t size, void* context){
+	(void)size;
+	(void)context;
+	*(uint64_t*)data = bench_hash(*(uint64_t*)data, BENCH_ROUNDS);
+}
+
+/**
+ * This function adds an element to the sum.
+ * @param accumulator This is a pointer to the sum.
+ * @param data This is a pointer to the element.
+ * @param size This is the size of the element.
+ * @param context This is unused.
+ */
+static void bench_cheapReduce(void* accumulator, const void* data, ll_size_t size, void* context){
+	(void)size;
+	(void)context;
+	*(uint64_t*)accumulator = *(uint64_t*)accumulator + *(const uint64_t*)data;
+}
+
+/**
+ * This function adds the hash of an element to the sum.
+ * @param accumulator This is a pointer to the sum.
+ * @param data This is a pointer to the element.
+ * @param size This is the size of the element.
+ * @param context This is unused.
+ */
+static void bench_expensiveReduce(void* accumulator, const void* data, ll_size_t size, void* context){
+	(void)size;
+	(void)context;
+	*(uint64_t*)accumulator = *(uint64_t*)accumulator + bench_hash(*(const uint64_t*)data, BENCH_ROUNDS);
+}
+
+/**
+ * This function adds a partial sum to the sum.
+ * @param accumulator This is a pointer to the sum.
+ * @param partial This is a pointer to the partial sum.
+ * @param context This is unused.
+ */
+static void bench_combine(void* accumulator, const void* partial, void* context){
+	(void)context;
+	*(uint64_t*)accumulator = *(uint64_t*)accumulator + *(const uint64_t*)partial;
+}
+
+/**
+ * This function times a parallel for-each and returns the fastest of several runs.
+ * @param list This is a pointer to the list.
+ * @param function This is the function called for every element.
+ * @param threads This is the number of threads.
+ * @return This returns the fastest time in seconds.
+ */
+static double bench_forEach(struct linkedList* list, void (*function)(void*, ll_size_t, void*), uint32_t threads){
+	double best = 1e9;
+
+	for(uint32_t i = 0; i < BENCH_REPEATS; i++){
+		double start = bench_now();
+		double elapsed;
+
+		ll_parallelForEach(list, function, NULL, threads);
+		elapsed = bench_now() - start;
+		if(elapsed < best){
+			best = elapsed;
+		}
+	}
+
+	return best;
+}
+
+/**
+ * This function times a parallel reduce and returns the fastest of several runs.
+ * @param list This is a pointer to the list.
+ * @param reduce This is the function folding every element into the sum.
+ * @param threads This is the number of threads.
+ * @return This returns the fastest time in seconds.
+ */
+static double bench_reduce(struct linkedList* list, void (*reduce)(void*, const void*, ll_size_t, void*), uint32_t threads){
+	double best = 1e9;
+	uint64_t sum;
+
+	for(uint32_t i = 0; i < BENCH_REPEATS; i++){
+		double start = bench_now();
+		double elapsed;
+
+		sum = 0;
+		ll_parallelReduce(list, reduce, bench_combine, &sum, sizeof(sum), NULL, threads);
+		elapsed = bench_now() - start;
+		if(elapsed < best){
+			best = elapsed;
+		}
+	}
+
+	return best;
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @return This returns 0.
+ */
+int main(void){
+	long processors = sysconf(_SC_NPROCESSORS_ONLN);
+	uint32_t maxThreads = (processors > 0) ? (uint32_t)processors : 1;
+	struct linkedList list;
+	double base[4];
+	uint32_t threads = 1;
+	bool more = true;
+
+	ll_init(&list);
+	for(uint64_t i = 0; i < BENCH_ELEMENTS; i++){
+		ll_add(&list, &i, sizeof(i));
+	}
+
+	printf("threads  cheap for-each  cheap reduce  expensive for-each  expensive reduce  (ms, speedup over 1 thread)\n");
+
+	// Double the threads up to every processor, ending on every processor if that is no power of two
+	while(more){
+		double times[4];
+
+		times[0] = bench_forEach(&list, bench_cheapForEach, threads);
+		times[1] = bench_reduce(&list, bench_cheapReduce, threads);
+		times[2] = bench_forEach(&list, bench_expensiveForEach, threads);
+		times[3] = bench_reduce(&list, bench_expensiveReduce, threads);
+		if(threads == 1){
+			for(uint32_t i = 0; i < 4; i++){
+				base[i] = times[i];
+			}
+		}
+
+		printf("%7u", threads);
+		for(uint32_t i = 0; i < 4; i++){
+			printf("  %9.2f %5.2fx", times[i] * 1e3, base[i] / times[i]);
+		}
+		printf("\n");
+
+		more = (threads < maxThreads);
+		threads = ((threads * 2) < maxThreads) ? (threads * 2) : maxThreads;
+	}
+
+	ll_clear(&list);
+
+	return 0;
+}
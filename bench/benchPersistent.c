@@ -0,0 +1,176 @@
+/**
+ * This file contains a benchmark of the memory and time taken to keep old versions of a list.
+ * A list is changed one element at a time and every version is kept, once as persistent
+ * versions that share their unchanged nodes and once the way it was done before persistent
+ * lists, by rebuilding a full copy of the list for every version. Changes near the front of
+ * the list copy the fewest nodes, so the changes are made at the front, at random positions
+ * and at the end.
+ * @file benchPersistent.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+#include "persistentlist.h"
+
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * The number of elements in the list.
+ */
+#define BENCH_ELEMENTS 10000
+
+/**
+ * The number of versions kept.
+ */
+#define BENCH_VERSIONS 200
+
+/**
+ * The size of a record in bytes.
+ */
+#define BENCH_RECORD_SIZE 32
+
+/**
+ * This function returns the current time in seconds.
+ * @return This returns the time of the monotonic clock in seconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/**
+ * This function returns the bytes of heap memory in use.
+ * @return This returns the bytes the allocator has handed out and not taken back.
+ */
+static size_t bench_heapInUse(void){
+	return mallinfo2().uordblks;
+}
+
+/**
+ * This function returns the index the next change is made at.
+ * @param where This is 0 for the front of the list, 1 for a random position and 2 for the end.
+ * @return This returns an index of an element in the list.
+ */
+static uint32_t bench_position(uint32_t where){
+	uint32_t index = 0;
+
+	if(where == 1){
+		index = (uint32_t)rand() % BENCH_ELEMENTS;
+	}
+	else if(where == 2){
+		index = BENCH_ELEMENTS - 1;
+	}
+
+	return index;
+}
+
+/**
+ * This function keeps every version as a persistent version and prints the cost.
+ * @param label This is the name of where the changes are made.
+ * @param where This is 0 for the front of the list, 1 for a random position and 2 for the end.
+ */
+static void bench_persistent(const char* label, uint32_t where){
+	static struct persistentList versions[BENCH_VERSIONS + 1];
+	char record[BENCH_RECORD_SIZE];
+	size_t before;
+	size_t base;
+	double start;
+
+	srand(42);
+	before = bench_heapInUse();
+	pl_init(&versions[0]);
+	memset(record, 0, sizeof(record));
+	for(uint32_t i = 0; i < BENCH_ELEMENTS; i++){
+		snprintf(record, sizeof(record), "record %u", i);
+		pl_add(&versions[0], record, sizeof(record));
+	}
+	base = bench_heapInUse();
+
+	start = bench_now();
+	for(uint32_t v = 1; v <= BENCH_VERSIONS; v++){
+		uint32_t index = bench_position(where);
+
+		snprintf(record, sizeof(record), "version %u", v);
+		pl_snapshot(&versions[v - 1], &versions[v]);
+		pl_remove(&versions[v], index);
+		pl_addIndex(&versions[v], record, sizeof(record), index);
+	}
+	double elapsed = bench_now() - start;
+
+	printf("persistent  %-7s %10.1f bytes/version  %9.2f us/version  (first version %zu bytes)\n", label,
+			(double)(bench_heapInUse() - base) / BENCH_VERSIONS, elapsed * 1e6 / BENCH_VERSIONS, base - before);
+
+	for(uint32_t v = 0; v <= BENCH_VERSIONS; v++){
+		pl_clear(&versions[v]);
+	}
+}
+
+/**
+ * This function keeps every version as a full copy rebuilt after every change and prints the
+ * cost.
+ * @param label This is the name of where the changes are made.
+ * @param where This is 0 for the front of the list, 1 for a random position and 2 for the end.
+ */
+static void bench_rebuild(const char* label, uint32_t where){
+	static struct linkedList versions[BENCH_VERSIONS + 1];
+	char record[BENCH_RECORD_SIZE];
+	size_t base;
+	double start;
+
+	srand(42);
+	ll_init(&versions[0]);
+	memset(record, 0, sizeof(record));
+	for(uint32_t i = 0; i < BENCH_ELEMENTS; i++){
+		snprintf(record, sizeof(record), "record %u", i);
+		ll_add(&versions[0], record, sizeof(record));
+	}
+	base = bench_heapInUse();
+
+	start = bench_now();
+	for(uint32_t v = 1; v <= BENCH_VERSIONS; v++){
+		uint32_t index = bench_position(where);
+		struct linkedListIterator* iter = ll_getIterator(&versions[v - 1]);
+
+		// Rebuild the whole list from the previous version, then make the change
+		ll_init(&versions[v]);
+		while(ll_hasNext(iter)){
+			ll_add(&versions[v], ll_next(iter), sizeof(record));
+		}
+		free(iter);
+
+		snprintf(record, sizeof(record), "version %u", v);
+		ll_remove(&versions[v], index);
+		ll_addIndex(&versions[v], record, sizeof(record), index);
+	}
+	double elapsed = bench_now() - start;
+
+	printf("rebuild     %-7s %10.1f bytes/version  %9.2f us/version\n", label,
+			(double)(bench_heapInUse() - base) / BENCH_VERSIONS, elapsed * 1e6 / BENCH_VERSIONS);
+
+	for(uint32_t v = 0; v <= BENCH_VERSIONS; v++){
+		ll_clear(&versions[v]);
+	}
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @return This returns 0.
+ */
+int main(void){
+	static const char* labels[] = {"front", "random", "end"};
+
+	for(uint32_t where = 0; where < 3; where++){
+		bench_persistent(labels[where], where);
+		bench_rebuild(labels[where], where);
+	}
+
+	return 0;
+}
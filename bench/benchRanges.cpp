@@ -0,0 +1,140 @@
+/**
+ * This file contains a benchmark of a filter, transform and take pipeline over a list. The
+ * pipeline runs once eagerly, copying the elements that pass each stage into a new list, and
+ * once lazily through the range views of llranges.h.
+ * @file benchRanges.cpp
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "llranges.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <ranges>
+
+/**
+ * The number of elements in the list.
+ */
+#define BENCH_ELEMENTS 1000000
+
+/**
+ * The number of times each pipeline is run.
+ */
+#define BENCH_RUNS 20
+
+/**
+ * This function returns the current time in milliseconds.
+ * @return This returns the time of the monotonic clock in milliseconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return ((double)now.tv_sec * 1e3) + ((double)now.tv_nsec / 1e6);
+}
+
+/**
+ * This function runs the pipeline by building a list for the result of each stage.
+ * @param list This is the list to run the pipeline over.
+ * @param take This is the number of elements taken at the end.
+ * @return This returns the sum of the elements taken.
+ */
+static long bench_eager(struct linkedList& list, int take){
+	struct linkedList filtered;
+	struct linkedList transformed;
+	struct linkedListIterator* iter;
+	long sum = 0;
+
+	ll_init(&filtered);
+	iter = ll_getIterator(&list);
+	while(ll_hasNext(iter)){
+		int value = *(int*)ll_next(iter);
+
+		if((value % 3) == 0){
+			ll_add(&filtered, &value, sizeof(value));
+		}
+	}
+	free(iter);
+
+	ll_init(&transformed);
+	iter = ll_getIterator(&filtered);
+	while(ll_hasNext(iter)){
+		int value = *(int*)ll_next(iter) * 2 + 1;
+
+		ll_add(&transformed, &value, sizeof(value));
+	}
+	free(iter);
+
+	iter = ll_getIterator(&transformed);
+	for(int i = 0; (i < take) && ll_hasNext(iter); i++){
+		sum = sum + *(int*)ll_next(iter);
+	}
+	free(iter);
+
+	ll_clear(&filtered);
+	ll_clear(&transformed);
+
+	return sum;
+}
+
+/**
+ * This function runs the pipeline through range views, without any intermediate list.
+ * @param list This is the list to run the pipeline over.
+ * @param take This is the number of elements taken at the end.
+ * @return This returns the sum of the elements taken.
+ */
+static long bench_lazy(struct linkedList& list, int take){
+	long sum = 0;
+
+	for(int value : ll::view<int>(list) | std::views::filter([](int v){ return (v % 3) == 0; })
+			| std::views::transform([](int v){ return v * 2 + 1; }) | std::views::take(take)){
+		sum = sum + value;
+	}
+
+	return sum;
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @return This returns 0 if both pipelines produced the same results, 1 otherwise.
+ */
+int main(void){
+	struct linkedList list;
+	int result = 0;
+
+	ll_init(&list);
+	for(int i = 0; i < BENCH_ELEMENTS; i++){
+		ll_add(&list, &i, sizeof(i));
+	}
+
+	printf("    take  eager (ms)  views (ms)\n");
+	for(int take = 10; take <= BENCH_ELEMENTS; take = take * 100){
+		long eagerSum = 0;
+		long lazySum = 0;
+		double start = bench_now();
+		double eager;
+		double lazy;
+
+		for(int run = 0; run < BENCH_RUNS; run++){
+			eagerSum = eagerSum + bench_eager(list, take);
+		}
+		eager = (bench_now() - start) / BENCH_RUNS;
+
+		start = bench_now();
+		for(int run = 0; run < BENCH_RUNS; run++){
+			lazySum = lazySum + bench_lazy(list, take);
+		}
+		lazy = (bench_now() - start) / BENCH_RUNS;
+
+		if(eagerSum != lazySum){
+			result = 1;
+		}
+		printf("%8d  %10.3f  %10.3f\n", take, eager, lazy);
+	}
+	ll_clear(&list);
+
+	return result;
+}
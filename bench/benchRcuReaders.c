@@ -0,0 +1,187 @@
+/**
+ * This file contains a benchmark of reader scaling in concurrent reader mode. A growing number
+ * of threads walks a list over and over while one writer keeps replacing elements now and
+ * then, once with lock-free readers and once with every walk and change taking a mutex, which
+ * is what sharing a list took before the mode existed.
+ * @file benchRcuReaders.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * The number of elements in the list.
+ */
+#define BENCH_ELEMENTS 10000
+
+/**
+ * The most reader threads run at once.
+ */
+#define BENCH_MAX_READERS 64
+
+/**
+ * The time every configuration runs for in seconds.
+ */
+#define BENCH_SECONDS 0.25
+
+/**
+ * The time the writer waits between two changes in microseconds.
+ */
+#define BENCH_WRITE_INTERVAL 100
+
+/**
+ * This structure holds the state shared by the threads of one run.
+ */
+struct benchState {
+	struct linkedList list; // The list walked by the readers
+	pthread_mutex_t lock; // Taken around every walk and change when locked is true
+	bool locked; // True to take the lock instead of using read-side critical sections
+	bool done; // Set when the run is over
+	uint64_t visited[BENCH_MAX_READERS * 8]; // The elements visited and their sum for each reader, a cache line apart
+};
+
+/**
+ * This structure is the argument of a reader thread.
+ */
+struct benchReader {
+	struct benchState* state; // The shared state
+	uint32_t index; // The number of the reader
+};
+
+/**
+ * This function returns the current time in seconds.
+ * @return This returns the time of the monotonic clock in seconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/**
+ * This function walks the list until the run is over.
+ * @param argument This is a pointer to the benchReader of the thread.
+ * @return This always returns NULL.
+ */
+static void* bench_reader(void* argument){
+	struct benchReader* reader = (struct benchReader*)argument;
+	struct benchState* state = reader->state;
+	uint64_t visited = 0;
+	uint64_t sum = 0;
+
+	while(!__atomic_load_n(&state->done, __ATOMIC_ACQUIRE)){
+		struct linkedListIterator iter;
+
+		if(state->locked){
+			pthread_mutex_lock(&state->lock);
+		}
+		else{
+			ll_rcuReadLock();
+		}
+
+		iter.current = __atomic_load_n(&state->list.head, __ATOMIC_ACQUIRE);
+		iter.previous = NULL;
+		while(ll_hasNext(&iter)){
+			sum = sum + *(const int*)ll_next(&iter);
+			visited = visited + 1;
+		}
+
+		if(state->locked){
+			pthread_mutex_unlock(&state->lock);
+		}
+		else{
+			ll_rcuReadUnlock();
+		}
+	}
+
+	state->visited[reader->index * 8] = visited;
+	state->visited[(reader->index * 8) + 1] = sum;
+	ll_rcuUnregisterThread();
+
+	return NULL;
+}
+
+/**
+ * This function runs one configuration and returns the elements visited per second.
+ * @param readers This is the number of reader threads.
+ * @param locked This is true to take a mutex instead of using read-side critical sections.
+ * @return This returns the total number of elements visited per second by all readers.
+ */
+static double bench_run(uint32_t readers, bool locked){
+	static struct benchState state;
+	pthread_t threads[BENCH_MAX_READERS];
+	struct benchReader arguments[BENCH_MAX_READERS];
+	struct timespec pause = {0, BENCH_WRITE_INTERVAL * 1000};
+	uint64_t total = 0;
+	double start;
+	double elapsed;
+	int value = 0;
+
+	ll_init(&state.list);
+	ll_setConcurrentReaders(&state.list, !locked);
+	pthread_mutex_init(&state.lock, NULL);
+	state.locked = locked;
+	state.done = false;
+	for(value = 0; value < BENCH_ELEMENTS; value++){
+		ll_add(&state.list, &value, sizeof(value));
+	}
+
+	for(uint32_t i = 0; i < readers; i++){
+		arguments[i].state = &state;
+		arguments[i].index = i;
+		pthread_create(&threads[i], NULL, bench_reader, &arguments[i]);
+	}
+
+	// The calling thread is the writer, replacing one element now and then
+	start = bench_now();
+	while((bench_now() - start) < BENCH_SECONDS){
+		if(locked){
+			pthread_mutex_lock(&state.lock);
+		}
+		ll_remove(&state.list, (ll_size_t)(value % BENCH_ELEMENTS));
+		ll_addIndex(&state.list, &value, sizeof(value), (ll_size_t)(value % BENCH_ELEMENTS));
+		if(locked){
+			pthread_mutex_unlock(&state.lock);
+		}
+		value = value + 1;
+		nanosleep(&pause, NULL);
+	}
+	__atomic_store_n(&state.done, true, __ATOMIC_RELEASE);
+
+	for(uint32_t i = 0; i < readers; i++){
+		pthread_join(threads[i], NULL);
+		total = total + state.visited[i * 8];
+	}
+	elapsed = bench_now() - start;
+
+	ll_setConcurrentReaders(&state.list, false);
+	ll_clear(&state.list);
+	pthread_mutex_destroy(&state.lock);
+
+	return (double)total / elapsed;
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @return This returns 0.
+ */
+int main(void){
+	printf("readers  lock-free (M elements/s)  mutex (M elements/s)\n");
+
+	for(uint32_t readers = 1; readers <= BENCH_MAX_READERS; readers = readers * 2){
+		double lockFree = bench_run(readers, false);
+		double locked = bench_run(readers, true);
+
+		printf("%7u  %24.1f  %20.1f\n", readers, lockFree / 1e6, locked / 1e6);
+	}
+
+	return 0;
+}
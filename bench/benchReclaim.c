@@ -0,0 +1,127 @@
+/**
+ * This file contains a benchmark of the latency a request thread sees when it clears large
+ * lists. Every request appends a batch of elements to a list and every few requests the list,
+ * by then a million elements long, is cleared. The latency of every request is recorded with
+ * the list freeing its nodes synchronously, with the nodes handed to ll_reclaimStep at the end
+ * of each request, and with the nodes handed to the background reclaimer.
+ * @file benchReclaim.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * The number of requests measured for each mode.
+ */
+#define BENCH_REQUESTS 500
+
+/**
+ * The number of elements every request appends.
+ */
+#define BENCH_ADDS 20000
+
+/**
+ * The number of requests between two clears, so the list grows to a million elements.
+ */
+#define BENCH_CLEAR_EVERY 50
+
+/**
+ * The reclaim budget of a request in the incremental mode, enough to keep up with the adds.
+ */
+#define BENCH_STEP_BUDGET (2 * BENCH_ADDS)
+
+/**
+ * These values select how the removed nodes are freed.
+ */
+enum benchMode {
+	BENCH_SYNCHRONOUS, // ll_clear frees every node before returning
+	BENCH_INCREMENTAL, // Every request frees a share of the queue with ll_reclaimStep
+	BENCH_BACKGROUND // The background reclaimer frees the queue
+};
+
+/**
+ * This function returns the current time in microseconds.
+ * @return This returns the time of the monotonic clock in microseconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return ((double)now.tv_sec * 1e6) + ((double)now.tv_nsec / 1e3);
+}
+
+/**
+ * This function compares two latencies for qsort.
+ * @param a This is a pointer to the first latency.
+ * @param b This is a pointer to the second latency.
+ * @return This returns a negative, zero or positive value as a is less than, equal to or
+ *         greater than b.
+ */
+static int bench_compare(const void* a, const void* b){
+	double x = *(const double*)a;
+	double y = *(const double*)b;
+
+	return (x > y) - (x < y);
+}
+
+/**
+ * This function runs the requests in one mode and prints the latency percentiles.
+ * @param mode This is the way removed nodes are freed.
+ * @param name This is the name of the mode printed with the results.
+ */
+static void bench_run(enum benchMode mode, const char* name){
+	double* latencies = (double*)malloc(BENCH_REQUESTS * sizeof(double));
+	struct linkedList list;
+
+	ll_init(&list);
+	ll_setDeferredReclaim(&list, mode != BENCH_SYNCHRONOUS);
+	if(mode == BENCH_BACKGROUND){
+		ll_startReclaimer();
+	}
+
+	for(int request = 0; request < BENCH_REQUESTS; request++){
+		double start = bench_now();
+
+		for(int i = 0; i < BENCH_ADDS; i++){
+			ll_add(&list, &i, sizeof(i));
+		}
+		if((request % BENCH_CLEAR_EVERY) == (BENCH_CLEAR_EVERY - 1)){
+			ll_clear(&list);
+		}
+		if(mode == BENCH_INCREMENTAL){
+			ll_reclaimStep(BENCH_STEP_BUDGET);
+		}
+
+		latencies[request] = bench_now() - start;
+	}
+
+	ll_clear(&list);
+	if(mode == BENCH_BACKGROUND){
+		ll_stopReclaimer();
+	}
+	ll_reclaimStep((size_t)-1);
+
+	qsort(latencies, BENCH_REQUESTS, sizeof(double), bench_compare);
+	printf("%-12s  p50 %8.0f us  p99 %8.0f us  max %8.0f us\n", name, latencies[BENCH_REQUESTS / 2],
+			latencies[(BENCH_REQUESTS * 99) / 100], latencies[BENCH_REQUESTS - 1]);
+
+	free(latencies);
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @return This returns 0.
+ */
+int main(void){
+	bench_run(BENCH_SYNCHRONOUS, "synchronous");
+	bench_run(BENCH_INCREMENTAL, "incremental");
+	bench_run(BENCH_BACKGROUND, "background");
+
+	return 0;
+}
@@ -0,0 +1,541 @@
+/**
+ * This file contains a tool that replays a trace of list operations and reports how the
+ * library handled it. A trace is a text file with one operation per line:
+ *   add                   append an element
+ *   addIndex <index>      insert an element at an index
+ *   remove <index>        remove the element at an index
+ *   get <index>           read the element at an index
+ *   iterate               walk the whole list with an iterator
+ * Indexes past the end of the list are wrapped around its current size, so a trace recorded
+ * elsewhere replays without failing operations. Lines starting with # are ignored.
+ *
+ * The tool can also generate synthetic traces of common access patterns. For every operation
+ * type it reports the throughput and latency percentiles from a log-linear histogram in the
+ * style of HdrHistogram, and for the whole run the peak resident set size and the number of
+ * allocations made while replaying.
+ *
+ * Usage: benchReplay <trace file>
+ *        benchReplay --generate <queue|lru|random|append> [--ops N] [--size N] [--payload BYTES]
+ *                    [--output FILE]
+ * Without --output a generated trace is replayed straight away.
+ * @file benchReplay.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+#include "nodepool.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+
+/**
+ * The number of linear sub-buckets per power of two in a latency histogram, which bounds the
+ * error of a reported percentile to about 1/16.
+ */
+#define REPLAY_SUB_BUCKETS 16
+
+/**
+ * The number of powers of two a latency histogram covers, from 1 ns to over a minute.
+ */
+#define REPLAY_MAGNITUDES 40
+
+/**
+ * The largest payload size accepted.
+ */
+#define REPLAY_MAX_PAYLOAD 4096
+
+/**
+ * These values are the types of operations in a trace.
+ */
+enum replayOp {
+	REPLAY_ADD,
+	REPLAY_ADD_INDEX,
+	REPLAY_REMOVE,
+	REPLAY_GET,
+	REPLAY_ITERATE,
+	REPLAY_OP_TYPES // The number of operation types
+};
+
+/**
+ * The names of the operation types as they appear in a trace.
+ */
+static const char* const replayNames[REPLAY_OP_TYPES] = {"add", "addIndex", "remove", "get", "iterate"};
+
+/**
+ * This structure is one operation of a trace.
+ */
+struct replayEntry {
+	enum replayOp op; // The type of the operation
+	uint32_t index; // The index the operation works on, unused for add and iterate
+};
+
+/**
+ * This structure is a latency histogram with log-linear buckets.
+ */
+struct replayHistogram {
+	uint64_t counts[REPLAY_MAGNITUDES][REPLAY_SUB_BUCKETS]; // The number of samples per bucket
+	uint64_t samples; // The total number of samples
+	uint64_t totalNanoseconds; // The sum of all samples
+	uint64_t max; // The largest sample
+};
+
+static uint64_t allocations = 0; // The number of calls to malloc, calloc and realloc without a block
+static uint64_t frees = 0; // The number of calls to free with a block
+static bool counting = false; // True while the replay is running and allocations are counted
+
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t count, size_t size);
+extern void* __libc_realloc(void* block, size_t size);
+extern void __libc_free(void* block);
+
+/**
+ * These functions replace the allocator of the C library to count the allocations the library
+ * makes while a trace is replayed. They only work with the GNU C library.
+ */
+void* malloc(size_t size){
+	if(counting){
+		__atomic_add_fetch(&allocations, 1, __ATOMIC_RELAXED);
+	}
+	return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size){
+	if(counting){
+		__atomic_add_fetch(&allocations, 1, __ATOMIC_RELAXED);
+	}
+	return __libc_calloc(count, size);
+}
+
+void* realloc(void* block, size_t size){
+	if(counting && (block == NULL)){
+		__atomic_add_fetch(&allocations, 1, __ATOMIC_RELAXED);
+	}
+	return __libc_realloc(block, size);
+}
+
+void free(void* block){
+	if(counting && (block != NULL)){
+		__atomic_add_fetch(&frees, 1, __ATOMIC_RELAXED);
+	}
+	__libc_free(block);
+}
+
+/**
+ * This function returns the current time in nanoseconds.
+ * @return This returns the time of the monotonic clock in nanoseconds.
+ */
+static uint64_t replay_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return ((uint64_t)now.tv_sec * 1000000000ull) + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * This function adds a sample to a histogram. Values below 16 ns are counted exactly and
+ * larger values fall into one of 16 buckets per power of two.
+ * @param histogram This is a pointer to the histogram.
+ * @param value This is the sample in nanoseconds.
+ */
+static void replay_record(struct replayHistogram* histogram, uint64_t value){
+	uint32_t magnitude = 0;
+	uint32_t sub = (uint32_t)value;
+
+	if(value >= REPLAY_SUB_BUCKETS){
+		uint32_t bits = 63 - (uint32_t)__builtin_clzll(value);
+
+		magnitude = bits - 3;
+		sub = (uint32_t)(value >> (bits - 4)) - REPLAY_SUB_BUCKETS;
+	}
+	if(magnitude >= REPLAY_MAGNITUDES){
+		magnitude = REPLAY_MAGNITUDES - 1;
+		sub = REPLAY_SUB_BUCKETS - 1;
+	}
+
+	histogram->counts[magnitude][sub] = histogram->counts[magnitude][sub] + 1;
+	histogram->samples = histogram->samples + 1;
+	histogram->totalNanoseconds = histogram->totalNanoseconds + value;
+	if(value > histogram->max){
+		histogram->max = value;
+	}
+}
+
+/**
+ * This function returns the value below which a share of the samples of a histogram fall.
+ * @param histogram This is a pointer to the histogram.
+ * @param percentile This is the share in percent.
+ * @return This returns the upper edge of the bucket holding the percentile in nanoseconds.
+ */
+static uint64_t replay_percentile(const struct replayHistogram* histogram, double percentile){
+	uint64_t target = (uint64_t)((percentile / 100.0) * (double)histogram->samples + 0.5);
+	uint64_t seen = 0;
+	uint64_t value = histogram->max;
+	bool found = false;
+
+	if(target == 0){
+		target = 1;
+	}
+
+	for(uint32_t magnitude = 0; (magnitude < REPLAY_MAGNITUDES) && !found; magnitude++){
+		for(uint32_t sub = 0; (sub < REPLAY_SUB_BUCKETS) && !found; sub++){
+			seen = seen + histogram->counts[magnitude][sub];
+			if(seen >= target){
+				// Bucket m > 0 holds values from (16 + sub) << (m - 1) up to the next bucket
+				value = (magnitude == 0) ? sub : ((uint64_t)(REPLAY_SUB_BUCKETS + sub + 1) << (magnitude - 1)) - 1;
+				found = true;
+			}
+		}
+	}
+
+	return (value < histogram->max) ? value : histogram->max;
+}
+
+/**
+ * This function checks if a name is the name of a pattern replay_generate knows.
+ * @param pattern This is the name to check.
+ * @return This returns true if the pattern is known.
+ */
+static bool replay_knownPattern(const char* pattern){
+	return (strcmp(pattern, "queue") == 0) || (strcmp(pattern, "lru") == 0) ||
+			(strcmp(pattern, "random") == 0) || (strcmp(pattern, "append") == 0);
+}
+
+/**
+ * This function appends an operation to a trace and keeps track of the list length.
+ * @param entries This is an array with room for the operation.
+ * @param count This is a pointer to the number of operations in the array.
+ * @param length This is a pointer to the length the list will have at this point.
+ * @param op This is the type of the operation.
+ * @param index This is the index the operation works on.
+ */
+static void replay_push(struct replayEntry* entries, size_t* count, uint32_t* length, enum replayOp op, uint32_t index){
+	entries[*count].op = op;
+	entries[*count].index = index;
+	*count = *count + 1;
+
+	if((op == REPLAY_ADD) || (op == REPLAY_ADD_INDEX)){
+		*length = *length + 1;
+	}
+	else if((op == REPLAY_REMOVE) && (*length != 0)){
+		*length = *length - 1;
+	}
+}
+
+/**
+ * This function reads a trace file.
+ * @param path This is the path of the file.
+ * @param count This is a pointer that receives the number of operations.
+ * @return This returns an array of the operations, or NULL if the file could not be read.
+ */
+static struct replayEntry* replay_read(const char* path, size_t* count){
+	FILE* file = fopen(path, "r");
+	struct replayEntry* entries = NULL;
+	size_t capacity = 0;
+	uint32_t length = 0;
+	char line[256];
+
+	*count = 0;
+	if(file != NULL){
+		while(fgets(line, sizeof(line), file) != NULL){
+			char name[32];
+			unsigned long index = 0;
+			int op = -1;
+
+			// Blank lines and comments have no operation
+			if((sscanf(line, "%31s %lu", name, &index) >= 1) && (name[0] != '#')){
+				for(int i = 0; i < REPLAY_OP_TYPES; i++){
+					if(strcmp(name, replayNames[i]) == 0){
+						op = i;
+					}
+				}
+
+				if(op < 0){
+					fprintf(stderr, "unknown operation %s\n", name);
+				}
+				else{
+					if(*count == capacity){
+						capacity = (capacity == 0) ? 1024 : capacity * 2;
+						entries = (struct replayEntry*)realloc(entries, capacity * sizeof(struct replayEntry));
+					}
+					replay_push(entries, count, &length, (enum replayOp)op, (uint32_t)index);
+				}
+			}
+		}
+
+		fclose(file);
+	}
+	else{
+		fprintf(stderr, "cannot open %s\n", path);
+	}
+
+	return entries;
+}
+
+/**
+ * This function generates a synthetic trace. Every pattern starts by appending size elements.
+ *   queue   elements are appended at the back and removed from the front in turn
+ *   lru     a hit reads an element and moves it to the back, a miss evicts the front element
+ *           and appends a new one
+ *   random  inserts, removals and reads at uniformly random indexes
+ *   append  mostly appends, with an occasional walk over the list
+ * @param pattern This is the name of a pattern replay_knownPattern accepts.
+ * @param operations This is the number of accesses after the initial appends. An access of
+ *                   the lru pattern takes up to three operations.
+ * @param size This is the number of elements appended first.
+ * @param count This is a pointer that receives the number of operations.
+ * @return This returns an array of the operations.
+ */
+static struct replayEntry* replay_generate(const char* pattern, size_t operations, uint32_t size, size_t* count){
+	struct replayEntry* entries = (struct replayEntry*)malloc(((3 * operations) + size) * sizeof(struct replayEntry));
+	uint64_t random = 0x2545F4914F6CDD1Dull;
+	uint32_t length = 0;
+
+	*count = 0;
+	for(uint32_t i = 0; i < size; i++){
+		replay_push(entries, count, &length, REPLAY_ADD, 0);
+	}
+
+	for(size_t i = 0; i < operations; i++){
+		uint32_t roll;
+
+		random ^= random << 13;
+		random ^= random >> 7;
+		random ^= random << 17;
+		roll = (uint32_t)(random >> 32);
+
+		if(strcmp(pattern, "queue") == 0){
+			replay_push(entries, count, &length, ((i % 2) == 0) ? REPLAY_ADD : REPLAY_REMOVE, 0);
+		}
+		else if(strcmp(pattern, "lru") == 0){
+			if((length != 0) && ((roll % 10) < 8)){
+				// Hits are skewed towards the back, where the recently used elements live
+				uint64_t distance = (uint64_t)((roll >> 4) % length);
+				uint32_t index = length - 1 - (uint32_t)((distance * distance) / length);
+
+				replay_push(entries, count, &length, REPLAY_GET, index);
+				replay_push(entries, count, &length, REPLAY_REMOVE, index);
+			}
+			else if(length != 0){
+				replay_push(entries, count, &length, REPLAY_REMOVE, 0);
+			}
+			replay_push(entries, count, &length, REPLAY_ADD, 0);
+		}
+		else if(strcmp(pattern, "random") == 0){
+			uint32_t choice = (roll >> 28) % 3;
+
+			replay_push(entries, count, &length, (choice == 0) ? REPLAY_ADD_INDEX : ((choice == 1) ? REPLAY_REMOVE : REPLAY_GET),
+					roll % (length + 1));
+		}
+		else{
+			replay_push(entries, count, &length, ((roll % 1000) == 0) ? REPLAY_ITERATE : REPLAY_ADD, 0);
+		}
+	}
+
+	return entries;
+}
+
+/**
+ * This function writes a trace to a file.
+ * @param path This is the path of the file.
+ * @param entries This is an array of the operations.
+ * @param count This is the number of operations.
+ * @return This returns true if the file was written.
+ */
+static bool replay_write(const char* path, const struct replayEntry* entries, size_t count){
+	FILE* file = fopen(path, "w");
+
+	if(file == NULL){
+		fprintf(stderr, "cannot create %s\n", path);
+		return false;
+	}
+
+	for(size_t i = 0; i < count; i++){
+		if((entries[i].op == REPLAY_ADD) || (entries[i].op == REPLAY_ITERATE)){
+			fprintf(file, "%s\n", replayNames[entries[i].op]);
+		}
+		else{
+			fprintf(file, "%s %u\n", replayNames[entries[i].op], entries[i].index);
+		}
+	}
+
+	fclose(file);
+
+	return true;
+}
+
+/**
+ * This function replays a trace and prints the report.
+ * @param entries This is an array of the operations.
+ * @param count This is the number of operations.
+ * @param payload This is the size of the element data in bytes.
+ */
+static void replay_run(const struct replayEntry* entries, size_t count, uint32_t payload){
+	struct replayHistogram* histograms = (struct replayHistogram*)calloc(REPLAY_OP_TYPES, sizeof(struct replayHistogram));
+	unsigned char object[REPLAY_MAX_PAYLOAD];
+	struct nodePoolStats poolBefore;
+	struct nodePoolStats poolAfter;
+	struct linkedList list;
+	struct rusage usage;
+	uint64_t checksum = 0;
+	uint64_t start;
+	uint64_t elapsed;
+
+	memset(object, 0x5A, sizeof(object));
+	ll_init(&list);
+	np_stats(&poolBefore);
+
+	counting = true;
+	start = replay_now();
+	for(size_t i = 0; i < count; i++){
+		uint32_t size = ll_size(&list);
+		uint32_t index = entries[i].index;
+		uint64_t before = replay_now();
+
+		switch(entries[i].op){
+			case REPLAY_ADD:
+				ll_add(&list, object, payload);
+				break;
+			case REPLAY_ADD_INDEX:
+				ll_addIndex(&list, object, payload, index % (size + 1));
+				break;
+			case REPLAY_REMOVE:
+				if(size != 0){
+					ll_remove(&list, index % size);
+				}
+				break;
+			case REPLAY_GET:
+				if(size != 0){
+					checksum = checksum + *(unsigned char*)ll_get(&list, index % size);
+				}
+				break;
+			default:
+			{
+				struct linkedListIterator* iter = ll_getIterator(&list);
+
+				while(ll_hasNext(iter)){
+					checksum = checksum + *(unsigned char*)ll_next(iter);
+				}
+				free(iter);
+				break;
+			}
+		}
+
+		replay_record(&histograms[entries[i].op], replay_now() - before);
+	}
+	elapsed = replay_now() - start;
+	counting = false;
+
+	np_stats(&poolAfter);
+	getrusage(RUSAGE_SELF, &usage);
+
+	printf("%zu operations in %.3f s, %.0f ops/s, final size %llu, checksum %llu\n", count, (double)elapsed / 1e9,
+			(double)count * 1e9 / (double)elapsed, (unsigned long long)ll_size(&list), (unsigned long long)checksum);
+	printf("%-9s %10s %12s %9s %9s %9s %9s %9s %9s\n", "op", "count", "ops/s", "mean ns", "p50", "p90", "p99", "p99.9", "max");
+	for(int op = 0; op < REPLAY_OP_TYPES; op++){
+		const struct replayHistogram* histogram = &histograms[op];
+
+		if(histogram->samples != 0){
+			printf("%-9s %10llu %12.0f %9.0f %9llu %9llu %9llu %9llu %9llu\n", replayNames[op],
+					(unsigned long long)histogram->samples,
+					(double)histogram->samples * 1e9 / (double)histogram->totalNanoseconds,
+					(double)histogram->totalNanoseconds / (double)histogram->samples,
+					(unsigned long long)replay_percentile(histogram, 50.0),
+					(unsigned long long)replay_percentile(histogram, 90.0),
+					(unsigned long long)replay_percentile(histogram, 99.0),
+					(unsigned long long)replay_percentile(histogram, 99.9),
+					(unsigned long long)histogram->max);
+		}
+	}
+	printf("peak RSS %ld KiB\n", usage.ru_maxrss);
+	printf("allocations %llu, frees %llu, node pool system allocations %llu\n", (unsigned long long)allocations,
+			(unsigned long long)frees, (unsigned long long)(poolAfter.systemAllocations - poolBefore.systemAllocations));
+
+	ll_clear(&list);
+	free(histograms);
+}
+
+/**
+ * This is the main function of the tool.
+ * @param argc This is the number of arguments.
+ * @param argv This is the array of arguments.
+ * @return This returns 0 if the trace was replayed or written, 1 otherwise.
+ */
+int main(int argc, char** argv){
+	struct replayEntry* entries = NULL;
+	const char* pattern = NULL;
+	const char* output = NULL;
+	const char* input = NULL;
+	size_t operations = 1000000;
+	uint32_t size = 1000;
+	uint32_t payload = 16;
+	size_t count = 0;
+	int status = 0;
+
+	for(int i = 1; i < argc; i++){
+		if((strcmp(argv[i], "--generate") == 0) && (i + 1 < argc)){
+			pattern = argv[++i];
+		}
+		else if((strcmp(argv[i], "--ops") == 0) && (i + 1 < argc)){
+			operations = strtoull(argv[++i], NULL, 10);
+		}
+		else if((strcmp(argv[i], "--size") == 0) && (i + 1 < argc)){
+			size = (uint32_t)strtoul(argv[++i], NULL, 10);
+		}
+		else if((strcmp(argv[i], "--payload") == 0) && (i + 1 < argc)){
+			payload = (uint32_t)strtoul(argv[++i], NULL, 10);
+		}
+		else if((strcmp(argv[i], "--output") == 0) && (i + 1 < argc)){
+			output = argv[++i];
+		}
+		else if(argv[i][0] != '-'){
+			input = argv[i];
+		}
+		else{
+			input = NULL;
+			pattern = NULL;
+			break;
+		}
+	}
+
+	if((payload == 0) || (payload > REPLAY_MAX_PAYLOAD)){
+		fprintf(stderr, "payload must be between 1 and %d bytes\n", REPLAY_MAX_PAYLOAD);
+		return 1;
+	}
+
+	if((pattern != NULL) && !replay_knownPattern(pattern)){
+		fprintf(stderr, "unknown pattern %s\n", pattern);
+		return 1;
+	}
+
+	if(pattern != NULL){
+		entries = replay_generate(pattern, operations, size, &count);
+	}
+	else if(input != NULL){
+		entries = replay_read(input, &count);
+	}
+	else{
+		fprintf(stderr, "usage: %s <trace file>\n"
+				"       %s --generate <queue|lru|random|append> [--ops N] [--size N] [--payload BYTES] [--output FILE]\n",
+				argv[0], argv[0]);
+		return 1;
+	}
+
+	if(entries == NULL){
+		status = 1;
+	}
+	else if(output != NULL){
+		status = replay_write(output, entries, count) ? 0 : 1;
+	}
+	else{
+		replay_run(entries, count, payload);
+	}
+
+	free(entries);
+
+	return status;
+}
@@ -0,0 +1,141 @@
+/**
+ * This file contains a benchmark of replicating a list with change deltas. A primary list
+ * tracks its changes, and after every round of changes the delta since the replica's last
+ * sequence number is exported, applied to the replica and trimmed from the log. The same is
+ * done for lists of different sizes with the same rate of change, next to the cost of sending
+ * the whole list instead.
+ * @file benchReplication.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * The number of rounds of changes replicated for each list size.
+ */
+#define BENCH_ROUNDS 200
+
+/**
+ * The number of changes made in each round.
+ */
+#define BENCH_CHANGES 1000
+
+/**
+ * The size of a record in bytes.
+ */
+#define BENCH_RECORD_SIZE 32
+
+/**
+ * This function returns the current time in seconds.
+ * @return This returns the time of the monotonic clock in seconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/**
+ * This function makes one change to the primary: mostly appends of new records, with the
+ * oldest records dropped from the front and now and then one inserted near the end.
+ * @param list This is a pointer to the primary.
+ * @param serial This is the number of the change.
+ */
+static void bench_change(struct linkedList* list, uint32_t serial){
+	char record[BENCH_RECORD_SIZE];
+	uint32_t kind = serial % 10;
+
+	memset(record, 0, sizeof(record));
+	snprintf(record, sizeof(record), "event %u", serial);
+
+	if(kind < 6){
+		ll_add(list, record, sizeof(record));
+	}
+	else if(kind < 9){
+		free(ll_popFront(list, NULL));
+	}
+	else{
+		ll_addIndex(list, record, sizeof(record), ll_size(list) - 1);
+	}
+}
+
+/**
+ * This function replicates rounds of changes to a list of a given size and prints the cost.
+ * @param elements This is the size of the list when replication starts.
+ */
+static void bench_replicate(uint32_t elements){
+	struct linkedList primary;
+	struct linkedList replica;
+	char record[BENCH_RECORD_SIZE];
+	uint64_t since = 0;
+	uint64_t deltaBytes = 0;
+	double replicating = 0;
+	double start;
+	ll_size_t size;
+	void* snapshot;
+	ll_size_t* offsets;
+
+	ll_init(&primary);
+	ll_init(&replica);
+	memset(record, 0, sizeof(record));
+	for(uint32_t i = 0; i < elements; i++){
+		snprintf(record, sizeof(record), "seed %u", i);
+		ll_add(&primary, record, sizeof(record));
+	}
+
+	// Sending the whole list is what a replica needs to start, and what every round cost before
+	offsets = (ll_size_t*)malloc(((size_t)elements + 1) * sizeof(ll_size_t));
+	start = bench_now();
+	snapshot = ll_toArray(&primary, NULL, 0, offsets, &size);
+	ll_fromArray(&replica, snapshot, offsets, elements, 0);
+	double full = bench_now() - start;
+	free(snapshot);
+	free(offsets);
+
+	ll_setChangeTracking(&primary, true);
+	for(uint32_t round = 0; round < BENCH_ROUNDS; round++){
+		void* delta;
+
+		for(uint32_t i = 0; i < BENCH_CHANGES; i++){
+			bench_change(&primary, (round * BENCH_CHANGES) + i);
+		}
+
+		start = bench_now();
+		delta = ll_exportDelta(&primary, since, NULL, 0, &size);
+		ll_applyDelta(&replica, delta, size, &since);
+		ll_trimChanges(&primary, since);
+		replicating = replicating + (bench_now() - start);
+
+		deltaBytes = deltaBytes + size;
+		free(delta);
+	}
+
+	printf("%8u elements  full copy %9.1f us  delta %7.1f us/round  %6.1f ns/change  %5.1f bytes/change  %6.2f M changes/s  %s\n",
+			elements, full * 1e6, replicating * 1e6 / BENCH_ROUNDS, replicating * 1e9 / (BENCH_ROUNDS * BENCH_CHANGES),
+			(double)deltaBytes / (BENCH_ROUNDS * BENCH_CHANGES), (BENCH_ROUNDS * BENCH_CHANGES) / replicating / 1e6,
+			(ll_size(&primary) == ll_size(&replica)) ? "in sync" : "OUT OF SYNC");
+
+	ll_clear(&primary);
+	ll_clear(&replica);
+	ll_setChangeTracking(&primary, false);
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @return This returns 0.
+ */
+int main(void){
+	bench_replicate(10000);
+	bench_replicate(100000);
+	bench_replicate(1000000);
+
+	return 0;
+}
@@ -0,0 +1,178 @@
+/**
+ * This file contains a benchmark of the block search functions. Lists of 4 and 8 byte keys are
+ * counted for a key and searched for the first greater key, once with ll_count and
+ * ll_findFirstGreater, which compare whole blocks of keys with the vector kernels the processor
+ * supports, and once with a loop comparing one element at a time through an iterator, which is
+ * how a list was searched before. A small list that fits in the cache shows the cost of the
+ * comparisons, a large one the cost of reaching the nodes.
+ * @file benchSearch.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * The number of times every search is repeated, the fastest time is kept.
+ */
+#define BENCH_REPEATS 10
+
+/**
+ * This function returns the current time in seconds.
+ * @return This returns the time of the monotonic clock in seconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/**
+ * This function counts the elements equal to a key one element at a time.
+ * @param list This is a pointer to the list.
+ * @param key This is the key.
+ * @param keySize This is the size of the key in bytes, 4 or 8.
+ * @return This returns the number of equal elements.
+ */
+static ll_size_t bench_scalarCount(struct linkedList* list, int64_t key, uint32_t keySize){
+	struct linkedListIterator* iter = ll_getIterator(list);
+	ll_size_t matches = 0;
+
+	while(ll_hasNext(iter)){
+		const void* data = ll_next(iter);
+		int64_t value;
+
+		if(keySize == 4){
+			int32_t narrow;
+			memcpy(&narrow, data, sizeof(narrow));
+			value = narrow;
+		}
+		else{
+			memcpy(&value, data, sizeof(value));
+		}
+		matches = matches + (value == key);
+	}
+	free(iter);
+
+	return matches;
+}
+
+/**
+ * This function finds the first element greater than a key one element at a time.
+ * @param list This is a pointer to the list.
+ * @param key This is the key.
+ * @param keySize This is the size of the key in bytes, 4 or 8.
+ * @return This returns the index of the first greater element, or the size of the list if there is none.
+ */
+static ll_size_t bench_scalarGreater(struct linkedList* list, int64_t key, uint32_t keySize){
+	struct linkedListIterator* iter = ll_getIterator(list);
+	ll_size_t index = 0;
+	bool found = false;
+
+	while(!found && ll_hasNext(iter)){
+		const void* data = ll_next(iter);
+		int64_t value;
+
+		if(keySize == 4){
+			int32_t narrow;
+			memcpy(&narrow, data, sizeof(narrow));
+			value = narrow;
+		}
+		else{
+			memcpy(&value, data, sizeof(value));
+		}
+		found = (value > key);
+		index = index + (found ? 0 : 1);
+	}
+	free(iter);
+
+	return index;
+}
+
+/**
+ * This function times both kinds of search over a list of keys of one size and prints them.
+ * @param keySize This is the size of the keys in bytes, 4 or 8.
+ * @param elements This is the number of elements in the list.
+ */
+static void bench_keys(uint32_t keySize, uint32_t elements){
+	struct linkedList list;
+	double best[4] = {1e9, 1e9, 1e9, 1e9};
+	ll_size_t results[4] = {0, 0, 0, 0};
+	int64_t key = 7;
+	int64_t last = elements;
+
+	// Keys cycle through 0 to 99 so counts find many matches, and only the last key is greater than 100
+	ll_init(&list);
+	for(uint32_t i = 0; i < elements; i++){
+		int64_t value = (i == (elements - 1)) ? last : (int64_t)(i % 100);
+		int32_t narrow = (int32_t)value;
+
+		ll_add(&list, (keySize == 4) ? (const void*)&narrow : (const void*)&value, keySize);
+	}
+
+	for(uint32_t repeat = 0; repeat < BENCH_REPEATS; repeat++){
+		double times[4];
+		double start;
+		int32_t narrow = (int32_t)key;
+		int32_t narrowBound = 100;
+		int64_t bound = 100;
+		const void* countKey = (keySize == 4) ? (const void*)&narrow : (const void*)&key;
+		const void* greaterKey = (keySize == 4) ? (const void*)&narrowBound : (const void*)&bound;
+
+		start = bench_now();
+		results[0] = ll_count(&list, countKey, keySize);
+		times[0] = bench_now() - start;
+
+		start = bench_now();
+		results[1] = bench_scalarCount(&list, key, keySize);
+		times[1] = bench_now() - start;
+
+		start = bench_now();
+		ll_findFirstGreater(&list, greaterKey, keySize, &results[2]);
+		times[2] = bench_now() - start;
+
+		start = bench_now();
+		results[3] = bench_scalarGreater(&list, bound, keySize);
+		times[3] = bench_now() - start;
+
+		for(uint32_t i = 0; i < 4; i++){
+			if(times[i] < best[i]){
+				best[i] = times[i];
+			}
+		}
+	}
+
+	printf("%8u elements  %u byte keys  count %6.2f ns/element block  %6.2f ns/element scalar  %5.2fx  |  first greater %6.2f ns/element block  %6.2f ns/element scalar  %5.2fx  %s\n",
+			elements, keySize, best[0] * 1e9 / elements, best[1] * 1e9 / elements, best[1] / best[0],
+			best[2] * 1e9 / elements, best[3] * 1e9 / elements, best[3] / best[2],
+			((results[0] == results[1]) && (results[2] == results[3])) ? "results agree" : "RESULTS DIFFER");
+
+	ll_clear(&list);
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @return This returns 0.
+ */
+int main(void){
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+	printf("kernels: %s\n", __builtin_cpu_supports("avx2") ? "avx2" : (__builtin_cpu_supports("sse4.2") ? "sse4.2" : "scalar"));
+#else
+	printf("kernels: scalar\n");
+#endif
+
+	bench_keys(4, 10000);
+	bench_keys(8, 10000);
+	bench_keys(4, 1000000);
+	bench_keys(8, 1000000);
+
+	return 0;
+}
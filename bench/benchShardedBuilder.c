@@ -0,0 +1,138 @@
+/**
+ * This file contains a benchmark of ingest scaling with the sharded builder. A growing number
+ * of threads adds a fixed number of elements, once each into its own shard of a builder that
+ * is merged into one list at the end, and once into one list shared behind a mutex, which is
+ * how threads built a list together before the builder existed.
+ * @file benchShardedBuilder.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "shardedbuilder.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * The number of elements added in every configuration.
+ */
+#define BENCH_ELEMENTS 1000000
+
+/**
+ * The most threads that add at once.
+ */
+#define BENCH_MAX_THREADS 16
+
+/**
+ * This structure is the argument of an ingest thread.
+ */
+struct benchWorker {
+	struct shardedBuilder* builder; // The builder to add to, NULL to add to the shared list
+	struct linkedList* list; // The shared list, used when builder is NULL
+	pthread_mutex_t* lock; // The lock of the shared list
+	uint32_t shard; // The shard of the thread and the first sequence number it adds
+	uint32_t threads; // The number of threads adding
+};
+
+/**
+ * This function returns the current time in seconds.
+ * @return This returns the time of the monotonic clock in seconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/**
+ * This function adds the elements of one thread.
+ * @param argument This is a pointer to the benchWorker of the thread.
+ * @return This always returns NULL.
+ */
+static void* bench_ingest(void* argument){
+	struct benchWorker* worker = (struct benchWorker*)argument;
+
+	// Thread t adds the values t, t + threads, t + 2 * threads and so on
+	for(uint32_t value = worker->shard; value < BENCH_ELEMENTS; value = value + worker->threads){
+		if(worker->builder != NULL){
+			sb_addSequenced(worker->builder, worker->shard, value, &value, sizeof(value));
+		}
+		else{
+			pthread_mutex_lock(worker->lock);
+			ll_add(worker->list, &value, sizeof(value));
+			pthread_mutex_unlock(worker->lock);
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * This function runs one configuration and returns the elements added per second.
+ * @param threads This is the number of threads adding.
+ * @param sharded This is true to add into a sharded builder, false to add into a shared list.
+ * @param order This is the order the shards are merged in.
+ * @return This returns the number of elements in the finished list per second.
+ */
+static double bench_run(uint32_t threads, bool sharded, enum shardedMergeOrder order){
+	struct shardedBuilder builder;
+	struct linkedList list;
+	pthread_mutex_t lock;
+	pthread_t workers[BENCH_MAX_THREADS];
+	struct benchWorker arguments[BENCH_MAX_THREADS];
+	double start;
+	double elapsed;
+
+	ll_init(&list);
+	pthread_mutex_init(&lock, NULL);
+	sb_init(&builder, threads);
+
+	start = bench_now();
+	for(uint32_t i = 0; i < threads; i++){
+		arguments[i].builder = sharded ? &builder : NULL;
+		arguments[i].list = &list;
+		arguments[i].lock = &lock;
+		arguments[i].shard = i;
+		arguments[i].threads = threads;
+		pthread_create(&workers[i], NULL, bench_ingest, &arguments[i]);
+	}
+	for(uint32_t i = 0; i < threads; i++){
+		pthread_join(workers[i], NULL);
+	}
+	if(sharded){
+		sb_merge(&builder, &list, order);
+	}
+	elapsed = bench_now() - start;
+
+	if(ll_size(&list) != BENCH_ELEMENTS){
+		printf("lost elements: %llu of %u\n", (unsigned long long)ll_size(&list), BENCH_ELEMENTS);
+	}
+
+	sb_destroy(&builder);
+	pthread_mutex_destroy(&lock);
+	ll_clear(&list);
+
+	return (double)BENCH_ELEMENTS / elapsed;
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @return This returns 0.
+ */
+int main(void){
+	printf("threads  mutex (M/s)  sharded arbitrary (M/s)  sharded sequence (M/s)\n");
+
+	for(uint32_t threads = 1; threads <= BENCH_MAX_THREADS; threads = threads * 2){
+		double locked = bench_run(threads, false, SB_ORDER_ARBITRARY);
+		double arbitrary = bench_run(threads, true, SB_ORDER_ARBITRARY);
+		double sequence = bench_run(threads, true, SB_ORDER_SEQUENCE);
+
+		printf("%7u  %11.2f  %23.2f  %22.2f\n", threads, locked / 1e6, arbitrary / 1e6, sequence / 1e6);
+	}
+
+	return 0;
+}
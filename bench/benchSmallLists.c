@@ -0,0 +1,116 @@
+/**
+ * This file contains a benchmark of lists of different small sizes. Many lists of the same size
+ * are built, walked and cleared, and the time per element and the memory per element are
+ * printed for every size. The benchmark is built once against the library, where the first
+ * nodes of a list come from one block, and once against a copy built with LL_SMALL_LIST_NODES
+ * set to 0, where every node is allocated on its own, so comparing the two shows the sizes
+ * where the block pays off and where lists grow past it.
+ * @file benchSmallLists.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * The number of elements in all lists of one size together.
+ */
+#define BENCH_ELEMENTS 1000000
+
+/**
+ * The number of times the lists are walked.
+ */
+#define BENCH_WALKS 10
+
+/**
+ * This function returns the current time in seconds.
+ * @return This returns the time of the monotonic clock in seconds.
+ */
+static double bench_now(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/**
+ * This function builds, walks and clears lists of one size and prints the cost per element.
+ * @param elements This is the number of elements in every list.
+ */
+static void bench_size(uint32_t elements){
+	uint32_t count = BENCH_ELEMENTS / elements;
+	struct linkedList* lists = (struct linkedList*)malloc(count * sizeof(struct linkedList));
+	struct memoryUsage usage;
+	uint64_t allocated = 0;
+	uint64_t sum = 0;
+	double build;
+	double walk;
+	double clear;
+	double start;
+
+	start = bench_now();
+	for(uint32_t i = 0; i < count; i++){
+		ll_init(&lists[i]);
+		for(uint32_t j = 0; j < elements; j++){
+			ll_add(&lists[i], &j, sizeof(j));
+		}
+	}
+	build = bench_now() - start;
+
+	for(uint32_t i = 0; i < count; i++){
+		ll_memoryUsage(&lists[i], &usage);
+		allocated = allocated + usage.allocatedBytes;
+	}
+
+	start = bench_now();
+	for(uint32_t walks = 0; walks < BENCH_WALKS; walks++){
+		for(uint32_t i = 0; i < count; i++){
+			struct linkedListIterator iter;
+
+			iter.current = lists[i].head;
+			iter.previous = NULL;
+			while(ll_hasNext(&iter)){
+				sum = sum + *(const uint32_t*)ll_next(&iter);
+			}
+		}
+	}
+	walk = (bench_now() - start) / BENCH_WALKS;
+
+	start = bench_now();
+	for(uint32_t i = 0; i < count; i++){
+		ll_clear(&lists[i]);
+	}
+	clear = bench_now() - start;
+
+	printf("%5u elements  build %6.2f ns/element  walk %6.2f ns/element  clear %6.2f ns/element  %6.1f bytes/element  (checksum %llu)\n",
+			elements, build * 1e9 / ((double)count * elements), walk * 1e9 / ((double)count * elements),
+			clear * 1e9 / ((double)count * elements), (double)allocated / ((double)count * elements),
+			(unsigned long long)sum);
+
+	free(lists);
+}
+
+/**
+ * This is the main function of the benchmark.
+ * @return This returns 0.
+ */
+int main(void){
+	static const uint32_t sizes[] = {1, 2, 4, 8, 12, 16, 17, 20, 24, 32, 48, 64, 128};
+
+#ifdef LL_SMALL_LIST_NODES
+	printf("every node allocated on its own\n");
+#else
+	printf("first nodes taken from a small node block\n");
+#endif
+
+	for(uint32_t i = 0; i < (sizeof(sizes) / sizeof(sizes[0])); i++){
+		bench_size(sizes[i]);
+	}
+
+	return 0;
+}
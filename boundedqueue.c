@@ -0,0 +1,302 @@
+/**
+ * This file contains the implementation of the bounded queue functions using the structures
+ * defined in the header file. Nodes are allocated and filled before the lock is taken so the
+ * lock is only held while links are changed.
+ * @file boundedqueue.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "boundedqueue.h"
+
+#include <time.h>
+
+/**
+ * This function computes the absolute time a timed wait gives up at.
+ * @param deadline This is a pointer to the time structure to fill.
+ * @param timeoutMs This is the timeout in milliseconds from now.
+ */
+static void bq_deadline(struct timespec* deadline, uint32_t timeoutMs){
+	clock_gettime(CLOCK_MONOTONIC, deadline);
+
+	deadline->tv_sec = deadline->tv_sec + (timeoutMs / 1000);
+	deadline->tv_nsec = deadline->tv_nsec + ((long)(timeoutMs % 1000) * 1000000L);
+
+	// Carry whole seconds out of the nanoseconds
+	if(deadline->tv_nsec >= 1000000000L){
+		deadline->tv_sec = deadline->tv_sec + 1;
+		deadline->tv_nsec = deadline->tv_nsec - 1000000000L;
+	}
+}
+
+/**
+ * This function waits on a condition of the queue. The queue lock must be held.
+ * @param queue This is a pointer to the queue.
+ * @param condition This is a pointer to the condition to wait on.
+ * @param deadline This is a pointer to the time to give up at, or NULL to wait forever.
+ * @return This returns false if the deadline passed, true otherwise.
+ */
+static bool bq_wait(struct boundedQueue* queue, pthread_cond_t* condition, const struct timespec* deadline){
+	bool signalled = true;
+
+	if(deadline == NULL){
+		pthread_cond_wait(condition, &queue->lock);
+	}
+	else{
+		signalled = (pthread_cond_timedwait(condition, &queue->lock, deadline) == 0);
+	}
+
+	return signalled;
+}
+
+/**
+ * This function adds a copy of an object to the end of the queue.
+ * @param queue This is a pointer to the queue to add to.
+ * @param object This is a pointer to the object to be added to the queue.
+ * @param size This is the size of the object being added in bytes.
+ * @param deadline This is a pointer to the time to give up at, or NULL to wait forever.
+ * @param wait This is false to fail right away if the queue is full.
+ * @return This returns true if the object was added, false otherwise.
+ */
+static bool bq_put(struct boundedQueue* queue, const void* object, ll_size_t size, const struct timespec* deadline, bool wait){
+	bool completed = false;
+	struct linkedList pending;
+
+	// Build the node before taking the lock to keep the time spent holding it short
+	ll_init(&pending);
+
+	if((queue != NULL) && ll_add(&pending, object, size)){
+		bool waiting = true;
+
+		pthread_mutex_lock(&queue->lock);
+
+		// Wait for space as long as the queue is open and the caller allows waiting
+		while(!queue->closed && (queue->list.size >= queue->capacity) && waiting){
+			waiting = wait && bq_wait(queue, &queue->notFull, deadline);
+		}
+
+		if(!queue->closed && (queue->list.size < queue->capacity)){
+			ll_transfer(&queue->list, &pending, 1);
+			pthread_cond_signal(&queue->notEmpty);
+			completed = true;
+		}
+
+		pthread_mutex_unlock(&queue->lock);
+	}
+
+	// Free the node if it could not be added
+	ll_clear(&pending);
+
+	return completed;
+}
+
+/**
+ * This function waits until the queue has an element or is closed. The queue lock must be held.
+ * @param queue This is a pointer to the queue.
+ * @param deadline This is a pointer to the time to give up at, or NULL to wait forever.
+ * @param wait This is false to return right away if the queue is empty.
+ * @return This returns true if the queue has an element.
+ */
+static bool bq_waitForElement(struct boundedQueue* queue, const struct timespec* deadline, bool wait){
+	bool waiting = wait;
+
+	while(!queue->closed && (queue->list.size == 0) && waiting){
+		waiting = bq_wait(queue, &queue->notEmpty, deadline);
+	}
+
+	return queue->list.size != 0;
+}
+
+/**
+ * This function removes the first element of the queue.
+ * @param queue This is a pointer to the queue to remove from.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @param deadline This is a pointer to the time to give up at, or NULL to wait forever.
+ * @param wait This is false to return right away if the queue is empty.
+ * @return This returns a pointer to the data, or NULL if there was no element.
+ */
+static void* bq_take(struct boundedQueue* queue, ll_size_t* size, const struct timespec* deadline, bool wait){
+	void* data = NULL;
+
+	// Checks if the queue parameter is NULL to avoid a null pointer dereference
+	if(queue != NULL){
+		pthread_mutex_lock(&queue->lock);
+
+		if(bq_waitForElement(queue, deadline, wait)){
+			data = ll_popFront(&queue->list, size);
+			pthread_cond_signal(&queue->notFull);
+		}
+
+		pthread_mutex_unlock(&queue->lock);
+	}
+
+	return data;
+}
+
+/**
+ * This function initializes a bounded queue.
+ * @param queue This is a pointer to the queue to initialize.
+ * @param capacity This is the maximum number of elements the queue holds, must not be 0.
+ * @return This returns true if the queue was initialized, false if it failed.
+ */
+bool bq_init(struct boundedQueue* queue, uint32_t capacity){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((queue != NULL) && (capacity != 0)){
+		pthread_condattr_t attributes;
+
+		ll_init(&queue->list);
+		queue->capacity = capacity;
+		queue->closed = false;
+		pthread_mutex_init(&queue->lock, NULL);
+
+		// Timed waits use the monotonic clock so changing the system time does not affect them
+		pthread_condattr_init(&attributes);
+		pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+		pthread_cond_init(&queue->notEmpty, &attributes);
+		pthread_cond_init(&queue->notFull, &attributes);
+		pthread_condattr_destroy(&attributes);
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function frees every element still in the queue and the resources of the queue.
+ * @param queue This is a pointer to the queue to destroy.
+ */
+void bq_destroy(struct boundedQueue* queue){
+	// Checks if the queue parameter is NULL to avoid a null pointer dereference
+	if(queue != NULL){
+		ll_clear(&queue->list);
+		pthread_cond_destroy(&queue->notFull);
+		pthread_cond_destroy(&queue->notEmpty);
+		pthread_mutex_destroy(&queue->lock);
+	}
+}
+
+/**
+ * This function closes a queue.
+ * @param queue This is a pointer to the queue to close.
+ */
+void bq_close(struct boundedQueue* queue){
+	// Checks if the queue parameter is NULL to avoid a null pointer dereference
+	if(queue != NULL){
+		pthread_mutex_lock(&queue->lock);
+		queue->closed = true;
+		pthread_cond_broadcast(&queue->notEmpty);
+		pthread_cond_broadcast(&queue->notFull);
+		pthread_mutex_unlock(&queue->lock);
+	}
+}
+
+/**
+ * This function adds a copy of an object to the end of the queue, waiting while it is full.
+ * @param queue This is a pointer to the queue to add to.
+ * @param object This is a pointer to the object to be added to the queue.
+ * @param size This is the size of the object being added in bytes.
+ * @return This returns true if the object was added, false if it failed or the queue is closed.
+ */
+bool bq_enqueue(struct boundedQueue* queue, const void* object, ll_size_t size){
+	return bq_put(queue, object, size, NULL, true);
+}
+
+/**
+ * This function adds a copy of an object to the end of the queue, waiting at most a given time
+ * while it is full.
+ * @param queue This is a pointer to the queue to add to.
+ * @param object This is a pointer to the object to be added to the queue.
+ * @param size This is the size of the object being added in bytes.
+ * @param timeoutMs This is the longest time to wait in milliseconds, 0 to not wait at all.
+ * @return This returns true if the object was added, false if it failed, timed out or the
+ *         queue is closed.
+ */
+bool bq_timedEnqueue(struct boundedQueue* queue, const void* object, ll_size_t size, uint32_t timeoutMs){
+	struct timespec deadline;
+
+	bq_deadline(&deadline, timeoutMs);
+
+	return bq_put(queue, object, size, &deadline, timeoutMs != 0);
+}
+
+/**
+ * This function removes the first element of the queue, waiting while it is empty.
+ * @param queue This is a pointer to the queue to remove from.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data, which the caller must free, or NULL if the queue
+ *         is closed and empty.
+ */
+void* bq_dequeue(struct boundedQueue* queue, ll_size_t* size){
+	return bq_take(queue, size, NULL, true);
+}
+
+/**
+ * This function removes the first element of the queue, waiting at most a given time while it
+ * is empty.
+ * @param queue This is a pointer to the queue to remove from.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @param timeoutMs This is the longest time to wait in milliseconds, 0 to not wait at all.
+ * @return This returns a pointer to the data, which the caller must free, or NULL if the wait
+ *         timed out or the queue is closed and empty.
+ */
+void* bq_timedDequeue(struct boundedQueue* queue, ll_size_t* size, uint32_t timeoutMs){
+	struct timespec deadline;
+
+	bq_deadline(&deadline, timeoutMs);
+
+	return bq_take(queue, size, &deadline, timeoutMs != 0);
+}
+
+/**
+ * This function moves up to a given number of elements from the front of the queue to the end
+ * of a list, taking the lock only once.
+ * @param queue This is a pointer to the queue to remove from.
+ * @param list This is a pointer to the list that receives the elements.
+ * @param max This is the maximum number of elements to move.
+ * @return This returns the number of elements moved, 0 if the queue is closed and empty.
+ */
+uint32_t bq_dequeueBatch(struct boundedQueue* queue, struct linkedList* list, uint32_t max){
+	uint32_t moved = 0;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((queue != NULL) && (list != NULL) && (max != 0)){
+		pthread_mutex_lock(&queue->lock);
+
+		if(bq_waitForElement(queue, NULL, true)){
+			moved = ll_transfer(list, &queue->list, max);
+
+			// Every slot freed can let a blocked producer continue
+			if(moved > 1){
+				pthread_cond_broadcast(&queue->notFull);
+			}
+			else{
+				pthread_cond_signal(&queue->notFull);
+			}
+		}
+
+		pthread_mutex_unlock(&queue->lock);
+	}
+
+	return moved;
+}
+
+/**
+ * This function returns the number of elements in the queue.
+ * @param queue This is a pointer to the queue.
+ * @return This returns the number of elements in the queue.
+ */
+uint32_t bq_size(struct boundedQueue* queue){
+	uint32_t num = 0;
+
+	// Checks if the queue parameter is NULL to avoid a null pointer dereference
+	if(queue != NULL){
+		pthread_mutex_lock(&queue->lock);
+		num = queue->list.size;
+		pthread_mutex_unlock(&queue->lock);
+	}
+
+	return num;
+}
@@ -0,0 +1,110 @@
+/**
+ * This file contains the interface for the bounded queue. The bounded queue is a thread safe
+ * first in, first out buffer built on the linked list that blocks producers while it is full
+ * and consumers while it is empty.
+ * @file boundedqueue.h
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#ifndef BOUNDEDQUEUE_H
+#define BOUNDEDQUEUE_H
+
+#include "linkedlist.h"
+
+#include <pthread.h>
+
+/**
+ * This structure is a bounded queue that can be shared between producer and consumer threads.
+ */
+struct boundedQueue
+{
+  struct linkedList list; // The elements waiting in the queue
+  uint32_t capacity; // The maximum number of elements the queue holds
+  bool closed; // True once the queue has been closed
+  pthread_mutex_t lock; // Protects every other element of the structure
+  pthread_cond_t notEmpty; // Signalled when an element is enqueued or the queue is closed
+  pthread_cond_t notFull; // Signalled when an element is dequeued or the queue is closed
+};
+
+/**
+ * This function initializes a bounded queue.
+ * @param queue This is a pointer to the queue to initialize.
+ * @param capacity This is the maximum number of elements the queue holds, must not be 0.
+ * @return This returns true if the queue was initialized, false if it failed.
+ */
+bool bq_init(struct boundedQueue* queue, uint32_t capacity);
+
+/**
+ * This function frees every element still in the queue and the resources of the queue. No
+ * thread may use the queue while or after it is destroyed.
+ * @param queue This is a pointer to the queue to destroy.
+ */
+void bq_destroy(struct boundedQueue* queue);
+
+/**
+ * This function closes a queue. Blocked producers and consumers wake up, further enqueues fail
+ * and consumers can still drain the elements that are left.
+ * @param queue This is a pointer to the queue to close.
+ */
+void bq_close(struct boundedQueue* queue);
+
+/**
+ * This function adds a copy of an object to the end of the queue, waiting while it is full.
+ * @param queue This is a pointer to the queue to add to.
+ * @param object This is a pointer to the object to be added to the queue.
+ * @param size This is the size of the object being added in bytes.
+ * @return This returns true if the object was added, false if it failed or the queue is closed.
+ */
+bool bq_enqueue(struct boundedQueue* queue, const void* object, ll_size_t size);
+
+/**
+ * This function adds a copy of an object to the end of the queue, waiting at most a given time
+ * while it is full.
+ * @param queue This is a pointer to the queue to add to.
+ * @param object This is a pointer to the object to be added to the queue.
+ * @param size This is the size of the object being added in bytes.
+ * @param timeoutMs This is the longest time to wait in milliseconds, 0 to not wait at all.
+ * @return This returns true if the object was added, false if it failed, timed out or the
+ *         queue is closed.
+ */
+bool bq_timedEnqueue(struct boundedQueue* queue, const void* object, ll_size_t size, uint32_t timeoutMs);
+
+/**
+ * This function removes the first element of the queue, waiting while it is empty.
+ * @param queue This is a pointer to the queue to remove from.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data, which the caller must free, or NULL if the queue
+ *         is closed and empty.
+ */
+void* bq_dequeue(struct boundedQueue* queue, ll_size_t* size);
+
+/**
+ * This function removes the first element of the queue, waiting at most a given time while it
+ * is empty.
+ * @param queue This is a pointer to the queue to remove from.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @param timeoutMs This is the longest time to wait in milliseconds, 0 to not wait at all.
+ * @return This returns a pointer to the data, which the caller must free, or NULL if the wait
+ *         timed out or the queue is closed and empty.
+ */
+void* bq_timedDequeue(struct boundedQueue* queue, ll_size_t* size, uint32_t timeoutMs);
+
+/**
+ * This function moves up to a given number of elements from the front of the queue to the end
+ * of a list, taking the lock only once. It waits while the queue is empty.
+ * @param queue This is a pointer to the queue to remove from.
+ * @param list This is a pointer to the list that receives the elements.
+ * @param max This is the maximum number of elements to move.
+ * @return This returns the number of elements moved, 0 if the queue is closed and empty.
+ */
+uint32_t bq_dequeueBatch(struct boundedQueue* queue, struct linkedList* list, uint32_t max);
+
+/**
+ * This function returns the number of elements in the queue.
+ * @param queue This is a pointer to the queue.
+ * @return This returns the number of elements in the queue.
+ */
+uint32_t bq_size(struct boundedQueue* queue);
+
+#endif /*BOUNDEDQUEUE_H*/
@@ -1,332 +1,3861 @@
-/**
- * This file contains the implementation of the linked list functions
- * using the structures defined in the header file.
- * @file linkedlist.c
- * @author Max Kallenberger
- * @date September 17, 2017
- */
-
-#include "linkedlist.h"
-
-/**
- * This function initializes the elements in the linkedList structure to default values.
- * @param list This is a pointer to the list to initialize.
- */
-void ll_init(struct linkedList* list){
-	// Checks if the list parameter is NULL to avoid a null pointer dereference
-	if(list != NULL){
-		// Initializes the list values
-		list->head = NULL;
-		list->tail = NULL;
-		list->size = 0;
-	}
-}
-
-/**
- * This function adds an element to the linked list at the end of the list.
- * @param list This is a pointer to the list to add to.
- * @param object This is a pointer to the object to be added to the list.
- * @param size This is the size of the object being added in bytes.
- * @return This returns true if the add was successful, false if it failed.
- */
-bool ll_add(struct linkedList* list, const void* object, uint32_t size){
-	bool completed = false;
-
-	// Checks all parameters for valid values to avoid null pointer dereferences
-	if((list != NULL) && (object != NULL) && (size != 0)){
-		// Allocate space in memory for the new node and data
-		struct listNode* node = (struct listNode*)malloc(sizeof(struct listNode));
-		node->data = (void*)malloc(size);
-
-		// Copy the data from the object to the node
-		memcpy(node->data, object, size);
-
-		// Set the node structure elements
-		node->dataSize = size;
-		node->nextNode = NULL;
-		node->prevNode = list->tail;
-
-		// Check if the list tail is null to avoid a null pointer dereference
-		if(list->tail != NULL){
-			// Point the old tails next node to the new node
-			list->tail->nextNode = node;
-		}
-
-		// The new tail is the new node
-		list->tail = node;
-
-		// If the list was empty, the new node is the head
-		if(list->size == 0){
-			list->head = node;
-		}
-
-		// Increase the list size to accurately represent the number of nodes contained in the list
-		list->size = (list->size) + 1;
-
-
-		completed = true;
-	}
-
-	return completed;
-}
-
-/**
- * This function adds an element to the linked list at the desired index.
- * @param list This is a pointer to the list to add to.
- * @param object This is a pointer to the object to be added to the list.
- * @param size This is the size of the object being added in bytes.
- * @param index This is the index to add the object at.
- * @return This returns true if the add was successful, false if it failed.
- */
-bool ll_addIndex(struct linkedList* list, const void* object, uint32_t size, uint32_t index){
-	bool completed = false;
-
-	// Check the parameters for valid values to avoid null pointer dereferencing and index out of bounds errors
-	if((list != NULL) && (object != NULL) && (size != 0) && (index >= 0) && (index < list->size)){
-		// Allocate space in memory for the new node and data
-		struct listNode* node = (struct listNode*)malloc(sizeof(struct listNode));
-		node->data = malloc(size);
-
-		// Copy the data from the object to the node
-		memcpy(node->data, object, size);
-
-		node->dataSize = size;
-
-		// Iterate to the index where the new node is to be added
-		struct linkedListIterator* iter = ll_getIterator(list);
-		for(int i = 0; i < index; i++){
-			ll_next(iter);
-		}
-
-		// Set the new node to point to the old node at this index next
-		node->nextNode = iter->current;
-		// Set the new node to point to the node in the index before this
-		node->prevNode = iter->current->prevNode;
-
-		// Check if previous node is not NULL to avoid null pointer dereferencing
-		if(node->prevNode != NULL){
-			// Set the node in the index before this to point to the new node next
-			node->prevNode->nextNode = node;
-		}
-
-		// Set the node that held this index before to point back at the new node
-		iter->current->prevNode = node;
-
-		// If the new node is inserted at the first index it is the head
-		if(index == 0){
-			list->head = node;
-		}
-
-		// Increase the list size to accurately represent the number of nodes contained in the list
-		list->size = list->size + 1;
-
-		// Free the iterator to avoid a memory leak
-		free(iter);
-
-		completed = true;
-	}
-	// If the index to add at is the last index, run the simple add function to avoid redundant code
-	else if((list != NULL) && (index == list->size)){
-		completed = ll_add(list, object, size);
-	}
-
-	return completed;
-}
-
-/**
- * This function removes an object from the list at a given index.
- * @param list This is a pointer to the list to remove from.
- * @param index This is the index to remove the object from.
- * @return This returns true if the remove was successful, false if it failed.
- */
-bool ll_remove(struct linkedList* list, uint32_t index){
-	bool completed = false;
-
-	// Check if the parameters are valid to avoid null pointer dereferencing and index out of bounds errors
-	if((list != NULL) && (index >= 0) && (index < list->size)){
-
-		// Iterate to the node to be removed
-		struct linkedListIterator* iter = ll_getIterator(list);
-		for(int i = 0; i < index; i++){
-			ll_next(iter);
-		}
-
-		// Check if the next node is NULL to avoid a null pointer dereference
-		if(iter->current->nextNode != NULL){
-			iter->current->nextNode->prevNode = iter->current->prevNode;
-		}
-
-		// Check if the previous node is NULL to avoid a null pointer dereference
-		if(iter->current->prevNode != NULL){
-			iter->current->prevNode->nextNode = iter->current->nextNode;
-		}
-
-		// Check if the head was removed
-		if(index == 0){
-			// Set the next node to the head
-			list->head = iter->current->nextNode;
-		}
-
-		// Check if the tail was removed
-		else if(index == (list->size - 1)){
-			// Set the previous node to the tail
-			list->tail = iter->current->prevNode;
-		}
-
-		// Free the node and its data to avoid memory leaks
-		free(iter->current->data);
-		free(iter->current);
-
-		// Free the iterator to avoid memory leaks
-		free(iter);
-
-		// Decrease the list size to accurately represent the number of nodes contained in the list
-		list->size = list->size - 1;
-
-		// If the list is empty, reinitialize it to restore default values
-		if(list->size == 0){
-			ll_init(list);
-		}
-
-		completed = true;
-	}
-
-	return completed;
-}
-
-/**
- * This function gets the object from the desired list index.
- * @param list This is a pointer to the list to get the object from.
- * @param index This is the index to get the object from.
- */
-void* ll_get(struct linkedList* list, uint32_t index){
-	void* result = NULL;
-
-	// Check if the parameters are valid values to avoid null pointer dereferences and index out of bounds errors
-	if((list != NULL) && (index >= 0) && (index < list->size)){
-
-		// Iterate to the node to retrieve data from
-		struct linkedListIterator* iter = ll_getIterator(list);
-		for(int i = 0; i < index; i++){
-			ll_next(iter);
-		}
-
-		// Set the output to point at the data in the node
-		result = iter->current->data;
-
-		// Free the iterator to avoid memory leaks
-		free(iter);
-	}
-
-	return result;
-}
-
-/**
- * This function frees the memory allocated for the nodes and data of objects in the list.
- * The elements of the linkedList structure are reinitialized to their default values.
- * @param list This is a pointer to the list to be cleared.
- */
-void ll_clear(struct linkedList* list){
-	// Check if list is NULL to avoid null pointer dereferencing
-	if(list != NULL){
-
-		struct linkedListIterator* iter = ll_getIterator(list);
-
-		// Iterate through the list to make sure all nodes are cleared
-		while(ll_hasNext(iter)){
-			struct listNode* temp = iter->current;
-
-			// Move to the next node to clear
-			ll_next(iter);
-
-			// Free the current node and the data in it to avoid memory leaks
-			free(temp->data);
-			free(temp);
-		}
-
-		// Free the iterator to avoid memory leaks
-		free(iter);
-
-		// Initialize the list to return to default values
-		ll_init(list);
-	}
-}
-
-/**
- * This function returns the size element of the linked list structure.
- * @param list This is a pointer to the list to return the size of.
- * @return This returns the size of the list (the number of objects contained in the list).
- */
-uint32_t ll_size(struct linkedList* list){
-	uint32_t num = 0;
-
-	// Check if list is NUll to avoid null pointer dereferencing
-	if(list != NULL){
-		// Set the output to the size of the list
-		num = list->size;
-	}
-
-	return num;
-}
-
-/**
- * This function creates an iterator for a given linked list. The iterator starts at the head of the list.
- * @param list This is a pointer to the list used to create the iterator.
- * @return This returns a pointer to the linkedListIterator structure if the iterator generated correctly,
- * 	       else it returns NULL.
- */
-struct linkedListIterator* ll_getIterator(struct linkedList* list){
-	struct linkedListIterator* iterator = NULL;
-
-	// Checks if the list is NUll to avoid null pointer dereferencing
-	if(list != NULL){
-		// Allocate space in memory for the iterator
-		iterator = (struct linkedListIterator*) malloc(sizeof(struct linkedListIterator));
-
-		// Start the iterator at the head of the list
-		iterator->current = list->head;
-	}
-	return iterator;
-}
-
-/**
- * This function determines if an iterator has another element or more data to retrieve.
- * @param iter This is a pointer to the iterator check.
- * @return This returns true if there is another element or more data has not been retrieved,
- * 		   else it returns false.
- */
-bool ll_hasNext(struct linkedListIterator* iter){
-	bool hasNext = false;
-
-	// Checks if the iterator is NUll to avoid null pointer dereferencing
-	if(iter != NULL){
-		// Checks if the current node of the iterator is NUll to tell if there is still data
-		// to access with the next method
-		if(iter->current != NULL){
-				hasNext = true;
-		}
-	}
-	return hasNext;
-}
-
-/**
- * This function gets the data stored in the current node of the iterator and iterates to
- * the next node in the list.
- * @param iter This is a pointer to the iterator to access the data of and iterate.
- */
-void* ll_next(struct linkedListIterator* iter){
-	void* data = NULL;
-
-	// Checks if the iterator is NUll to avoid null pointer dereferencing
-	if(iter != NULL){
-		// Checks if the current node of the iterator is NUll to avoid null pointer dereferencing
-		if(iter->current != NULL){
-			// Set the output to point at the data in the current node
-			data = iter->current->data;
-			// Iterate to the next node
-			iter->current = iter->current->nextNode;
-		}
-	}
-
-	return data;
-}
+/**
+ * This file contains the implementation of the linked list functions
+ * using the structures defined in the header file.
+ * @file linkedlist.c
+ * @author Max Kallenberger
+ * @date September 17, 2017
+ */
+
+// This file defines the out-of-line versions of the inline fast path functions
+#define LL_IMPLEMENTATION
+
+#include "linkedlist.h"
+#include "nodepool.h"
+#include "llcodec.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+/**
+ * The number of retired nodes a writer collects before it waits for a grace period and frees them.
+ */
+#define LL_RCU_RETIRE_BATCH 64
+
+/**
+ * The number of node slots in the block a small list takes its nodes from. A list that grows
+ * past this takes further nodes from the node pool, and reuses the slots as it shrinks again.
+ * It may be set when building, up to 31, and 0 takes every node from the node pool.
+ */
+#ifndef LL_SMALL_LIST_NODES
+#define LL_SMALL_LIST_NODES 16
+#endif
+
+/**
+ * The bit in the state of a small node block that is set while a list still takes nodes from it.
+ */
+#define LL_SMALL_LIST_OWNED (1u << LL_SMALL_LIST_NODES)
+
+/**
+ * This structure is a block of node slots allocated in one go. Nodes may move to other lists
+ * and be freed on other threads, so the block is freed once its list has let go of it and
+ * every slot is free again.
+ */
+struct smallNodeBlock {
+	uint32_t state; // One bit per slot in use, plus LL_SMALL_LIST_OWNED while a list uses the block
+	struct listNode nodes[LL_SMALL_LIST_NODES]; // The node slots
+};
+
+/**
+ * The most elements ll_fromArray stores in one block together with their data, one for every
+ * bit of the state of the block.
+ */
+#define LL_ARRAY_BLOCK_NODES 32
+
+/**
+ * The bytes of data after which ll_fromArray starts a new block. An element larger than this
+ * gets a block of its own.
+ */
+#define LL_ARRAY_BLOCK_BYTES 16384
+
+/**
+ * This structure is a block of nodes allocated in one go by ll_fromArray, with the data of the
+ * nodes stored behind the node slots. Like a small node block it is freed once every slot is
+ * free again, wherever its nodes have moved.
+ */
+struct arrayNodeBlock {
+	uint32_t state; // One bit per slot in use
+	struct listNode nodes[]; // The node slots, followed by the data of the nodes
+};
+
+/**
+ * This structure holds the memory charged by one thread. Every thread adds its charges to its
+ * own counters, so writers on different threads never contend for a cache line, and
+ * ll_processMemoryUsage adds the counters of every thread together.
+ */
+struct usageShard {
+	struct memoryUsage usage; // The memory charged by the thread, which may be negative per counter
+	bool registered; // True once the shard is on the list of shards
+	struct usageShard* next; // The next shard on the list of shards
+};
+
+static pthread_mutex_t usageLock = PTHREAD_MUTEX_INITIALIZER; // Protects the list of shards and exitedUsage
+static struct usageShard* usageShards = NULL; // The shards of the running threads that charged memory
+static struct memoryUsage exitedUsage; // The memory charged by threads that have exited
+static __thread struct usageShard usageShard; // The shard of the calling thread
+static pthread_once_t usageKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t usageKey; // Folds the shard of a thread into exitedUsage when it exits
+
+/**
+ * This function folds the shard of an exiting thread into the charges of exited threads.
+ * @param argument This is a pointer to the shard of the thread.
+ */
+static void ll_usageThreadExit(void* argument){
+	struct usageShard* exiting = (struct usageShard*)argument;
+	struct usageShard** link = &usageShards;
+
+	pthread_mutex_lock(&usageLock);
+	while(*link != exiting){
+		link = &(*link)->next;
+	}
+	*link = exiting->next;
+
+	exitedUsage.payloadBytes = exitedUsage.payloadBytes + exiting->usage.payloadBytes;
+	exitedUsage.nodeBytes = exitedUsage.nodeBytes + exiting->usage.nodeBytes;
+	exitedUsage.indexBytes = exitedUsage.indexBytes + exiting->usage.indexBytes;
+	exitedUsage.borrowedBytes = exitedUsage.borrowedBytes + exiting->usage.borrowedBytes;
+	exitedUsage.allocatedBytes = exitedUsage.allocatedBytes + exiting->usage.allocatedBytes;
+	pthread_mutex_unlock(&usageLock);
+
+	exiting->registered = false;
+}
+
+/**
+ * This function creates the thread specific key used to fold the shards of exiting threads.
+ */
+static void ll_createUsageKey(void){
+	pthread_key_create(&usageKey, ll_usageThreadExit);
+}
+
+/**
+ * This function returns the shard of the calling thread, registering it on first use.
+ * @return This returns a pointer to the shard.
+ */
+static struct usageShard* ll_usageShard(void){
+	if(!usageShard.registered){
+		pthread_once(&usageKeyOnce, ll_createUsageKey);
+
+		pthread_mutex_lock(&usageLock);
+		usageShard.next = usageShards;
+		usageShards = &usageShard;
+		pthread_mutex_unlock(&usageLock);
+
+		usageShard.registered = true;
+		pthread_setspecific(usageKey, &usageShard);
+	}
+
+	return &usageShard;
+}
+
+/**
+ * This function adds to or takes from one memory counter of a list and the matching counter of
+ * the calling thread. Each counter is only changed by one thread, the writer of the list or the
+ * owner of the shard, so both are updated without a read-modify-write.
+ * @param counter This is a pointer to the counter of the list.
+ * @param total This is a pointer to the counter of the thread.
+ * @param amount This is the number of bytes.
+ * @param add This is true to add the bytes, false to take them away.
+ */
+static void ll_chargeCounter(uint64_t* counter, uint64_t* total, uint64_t amount, bool add){
+	if(amount != 0){
+		uint64_t change = add ? amount : (0 - amount);
+
+		__atomic_store_n(counter, *counter + change, __ATOMIC_RELAXED);
+		__atomic_store_n(total, *total + change, __ATOMIC_RELAXED);
+	}
+}
+
+/**
+ * This function adds memory to or takes it away from counters of a list and the calling thread.
+ * @param usage This is a pointer to the counters of the list.
+ * @param delta This is a pointer to the memory to add or take away.
+ * @param add This is true to add the memory, false to take it away.
+ */
+static void ll_charge(struct memoryUsage* usage, const struct memoryUsage* delta, bool add){
+	struct memoryUsage* thread = &ll_usageShard()->usage;
+
+	ll_chargeCounter(&usage->payloadBytes, &thread->payloadBytes, delta->payloadBytes, add);
+	ll_chargeCounter(&usage->nodeBytes, &thread->nodeBytes, delta->nodeBytes, add);
+	ll_chargeCounter(&usage->indexBytes, &thread->indexBytes, delta->indexBytes, add);
+	ll_chargeCounter(&usage->borrowedBytes, &thread->borrowedBytes, delta->borrowedBytes, add);
+	ll_chargeCounter(&usage->allocatedBytes, &thread->allocatedBytes, delta->allocatedBytes, add);
+}
+
+/**
+ * This function takes everything charged to counters of a list away again.
+ * @param usage This is a pointer to the counters of the list.
+ */
+static void ll_dropCharges(struct memoryUsage* usage){
+	struct memoryUsage delta = *usage;
+
+	ll_charge(usage, &delta, false);
+}
+
+/**
+ * This function charges a list for a block of bookkeeping memory, or takes the charge back
+ * before the block is freed.
+ * @param list This is a pointer to the list.
+ * @param block This is a pointer to the block, allocated with malloc.
+ * @param slotBytes This is the part of the block charged by the nodes stored in it.
+ * @param add This is true to charge the block, false to take the charge back.
+ */
+static void ll_chargeIndex(struct linkedList* list, void* block, size_t slotBytes, bool add){
+	struct memoryUsage delta = {0};
+
+	delta.allocatedBytes = malloc_usable_size(block);
+	delta.indexBytes = delta.allocatedBytes - slotBytes;
+	ll_charge(&list->indexUsage, &delta, add);
+}
+
+/**
+ * This function adds the memory of a node and the data only it uses to a total. Small and
+ * pooled nodes are carved out of larger allocations charged elsewhere, shared data is
+ * charged when it enters the interning table and packed data along with its cold segment.
+ * @param node This is a pointer to the node.
+ * @param total This is a pointer to the total to add to.
+ */
+static void ll_nodeCharge(struct listNode* node, struct memoryUsage* total){
+	total->nodeBytes = total->nodeBytes + sizeof(struct listNode);
+
+	if((node->flags & LL_NODE_POOLED) != 0){
+		total->allocatedBytes = total->allocatedBytes + sizeof(struct listNode);
+	}
+	else if((node->flags & LL_NODE_ARRAY) != 0){
+		// The slot of the data stays in the block whatever the element holds now
+		total->allocatedBytes = total->allocatedBytes + sizeof(struct listNode) + node->dataSize;
+	}
+	else if((node->flags & LL_NODE_SMALL) == 0){
+		total->allocatedBytes = total->allocatedBytes + malloc_usable_size(node);
+	}
+
+	switch(node->flags & LL_PAYLOAD_MASK){
+		case LL_PAYLOAD_COPY:
+			total->payloadBytes = total->payloadBytes + node->dataSize;
+			total->allocatedBytes = total->allocatedBytes + malloc_usable_size(node->data);
+			break;
+		case LL_PAYLOAD_OWNED:
+			total->payloadBytes = total->payloadBytes + node->dataSize;
+			total->allocatedBytes = total->allocatedBytes + node->dataSize;
+			break;
+		case LL_PAYLOAD_BORROWED:
+			total->borrowedBytes = total->borrowedBytes + node->dataSize;
+			break;
+		case LL_PAYLOAD_INLINE:
+			// The data was allocated along with the node
+			total->payloadBytes = total->payloadBytes + node->dataSize;
+			break;
+		default:
+			// Shared and compressed data are charged by the interning table and the cold segment
+			break;
+	}
+}
+
+/**
+ * This function charges a list for a node, or takes the charge back.
+ * @param list This is a pointer to the list.
+ * @param node This is a pointer to the node.
+ * @param add This is true to charge the node, false to take the charge back.
+ */
+static void ll_chargeNode(struct linkedList* list, struct listNode* node, bool add){
+	struct memoryUsage delta = {0};
+
+	ll_nodeCharge(node, &delta);
+	ll_charge(&list->nodeUsage, &delta, add);
+}
+
+/**
+ * This function allocates a node for a list. A list with more than one element takes its
+ * nodes from a contiguous block while the block has free slots, which saves an allocation per
+ * element and keeps small lists together in memory.
+ * @param list This is a pointer to the list the node is for.
+ * @return This returns a pointer to the new node with its memory flags set.
+ */
+static struct listNode* ll_allocNode(struct linkedList* list){
+	struct listNode* node = NULL;
+
+	// A single element does not pay for a block, so lists passing through one node stay cheap
+	if((LL_SMALL_LIST_NODES != 0) && (list->smallNodes == NULL) && (list->size == 1)){
+		list->smallNodes = (struct smallNodeBlock*)malloc(sizeof(struct smallNodeBlock));
+		list->smallNodes->state = LL_SMALL_LIST_OWNED;
+		ll_chargeIndex(list, list->smallNodes, sizeof(list->smallNodes->nodes), true);
+	}
+
+	if(list->smallNodes != NULL){
+		uint32_t available = ~__atomic_load_n(&list->smallNodes->state, __ATOMIC_ACQUIRE) & (LL_SMALL_LIST_OWNED - 1);
+
+		// Only this list sets bits in the block, so a slot seen free stays free until claimed
+		if(available != 0){
+			uint32_t slot = (uint32_t)__builtin_ctz(available);
+
+			__atomic_fetch_or(&list->smallNodes->state, 1u << slot, __ATOMIC_ACQ_REL);
+			node = &list->smallNodes->nodes[slot];
+			node->flags = LL_NODE_SMALL | (slot << LL_NODE_SLOT_SHIFT);
+		}
+	}
+
+	if(node == NULL){
+		node = (struct listNode*)np_alloc();
+		node->flags = LL_NODE_POOLED;
+	}
+
+	return node;
+}
+
+/**
+ * This function frees the memory of a node, handing a small or array node back to its block
+ * and a pooled node back to the node pool.
+ * @param node This is a pointer to the node to free.
+ */
+static void ll_deallocNode(struct listNode* node){
+	if((node->flags & LL_NODE_SMALL) != 0){
+		uint32_t slot = (node->flags & (LL_NODE_EXPANDING - 1u)) >> LL_NODE_SLOT_SHIFT;
+		struct smallNodeBlock* block = (struct smallNodeBlock*)((char*)(node - slot) - offsetof(struct smallNodeBlock, nodes));
+
+		if(__atomic_and_fetch(&block->state, ~(1u << slot), __ATOMIC_ACQ_REL) == 0){
+			free(block);
+		}
+	}
+	else if((node->flags & LL_NODE_ARRAY) != 0){
+		uint32_t slot = (node->flags & (LL_NODE_EXPANDING - 1u)) >> LL_NODE_SLOT_SHIFT;
+		struct arrayNodeBlock* block = (struct arrayNodeBlock*)((char*)(node - slot) - offsetof(struct arrayNodeBlock, nodes));
+
+		if(__atomic_and_fetch(&block->state, ~(1u << slot), __ATOMIC_ACQ_REL) == 0){
+			free(block);
+		}
+	}
+	else if((node->flags & LL_NODE_POOLED) != 0){
+		np_free(node);
+	}
+	else{
+		free(node);
+	}
+}
+
+/**
+ * This function lets go of the small node block of a list once the list is empty. Nodes that
+ * were moved to other lists keep the block alive until they are freed.
+ * @param list This is a pointer to the list.
+ */
+static void ll_dropSmallNodes(struct linkedList* list){
+	struct smallNodeBlock* block = list->smallNodes;
+
+	if(block != NULL){
+		ll_chargeIndex(list, block, sizeof(block->nodes), false);
+		list->smallNodes = NULL;
+
+		if(__atomic_and_fetch(&block->state, ~LL_SMALL_LIST_OWNED, __ATOMIC_ACQ_REL) == 0){
+			free(block);
+		}
+	}
+}
+
+/**
+ * This function allocates a node that stores a pointer to data without copying it. The links
+ * of the node are left empty.
+ * @param list This is a pointer to the list the node is for.
+ * @param data This is a pointer to the data to store.
+ * @param size This is the size of the data in bytes.
+ * @param kind This is the payload kind describing who owns the data.
+ * @return This returns a pointer to the new node.
+ */
+static struct listNode* ll_wrapNode(struct linkedList* list, void* data, ll_size_t size, uint32_t kind){
+	// Allocate space in memory for the new node
+	struct listNode* node = ll_allocNode(list);
+
+	node->data = data;
+	node->dataSize = size;
+	node->flags = node->flags | kind;
+	node->nextNode = NULL;
+	node->prevNode = NULL;
+
+	return node;
+}
+
+/**
+ * This structure is the header in front of a payload shared by an interning list.
+ */
+struct internedPayload {
+	uint64_t hash; // The hash of the data
+	ll_size_t refCount; // The number of elements using the data
+	ll_size_t size; // The size of the data in bytes
+};
+
+/**
+ * This structure is the hash table of an interning list. It uses open addressing with linear
+ * probing, and removed entries are left as tombstones until the table is rebuilt.
+ */
+struct internTable {
+	struct internedPayload** slots; // The payloads, NULL for unused slots
+	uint32_t capacity; // The number of slots, always a power of two
+	uint32_t used; // The number of slots holding a payload or a tombstone
+	struct internStats stats; // The counters reported by ll_internStats
+};
+
+/**
+ * The value stored in a slot whose payload was removed.
+ */
+#define LL_INTERN_TOMBSTONE ((struct internedPayload*)1)
+
+/**
+ * This function hashes data with 64-bit FNV-1a.
+ * @param data This is a pointer to the data.
+ * @param size This is the size of the data in bytes.
+ * @return This returns the hash.
+ */
+static uint64_t ll_hashBytes(const void* data, ll_size_t size){
+	const unsigned char* bytes = (const unsigned char*)data;
+	uint64_t hash = 0xCBF29CE484222325ull;
+
+	for(ll_size_t i = 0; i < size; i++){
+		hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+	}
+
+	return hash;
+}
+
+/**
+ * This function rebuilds the table of an interning list with a given number of slots,
+ * dropping the tombstones.
+ * @param list This is a pointer to the list the table belongs to.
+ * @param capacity This is the new number of slots, a power of two.
+ */
+static void ll_internResize(struct linkedList* list, uint32_t capacity){
+	struct internTable* table = list->interned;
+	struct internedPayload** old = table->slots;
+	uint32_t oldCapacity = table->capacity;
+
+	table->slots = (struct internedPayload**)calloc(capacity, sizeof(struct internedPayload*));
+	ll_chargeIndex(list, table->slots, 0, true);
+	table->capacity = capacity;
+	table->used = 0;
+
+	for(uint32_t i = 0; i < oldCapacity; i++){
+		if((old[i] != NULL) && (old[i] != LL_INTERN_TOMBSTONE)){
+			uint32_t slot = (uint32_t)old[i]->hash & (capacity - 1);
+
+			while(table->slots[slot] != NULL){
+				slot = (slot + 1) & (capacity - 1);
+			}
+			table->slots[slot] = old[i];
+			table->used = table->used + 1;
+		}
+	}
+
+	ll_chargeIndex(list, old, 0, false);
+	free(old);
+}
+
+/**
+ * This function charges an interning list for a shared payload, or takes the charge back
+ * before the payload is freed.
+ * @param list This is a pointer to the interning list.
+ * @param payload This is a pointer to the header of the payload.
+ * @param add This is true to charge the payload, false to take the charge back.
+ */
+static void ll_chargeInterned(struct linkedList* list, struct internedPayload* payload, bool add){
+	struct memoryUsage delta = {0};
+
+	delta.payloadBytes = payload->size;
+	delta.indexBytes = sizeof(struct internedPayload);
+	delta.allocatedBytes = malloc_usable_size(payload);
+	ll_charge(&list->indexUsage, &delta, add);
+}
+
+/**
+ * This function finds or adds the shared copy of an object in the table of an interning list.
+ * @param list This is a pointer to the interning list.
+ * @param object This is a pointer to the object.
+ * @param size This is the size of the object in bytes.
+ * @return This returns a pointer to the shared data, whose reference count now includes the caller.
+ */
+static void* ll_intern(struct linkedList* list, const void* object, ll_size_t size){
+	struct internTable* table = list->interned;
+	uint64_t hash = ll_hashBytes(object, size);
+	struct internedPayload* payload = NULL;
+	uint32_t slot;
+
+	// Keep the table at most three quarters full counting tombstones, and only grow it when more
+	// than half of it holds live payloads, otherwise rebuilding it clears enough tombstones
+	if(((table->used + 1) * 4) > (table->capacity * 3)){
+		ll_internResize(list, (((table->stats.uniquePayloads + 1) * 2) > table->capacity) ? table->capacity * 2 : table->capacity);
+	}
+
+	slot = (uint32_t)hash & (table->capacity - 1);
+	while((table->slots[slot] != NULL) && (payload == NULL)){
+		struct internedPayload* candidate = table->slots[slot];
+
+		if((candidate != LL_INTERN_TOMBSTONE) && (candidate->hash == hash) && (candidate->size == size) &&
+				(memcmp(candidate + 1, object, size) == 0)){
+			payload = candidate;
+		}
+		else{
+			slot = (slot + 1) & (table->capacity - 1);
+		}
+	}
+
+	if(payload == NULL){
+		payload = (struct internedPayload*)malloc(sizeof(struct internedPayload) + size);
+		payload->hash = hash;
+		payload->refCount = 0;
+		payload->size = size;
+		memcpy(payload + 1, object, size);
+
+		table->slots[slot] = payload;
+		table->used = table->used + 1;
+		table->stats.uniquePayloads = table->stats.uniquePayloads + 1;
+		table->stats.storedBytes = table->stats.storedBytes + size;
+		ll_chargeInterned(list, payload, true);
+	}
+
+	payload->refCount = payload->refCount + 1;
+	table->stats.references = table->stats.references + 1;
+	table->stats.logicalBytes = table->stats.logicalBytes + size;
+
+	return payload + 1;
+}
+
+/**
+ * This function drops a reference to shared data and frees it once no element uses it.
+ * @param list This is a pointer to the interning list the data belongs to.
+ * @param data This is a pointer to the shared data.
+ */
+static void ll_releaseInterned(struct linkedList* list, void* data){
+	struct internTable* table = list->interned;
+	struct internedPayload* payload = (struct internedPayload*)data - 1;
+
+	payload->refCount = payload->refCount - 1;
+	table->stats.references = table->stats.references - 1;
+	table->stats.logicalBytes = table->stats.logicalBytes - payload->size;
+
+	if(payload->refCount == 0){
+		uint32_t slot = (uint32_t)payload->hash & (table->capacity - 1);
+
+		while(table->slots[slot] != payload){
+			slot = (slot + 1) & (table->capacity - 1);
+		}
+		table->slots[slot] = LL_INTERN_TOMBSTONE;
+
+		table->stats.uniquePayloads = table->stats.uniquePayloads - 1;
+		table->stats.storedBytes = table->stats.storedBytes - payload->size;
+		ll_chargeInterned(list, payload, false);
+		free(payload);
+	}
+}
+
+/**
+ * This function allocates an empty table for an interning list.
+ * @return This returns a pointer to the new table.
+ */
+static struct internTable* ll_newInternTable(void){
+	struct internTable* table = (struct internTable*)calloc(1, sizeof(struct internTable));
+
+	table->capacity = 16;
+	table->slots = (struct internedPayload**)calloc(16, sizeof(struct internedPayload*));
+
+	return table;
+}
+
+/**
+ * This function frees a table of an interning list together with every payload still in it.
+ * @param table This is a pointer to the table.
+ */
+static void ll_freeInternTable(struct internTable* table){
+	for(uint32_t i = 0; i < table->capacity; i++){
+		if((table->slots[i] != NULL) && (table->slots[i] != LL_INTERN_TOMBSTONE)){
+			free(table->slots[i]);
+		}
+	}
+
+	free(table->slots);
+	free(table);
+}
+
+/**
+ * This function gives a node holding shared data a private copy of it.
+ * @param list This is a pointer to the list holding the node.
+ * @param node This is a pointer to a node whose payload kind is LL_PAYLOAD_INTERNED.
+ */
+static void ll_unshareNode(struct linkedList* list, struct listNode* node){
+	void* copy = malloc(node->dataSize);
+
+	memcpy(copy, node->data, node->dataSize);
+	ll_releaseInterned(list, node->data);
+	ll_chargeNode(list, node, false);
+	node->data = copy;
+	node->flags = (node->flags & ~LL_PAYLOAD_MASK) | LL_PAYLOAD_COPY;
+	ll_chargeNode(list, node, true);
+}
+
+/**
+ * This function moves the copied or inline data of a node that joined an interning list into
+ * the table of the list, so it is shared the way the data of ll_add would be. Owned and
+ * borrowed data stay with the node, as they do when added to an interning list directly.
+ * @param list This is a pointer to the interning list the node belongs to.
+ * @param node This is a pointer to the node.
+ */
+static void ll_shareNode(struct linkedList* list, struct listNode* node){
+	uint32_t kind = node->flags & LL_PAYLOAD_MASK;
+
+	if((kind == LL_PAYLOAD_COPY) || (kind == LL_PAYLOAD_INLINE)){
+		void* shared = ll_intern(list, node->data, node->dataSize);
+
+		ll_chargeNode(list, node, false);
+		// Inline data goes with the node when it is freed
+		if(kind == LL_PAYLOAD_COPY){
+			free(node->data);
+		}
+		node->data = shared;
+		node->flags = (node->flags & ~LL_PAYLOAD_MASK) | LL_PAYLOAD_INTERNED;
+		ll_chargeNode(list, node, true);
+	}
+}
+
+/**
+ * This function allocates a node holding a copy of an object. The links of the node are
+ * left empty.
+ * @param list This is a pointer to the list the node is for.
+ * @param object This is a pointer to the object to copy into the node.
+ * @param size This is the size of the object in bytes.
+ * @return This returns a pointer to the new node.
+ */
+static struct listNode* ll_newNode(struct linkedList* list, const void* object, ll_size_t size){
+	struct listNode* node;
+
+	if(list->interned != NULL){
+		// Share the copy already held for identical data
+		node = ll_wrapNode(list, ll_intern(list, object, size), size, LL_PAYLOAD_INTERNED);
+	}
+	else{
+		// Allocate space in memory for the data and copy the object into it
+		void* data = malloc(size);
+		memcpy(data, object, size);
+
+		node = ll_wrapNode(list, data, size, LL_PAYLOAD_COPY);
+	}
+
+	return node;
+}
+
+/**
+ * This function walks to the node at an index from whichever end of the list is nearer. The
+ * index must be in range.
+ * @param list This is a pointer to the list to walk.
+ * @param index This is the index of the node.
+ * @return This returns a pointer to the node at the index.
+ */
+static struct listNode* ll_nodeAt(struct linkedList* list, ll_size_t index){
+	struct listNode* node;
+
+	if(index < (list->size / 2)){
+		node = list->head;
+		for(ll_size_t i = 0; i < index; i++){
+			node = node->nextNode;
+		}
+	}
+	else{
+		node = list->tail;
+		for(ll_size_t i = list->size - 1; i > index; i--){
+			node = node->prevNode;
+		}
+	}
+
+	return node;
+}
+
+/**
+ * This function links a node into a list. The node is fully set up before the link that makes
+ * it reachable from the head is stored, so concurrent readers never see a half built node.
+ * @param list This is a pointer to the list to link the node into.
+ * @param node This is a pointer to the node to link in.
+ * @param before This is a pointer to the node the new node goes in front of, or NULL to make
+ *               the new node the tail.
+ */
+static void ll_linkNode(struct linkedList* list, struct listNode* node, struct listNode* before){
+	// Set the new node to point at its neighbours
+	node->nextNode = before;
+	node->prevNode = (before != NULL) ? before->prevNode : list->tail;
+
+	// Point the previous node, or the head if there is none, at the new node
+	if(node->prevNode != NULL){
+		__atomic_store_n(&node->prevNode->nextNode, node, __ATOMIC_RELEASE);
+	}
+	else{
+		__atomic_store_n(&list->head, node, __ATOMIC_RELEASE);
+	}
+
+	// Point the next node, or the tail if there is none, back at the new node
+	if(before != NULL){
+		before->prevNode = node;
+	}
+	else{
+		list->tail = node;
+	}
+
+	// Increase the list size to accurately represent the number of nodes contained in the list
+	list->size = list->size + 1;
+	ll_chargeNode(list, node, true);
+}
+
+/**
+ * The most levels a tower of the skip index can take part in.
+ */
+#define LL_SKIP_MAX_LEVELS 32
+
+/**
+ * This structure is a tower of the skip index of a sorted list. Towers are linked on every
+ * level they take part in, and level 0 links every tower in list order.
+ */
+struct skipTower {
+	struct listNode* node; // The node the tower stands on, NULL for the head tower
+	struct skipTower* next[]; // The next tower on each level the tower takes part in
+};
+
+/**
+ * This structure is the skip index of a sorted list. The nodes stay linked only through their
+ * next and previous node pointers, while the towers skip ahead over runs of nodes.
+ */
+struct sortedIndex {
+	int (*compare)(const void* a, const void* b); // Orders the data of two elements
+	uint32_t levels; // The number of levels in use
+	uint64_t random; // The state of the generator picking tower heights
+	struct skipTower* head; // The tower in front of every element, taking part in every level
+};
+
+/**
+ * This function decides whether data goes before a key while searching.
+ * @param index This is a pointer to the skip index providing the comparator.
+ * @param data This is a pointer to the data of an element.
+ * @param key This is a pointer to the key.
+ * @param inclusive This is true to also go past data equal to the key.
+ * @return This returns true if the search should go past the data.
+ */
+static bool ll_skipBefore(struct sortedIndex* index, const void* data, const void* key, bool inclusive){
+	int order = index->compare(data, key);
+
+	return (order < 0) || (inclusive && (order == 0));
+}
+
+/**
+ * This function finds the last tower on every level that goes before a key.
+ * @param index This is a pointer to the skip index to search.
+ * @param key This is a pointer to the key.
+ * @param inclusive This is true to go past towers equal to the key.
+ * @param update This is an array of LL_SKIP_MAX_LEVELS entries that receives the tower found
+ *               on every level in use.
+ * @return This returns the tower found on level 0.
+ */
+static struct skipTower* ll_skipSearch(struct sortedIndex* index, const void* key, bool inclusive, struct skipTower** update){
+	struct skipTower* tower = index->head;
+
+	// Move right as far as possible on each level before dropping down to the next one
+	for(uint32_t level = index->levels; level > 0; level--){
+		while((tower->next[level - 1] != NULL) && ll_skipBefore(index, tower->next[level - 1]->node->data, key, inclusive)){
+			tower = tower->next[level - 1];
+		}
+		update[level - 1] = tower;
+	}
+
+	return tower;
+}
+
+/**
+ * This function finds the first node of a sorted list that does not go before a key.
+ * @param list This is a pointer to the sorted list to search.
+ * @param key This is a pointer to the key.
+ * @param inclusive This is true to go past nodes equal to the key.
+ * @param update This is an array of LL_SKIP_MAX_LEVELS entries that receives the tower found
+ *               on every level in use.
+ * @return This returns a pointer to the node, or NULL if every node goes before the key.
+ */
+static struct listNode* ll_skipFind(struct linkedList* list, const void* key, bool inclusive, struct skipTower** update){
+	struct skipTower* tower = ll_skipSearch(list->sorted, key, inclusive, update);
+	struct listNode* node = (tower->node != NULL) ? tower->node->nextNode : list->head;
+
+	// Only the few nodes between two towers are left to walk
+	while((node != NULL) && ll_skipBefore(list->sorted, node->data, key, inclusive)){
+		node = node->nextNode;
+	}
+
+	return node;
+}
+
+/**
+ * This function picks the height of a new tower. Half of the nodes get no tower, and each
+ * further level is taken by half of the towers of the level below.
+ * @param index This is a pointer to the skip index.
+ * @return This returns the number of levels the tower takes part in.
+ */
+static uint32_t ll_skipHeight(struct sortedIndex* index){
+	uint32_t height;
+
+	// Step the xorshift generator
+	index->random ^= index->random << 13;
+	index->random ^= index->random >> 7;
+	index->random ^= index->random << 17;
+
+	height = (uint32_t)__builtin_ctzll(~index->random);
+
+	return (height < LL_SKIP_MAX_LEVELS) ? height : LL_SKIP_MAX_LEVELS;
+}
+
+/**
+ * This function removes the tower standing on a node from the skip index, if it has one.
+ * @param list This is a pointer to the sorted list holding the node.
+ * @param node This is a pointer to the node.
+ */
+static void ll_unindexNode(struct linkedList* list, struct listNode* node){
+	struct sortedIndex* index = list->sorted;
+	struct skipTower* update[LL_SKIP_MAX_LEVELS];
+	struct skipTower* tower = NULL;
+	bool found = true;
+
+	ll_skipSearch(index, node->data, false, update);
+
+	// Towers take part in every level up to their height, so stop at the first level without it
+	for(uint32_t level = 0; (level < index->levels) && found; level++){
+		struct skipTower* previous = update[level];
+
+		// Step over the towers of equal elements in front of the node
+		while((previous->next[level] != NULL) && (previous->next[level]->node != node) &&
+				(index->compare(previous->next[level]->node->data, node->data) == 0)){
+			previous = previous->next[level];
+		}
+
+		found = (previous->next[level] != NULL) && (previous->next[level]->node == node);
+		if(found){
+			tower = previous->next[level];
+			previous->next[level] = tower->next[level];
+		}
+	}
+
+	if(tower != NULL){
+		ll_chargeIndex(list, tower, 0, false);
+		free(tower);
+	}
+
+	// Drop the levels that no tower takes part in anymore
+	while((index->levels > 0) && (index->head->next[index->levels - 1] == NULL)){
+		index->levels = index->levels - 1;
+	}
+}
+
+/**
+ * This function frees every tower of the skip index of a list except the head tower.
+ * @param list This is a pointer to the sorted list.
+ */
+static void ll_resetIndex(struct linkedList* list){
+	struct sortedIndex* index = list->sorted;
+	struct skipTower* tower = (index->levels != 0) ? index->head->next[0] : NULL;
+
+	while(tower != NULL){
+		struct skipTower* temp = tower;
+		tower = tower->next[0];
+		ll_chargeIndex(list, temp, 0, false);
+		free(temp);
+	}
+
+	memset(index->head->next, 0, LL_SKIP_MAX_LEVELS * sizeof(struct skipTower*));
+	index->levels = 0;
+}
+
+/**
+ * This function unlinks a node from a list without freeing it. The next node pointer of the
+ * unlinked node is left intact so concurrent readers standing on it can move on.
+ * @param list This is a pointer to the list to unlink the node from.
+ * @param node This is a pointer to the node to unlink.
+ */
+static void ll_unlinkNode(struct linkedList* list, struct listNode* node){
+	// Take the node out of the skip index while its data can still be compared
+	if(list->sorted != NULL){
+		ll_unindexNode(list, node);
+	}
+
+	// Point the next node, or the tail if there is none, at the previous node
+	if(node->nextNode != NULL){
+		node->nextNode->prevNode = node->prevNode;
+	}
+	else{
+		list->tail = node->prevNode;
+	}
+
+	// Point the previous node, or the head if there is none, past the unlinked node
+	if(node->prevNode != NULL){
+		__atomic_store_n(&node->prevNode->nextNode, node->nextNode, __ATOMIC_RELEASE);
+	}
+	else{
+		__atomic_store_n(&list->head, node->nextNode, __ATOMIC_RELEASE);
+	}
+
+	// Decrease the list size to accurately represent the number of nodes contained in the list
+	list->size = list->size - 1;
+	ll_chargeNode(list, node, false);
+
+	if(list->size == 0){
+		ll_dropSmallNodes(list);
+	}
+}
+
+/**
+ * The most elements packed into one cold segment.
+ */
+#define LL_COLD_SEGMENT_NODES 256
+
+/**
+ * The most bytes of data packed into one cold segment, which bounds the work of expanding it.
+ */
+#define LL_COLD_SEGMENT_BYTES 16384
+
+/**
+ * The fewest elements worth packing into a segment of their own.
+ */
+#define LL_COLD_SEGMENT_MIN 8
+
+/**
+ * This structure holds the settings and counters of cold compression for a list.
+ */
+struct coldState {
+	ll_size_t hotWindow; // The number of elements at each end of the list that stay expanded
+	struct coldStats stats; // The counters reported by ll_coldStats
+	pthread_mutex_t expandLock; // Lets one reader of the list at a time expand a segment
+};
+
+/**
+ * This structure is a cold segment, the data of a run of elements packed together and
+ * compressed. It is followed in the same allocation by the nodes packed into it, the offsets
+ * of their data in the packed data and the compressed data.
+ */
+struct coldSegment {
+	struct linkedList* list; // The list the packed nodes belong to
+	uint32_t count; // The number of elements packed into the segment
+	uint32_t live; // The number of those still in the list
+	uint32_t rawSize; // The size of the packed data
+	uint32_t compressedSize; // The size of the compressed data, equal to rawSize if it is stored as is
+};
+
+/**
+ * This function returns the nodes packed into a segment, NULL for those that left the list.
+ * @param segment This is a pointer to the segment.
+ * @return This returns a pointer to an array of count nodes.
+ */
+static struct listNode** ll_segmentMembers(struct coldSegment* segment){
+	return (struct listNode**)(segment + 1);
+}
+
+/**
+ * This function returns the offsets of the data of each node in the packed data of a segment.
+ * @param segment This is a pointer to the segment.
+ * @return This returns a pointer to an array of count + 1 offsets, the last being rawSize.
+ */
+static uint32_t* ll_segmentOffsets(struct coldSegment* segment){
+	return (uint32_t*)(ll_segmentMembers(segment) + segment->count);
+}
+
+/**
+ * This function returns the compressed data of a segment.
+ * @param segment This is a pointer to the segment.
+ * @return This returns a pointer to compressedSize bytes.
+ */
+static unsigned char* ll_segmentData(struct coldSegment* segment){
+	return (unsigned char*)(ll_segmentOffsets(segment) + segment->count + 1);
+}
+
+/**
+ * This function charges a list for a segment, or takes the charge back. The compressed data
+ * counts as payload and the rest of the allocation as index.
+ * @param segment This is a pointer to the segment.
+ * @param add This is true to charge the segment, false to take the charge back.
+ */
+static void ll_chargeSegment(struct coldSegment* segment, bool add){
+	struct memoryUsage delta = {0};
+
+	delta.payloadBytes = segment->compressedSize;
+	delta.allocatedBytes = malloc_usable_size(segment);
+	delta.indexBytes = delta.allocatedBytes - segment->compressedSize;
+	ll_charge(&segment->list->indexUsage, &delta, add);
+}
+
+/**
+ * This function frees a segment that no node is packed into anymore.
+ * @param segment This is a pointer to the segment.
+ */
+static void ll_freeSegment(struct coldSegment* segment){
+	struct coldStats* stats = &segment->list->cold->stats;
+
+	stats->rawBytes = stats->rawBytes - segment->rawSize;
+	stats->compressedBytes = stats->compressedBytes - segment->compressedSize;
+	ll_chargeSegment(segment, false);
+	free(segment);
+}
+
+/**
+ * This function decompresses the packed data of a segment.
+ * @param segment This is a pointer to the segment.
+ * @return This returns a pointer to rawSize bytes of packed data the caller frees.
+ */
+static unsigned char* ll_decodeSegment(struct coldSegment* segment){
+	unsigned char* raw = (unsigned char*)malloc((segment->rawSize != 0) ? segment->rawSize : 1);
+
+	if(segment->compressedSize == segment->rawSize){
+		memcpy(raw, ll_segmentData(segment), segment->rawSize);
+	}
+	else{
+		lc_decompress(ll_segmentData(segment), segment->compressedSize, raw, segment->rawSize);
+	}
+
+	return raw;
+}
+
+/**
+ * This function replaces the payload of a node, moving its charge from the old to the new one.
+ * @param node This is a pointer to the node.
+ * @param data This is the new data pointer.
+ * @param flags This is the new payload kind along with any extra flags.
+ * @param before This is a pointer to the total the charge of the old payload is added to.
+ * @param after This is a pointer to the total the charge of the new payload is added to.
+ */
+static void ll_repackNode(struct listNode* node, void* data, uint32_t flags, struct memoryUsage* before, struct memoryUsage* after){
+	// The memory flags and slot of the node are kept, the payload kind and position replaced
+	uint32_t kept = node->flags & ((1u << LL_NODE_MEMBER_SHIFT) - 1u) & ~(LL_PAYLOAD_MASK | LL_NODE_TOUCHED | LL_NODE_EXPANDING);
+
+	// The kind is published last, so a reader that sees the new kind also sees the new data
+	ll_nodeCharge(node, before);
+	node->data = data;
+	__atomic_store_n(&node->flags, kept | flags, __ATOMIC_RELEASE);
+	ll_nodeCharge(node, after);
+}
+
+/**
+ * This function expands a segment, giving every node still packed into it its own copy of its
+ * data marked as touched, and frees the segment once no node is packed into it anymore. Nodes
+ * another reader has claimed are left to that reader. The expand lock of the list must be held.
+ * @param segment This is a pointer to the segment.
+ * @param claimed This is a pointer to the node the caller has claimed.
+ */
+static void ll_expandSegment(struct coldSegment* segment, struct listNode* claimed){
+	struct linkedList* list = segment->list;
+	struct listNode** members = ll_segmentMembers(segment);
+	uint32_t* offsets = ll_segmentOffsets(segment);
+	unsigned char* raw = ll_decodeSegment(segment);
+	struct memoryUsage before = {0};
+	struct memoryUsage after = {0};
+	bool owned[LL_COLD_SEGMENT_NODES];
+
+	// Claim every other member before any is expanded, so a reader that moves on from an
+	// expanded member finds the next one claimed and waits instead of decoding the segment again
+	for(uint32_t i = 0; i < segment->count; i++){
+		struct listNode* member = members[i];
+		uint32_t flags = 0;
+
+		owned[i] = (member == claimed);
+		if((member != NULL) && (member != claimed)){
+			flags = __atomic_load_n(&member->flags, __ATOMIC_RELAXED) & ~LL_NODE_EXPANDING;
+			owned[i] = __atomic_compare_exchange_n(&member->flags, &flags, flags | LL_NODE_EXPANDING, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+		}
+	}
+
+	// Members another reader claimed first are left to that reader
+	for(uint32_t i = 0; i < segment->count; i++){
+		if(owned[i]){
+			struct listNode* member = members[i];
+			void* data = malloc(member->dataSize);
+
+			memcpy(data, raw + offsets[i], member->dataSize);
+			ll_repackNode(member, data, LL_PAYLOAD_COPY | LL_NODE_TOUCHED, &before, &after);
+			members[i] = NULL;
+			segment->live = segment->live - 1;
+			list->cold->stats.packedElements = list->cold->stats.packedElements - 1;
+		}
+	}
+	ll_charge(&list->nodeUsage, &before, false);
+	ll_charge(&list->nodeUsage, &after, true);
+
+	list->cold->stats.decompressions = list->cold->stats.decompressions + 1;
+
+	free(raw);
+	if(segment->live == 0){
+		ll_freeSegment(segment);
+	}
+}
+
+/**
+ * This function expands the cold segment a compressed node is packed in, giving every element
+ * of the segment its own copy of its data again.
+ * @param node This is a pointer to a node whose payload kind is LL_PAYLOAD_COMPRESSED.
+ * @return This returns a pointer to the data of the node.
+ */
+void* ll_expandNode(struct listNode* node){
+	uint32_t flags = __atomic_load_n(&node->flags, __ATOMIC_ACQUIRE);
+	bool claimed = false;
+
+	// Another reader may expand the segment and free it at any time, so the node is claimed
+	// before its segment is looked at, which keeps the segment until this reader expands it
+	while(!claimed && ((flags & LL_PAYLOAD_MASK) == LL_PAYLOAD_COMPRESSED) && ((flags & LL_NODE_EXPANDING) == 0)){
+		claimed = __atomic_compare_exchange_n(&node->flags, &flags, flags | LL_NODE_EXPANDING, false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE);
+	}
+
+	if(claimed){
+		struct coldSegment* segment = (struct coldSegment*)node->data;
+		struct coldState* cold = segment->list->cold;
+
+		pthread_mutex_lock(&cold->expandLock);
+		ll_expandSegment(segment, node);
+		pthread_mutex_unlock(&cold->expandLock);
+	}
+	else{
+		// A reader that claimed the node first is expanding it
+		while((__atomic_load_n(&node->flags, __ATOMIC_ACQUIRE) & LL_PAYLOAD_MASK) == LL_PAYLOAD_COMPRESSED){
+			sched_yield();
+		}
+	}
+
+	return node->data;
+}
+
+/**
+ * This function copies the data of a compressed node out of its segment without expanding it.
+ * @param node This is a pointer to a node whose payload kind is LL_PAYLOAD_COMPRESSED.
+ * @param destination This is a pointer to dataSize bytes that receive the data.
+ */
+static void ll_readCompressed(struct listNode* node, void* destination){
+	struct coldSegment* segment = (struct coldSegment*)node->data;
+	unsigned char* raw = ll_decodeSegment(segment);
+
+	memcpy(destination, raw + ll_segmentOffsets(segment)[node->flags >> LL_NODE_MEMBER_SHIFT], node->dataSize);
+	free(raw);
+}
+
+/**
+ * This function takes a compressed node that left its list out of its segment, and frees the
+ * segment once no node is packed into it anymore.
+ * @param node This is a pointer to a node whose payload kind is LL_PAYLOAD_COMPRESSED.
+ */
+static void ll_dropPacked(struct listNode* node){
+	struct coldSegment* segment = (struct coldSegment*)node->data;
+
+	ll_segmentMembers(segment)[node->flags >> LL_NODE_MEMBER_SHIFT] = NULL;
+	segment->live = segment->live - 1;
+	segment->list->cold->stats.packedElements = segment->list->cold->stats.packedElements - 1;
+
+	if(segment->live == 0){
+		ll_freeSegment(segment);
+	}
+}
+
+/**
+ * This function packs a run of neighbouring nodes with copied data into a new segment, unless
+ * the run is too short to be worth it.
+ * @param list This is a pointer to the list the nodes belong to.
+ * @param first This is a pointer to the first node of the run.
+ * @param count This is the number of nodes in the run.
+ * @param rawSize This is the total size of their data.
+ * @return This returns the number of nodes packed.
+ */
+static ll_size_t ll_packRun(struct linkedList* list, struct listNode* first, uint32_t count, uint32_t rawSize){
+	ll_size_t packed = 0;
+
+	if(count >= LL_COLD_SEGMENT_MIN){
+		size_t header = sizeof(struct coldSegment) + (count * sizeof(struct listNode*)) + ((count + 1) * sizeof(uint32_t));
+		size_t bound = lc_compressBound(rawSize);
+		unsigned char* raw = (unsigned char*)malloc((rawSize != 0) ? rawSize : 1);
+		struct coldSegment* segment = (struct coldSegment*)malloc(header + bound);
+		struct memoryUsage before = {0};
+		struct memoryUsage after = {0};
+		struct listNode* node = first;
+		uint32_t* offsets;
+
+		segment->list = list;
+		segment->count = count;
+		segment->live = count;
+		segment->rawSize = rawSize;
+		offsets = ll_segmentOffsets(segment);
+
+		// Lay the data of the run out back to back and compress it in one block
+		offsets[0] = 0;
+		for(uint32_t i = 0; i < count; i++){
+			memcpy(raw + offsets[i], node->data, node->dataSize);
+			offsets[i + 1] = offsets[i] + (uint32_t)node->dataSize;
+			node = node->nextNode;
+		}
+		segment->compressedSize = (uint32_t)lc_compress(raw, rawSize, ll_segmentData(segment), bound);
+
+		// Data that does not compress is stored as is, which still saves an allocation per element
+		if((segment->compressedSize == 0) || (segment->compressedSize >= rawSize)){
+			memcpy(ll_segmentData(segment), raw, rawSize);
+			segment->compressedSize = rawSize;
+		}
+		free(raw);
+
+		// Give back the room the compressed data did not need before any node points here
+		segment = (struct coldSegment*)realloc(segment, header + segment->compressedSize);
+
+		node = first;
+		for(uint32_t i = 0; i < count; i++){
+			void* data = node->data;
+
+			ll_segmentMembers(segment)[i] = node;
+			ll_repackNode(node, segment, LL_PAYLOAD_COMPRESSED | (i << LL_NODE_MEMBER_SHIFT), &before, &after);
+			free(data);
+			node = node->nextNode;
+		}
+		ll_charge(&list->nodeUsage, &before, false);
+		ll_charge(&list->nodeUsage, &after, true);
+		ll_chargeSegment(segment, true);
+
+		list->cold->stats.compressions = list->cold->stats.compressions + 1;
+		list->cold->stats.packedElements = list->cold->stats.packedElements + count;
+		list->cold->stats.rawBytes = list->cold->stats.rawBytes + rawSize;
+		list->cold->stats.compressedBytes = list->cold->stats.compressedBytes + segment->compressedSize;
+
+		packed = count;
+	}
+
+	return packed;
+}
+
+/**
+ * This function frees the data of a node according to who owns it.
+ * @param node This is a pointer to the node whose data is freed.
+ * @param destructor This is the payload destructor for owned data, NULL to use free.
+ * @param list This is a pointer to the interning list shared data belongs to, or NULL if the
+ *             whole table is freed later along with the shared data.
+ */
+static void ll_freePayload(struct listNode* node, void (*destructor)(void*), struct linkedList* list){
+	switch(node->flags & LL_PAYLOAD_MASK){
+		case LL_PAYLOAD_OWNED:
+			if(destructor != NULL){
+				destructor(node->data);
+			}
+			else{
+				free(node->data);
+			}
+			break;
+		case LL_PAYLOAD_BORROWED:
+			// The data belongs to the caller
+			break;
+		case LL_PAYLOAD_INLINE:
+			// The data is freed together with the node
+			break;
+		case LL_PAYLOAD_INTERNED:
+			if(list != NULL){
+				ll_releaseInterned(list, node->data);
+			}
+			break;
+		case LL_PAYLOAD_COMPRESSED:
+			ll_dropPacked(node);
+			break;
+		default:
+			free(node->data);
+			break;
+	}
+}
+
+/**
+ * This function frees the data of a node according to who owns it.
+ * @param list This is a pointer to the list that provides the payload destructor.
+ * @param node This is a pointer to the node whose data is freed.
+ */
+static void ll_freeData(struct linkedList* list, struct listNode* node){
+	ll_freePayload(node, list->payloadDestructor, list);
+}
+
+/**
+ * This function frees a node and the data it holds.
+ * @param list This is a pointer to the list that provides the payload destructor.
+ * @param node This is a pointer to the node to free.
+ */
+static void ll_freeNode(struct linkedList* list, struct listNode* node){
+	ll_freeData(list, node);
+	ll_deallocNode(node);
+}
+
+/**
+ * This function frees every node in a chain linked through the next node pointers.
+ * @param list This is a pointer to the list that provides the payload destructor.
+ * @param node This is a pointer to the first node in the chain.
+ */
+static void ll_freeChain(struct linkedList* list, struct listNode* node){
+	while(node != NULL){
+		struct listNode* temp = node;
+		node = node->nextNode;
+		ll_freeNode(list, temp);
+	}
+}
+
+/**
+ * This function resets the node links and size of a list without touching its configuration.
+ * The head is published atomically so concurrent readers never see a torn pointer.
+ * @param list This is a pointer to the list to reset.
+ */
+static void ll_resetNodes(struct linkedList* list){
+	__atomic_store_n(&list->head, NULL, __ATOMIC_RELEASE);
+	list->tail = NULL;
+	list->size = 0;
+	ll_dropCharges(&list->nodeUsage);
+	ll_dropSmallNodes(list);
+
+	if(list->sorted != NULL){
+		ll_resetIndex(list);
+	}
+}
+
+/**
+ * This function frees every node on the retired chain of a list. The caller must make sure a
+ * grace period has passed since the nodes were retired.
+ * @param list This is a pointer to the list whose retired nodes are freed.
+ */
+static void ll_freeRetired(struct linkedList* list){
+	struct listNode* node = list->retired;
+
+	list->retired = NULL;
+	list->retiredCount = 0;
+
+	// The retired chain is linked through the previous node pointers
+	while(node != NULL){
+		struct listNode* temp = node;
+		node = node->prevNode;
+		ll_freeNode(list, temp);
+	}
+}
+
+/**
+ * This function releases a node that has been unlinked from a list. When concurrent readers
+ * are enabled the node is kept on the retired chain until a grace period has passed, since a
+ * reader may still be standing on it. The retired chain is linked through the previous node
+ * pointers so the next node pointers readers follow are left intact.
+ * @param list This is a pointer to the list the node was removed from.
+ * @param node This is a pointer to the unlinked node.
+ */
+static void ll_releaseNode(struct linkedList* list, struct listNode* node){
+	if(list->concurrentReaders){
+		node->prevNode = list->retired;
+		list->retired = node;
+		list->retiredCount = list->retiredCount + 1;
+
+		if(list->retiredCount >= LL_RCU_RETIRE_BATCH){
+			ll_rcuReclaim(list);
+		}
+	}
+	else{
+		ll_freeNode(list, node);
+	}
+}
+
+/**
+ * The number of nodes the background reclaimer frees between checks of the queue.
+ */
+#define LL_RECLAIM_THREAD_BUDGET 4096
+
+/**
+ * This structure is a chain of nodes detached from a list and waiting to be freed by
+ * ll_reclaimStep or the background reclaimer.
+ */
+struct reclaimBatch {
+	struct listNode* chain; // The next node to free, linked through the next node pointers
+	ll_size_t count; // The number of nodes left in the chain, which may continue into a live list
+	struct listNode* retired; // Retired nodes of the list, linked through the previous node pointers
+	struct skipTower* towers; // Skip index towers of the nodes, linked through their lowest level
+	struct internTable* interned; // The table the shared payloads of the nodes belong to, or NULL
+	void (*destructor)(void*); // The payload destructor of the list when the chain was detached
+	bool synchronize; // True if readers may still see the nodes and a grace period must pass first
+	struct reclaimBatch* next; // The next batch in the queue
+};
+
+static pthread_mutex_t reclaimLock = PTHREAD_MUTEX_INITIALIZER; // Protects the reclaim queue and thread state
+static pthread_cond_t reclaimReady = PTHREAD_COND_INITIALIZER; // Signals the reclaimer that a batch was queued
+static struct reclaimBatch* reclaimHead = NULL; // The oldest batch waiting to be freed
+static struct reclaimBatch* reclaimTail = NULL; // The newest batch waiting to be freed
+static pthread_t reclaimThread; // The background reclaimer, valid while reclaimRunning is true
+static bool reclaimRunning = false; // True while the background reclaimer should keep running
+
+/**
+ * This function creates a batch for nodes detached from a list.
+ * @param list This is a pointer to the list the nodes were detached from.
+ * @param chain This is a pointer to the first detached node.
+ * @param count This is the number of detached nodes.
+ * @return This returns a pointer to the new batch with no retired nodes, towers or table.
+ */
+static struct reclaimBatch* ll_newReclaimBatch(struct linkedList* list, struct listNode* chain, ll_size_t count){
+	struct reclaimBatch* batch = (struct reclaimBatch*)malloc(sizeof(struct reclaimBatch));
+
+	batch->chain = chain;
+	batch->count = count;
+	batch->retired = NULL;
+	batch->towers = NULL;
+	batch->interned = NULL;
+	batch->destructor = list->payloadDestructor;
+	batch->synchronize = list->concurrentReaders;
+	batch->next = NULL;
+
+	return batch;
+}
+
+/**
+ * This function appends a batch to the reclaim queue and wakes the background reclaimer.
+ * @param batch This is a pointer to the batch.
+ */
+static void ll_queueReclaim(struct reclaimBatch* batch){
+	pthread_mutex_lock(&reclaimLock);
+	if(reclaimTail != NULL){
+		reclaimTail->next = batch;
+	}
+	else{
+		reclaimHead = batch;
+	}
+	reclaimTail = batch;
+	pthread_cond_signal(&reclaimReady);
+	pthread_mutex_unlock(&reclaimLock);
+}
+
+/**
+ * This function frees part of a batch.
+ * @param batch This is a pointer to the batch, which no other thread is working on.
+ * @param budget This is the largest number of nodes and towers to free.
+ * @return This returns the number of nodes and towers freed.
+ */
+static size_t ll_reclaimBatch(struct reclaimBatch* batch, size_t budget){
+	size_t freed = 0;
+
+	if(batch->synchronize){
+		ll_rcuSynchronize();
+		batch->synchronize = false;
+	}
+
+	while((batch->count != 0) && (freed < budget)){
+		struct listNode* node = batch->chain;
+
+		batch->chain = node->nextNode;
+		batch->count = batch->count - 1;
+		ll_freePayload(node, batch->destructor, NULL);
+		ll_deallocNode(node);
+		freed = freed + 1;
+	}
+
+	while((batch->retired != NULL) && (freed < budget)){
+		struct listNode* node = batch->retired;
+
+		batch->retired = node->prevNode;
+		ll_freePayload(node, batch->destructor, NULL);
+		ll_deallocNode(node);
+		freed = freed + 1;
+	}
+
+	while((batch->towers != NULL) && (freed < budget)){
+		struct skipTower* tower = batch->towers;
+
+		batch->towers = tower->next[0];
+		free(tower);
+		freed = freed + 1;
+	}
+
+	// The shared payloads go last, once no node in the batch points at them anymore
+	if((batch->count == 0) && (batch->retired == NULL) && (batch->towers == NULL) && (batch->interned != NULL)){
+		ll_freeInternTable(batch->interned);
+		batch->interned = NULL;
+	}
+
+	return freed;
+}
+
+/**
+ * This function empties a list by handing every node, retired node, skip index tower and
+ * shared payload to the reclaim queue. The list keeps its configuration and can be used again
+ * straight away.
+ * @param list This is a pointer to the list to empty.
+ */
+static void ll_deferClear(struct linkedList* list){
+	struct reclaimBatch* batch = ll_newReclaimBatch(list, list->head, list->size);
+
+	batch->retired = list->retired;
+	list->retired = NULL;
+	list->retiredCount = 0;
+
+	// Take the towers out of the index so resetting it has nothing left to free
+	if((list->sorted != NULL) && (list->sorted->levels != 0)){
+		batch->towers = list->sorted->head->next[0];
+		list->sorted->head->next[0] = NULL;
+	}
+
+	// Every shared payload belongs to the cleared elements, so the table goes with them
+	if((list->interned != NULL) && (list->size != 0)){
+		batch->interned = list->interned;
+		list->interned = ll_newInternTable();
+	}
+
+	ll_resetNodes(list);
+
+	// The towers and shared payloads left with the batch, so charge the list for what it kept
+	ll_dropCharges(&list->indexUsage);
+	if(list->sorted != NULL){
+		ll_chargeIndex(list, list->sorted, 0, true);
+		ll_chargeIndex(list, list->sorted->head, 0, true);
+	}
+	if(list->interned != NULL){
+		ll_chargeIndex(list, list->interned, 0, true);
+		ll_chargeIndex(list, list->interned->slots, 0, true);
+	}
+
+	if((batch->count != 0) || (batch->retired != NULL) || (batch->towers != NULL)){
+		ll_queueReclaim(batch);
+	}
+	else{
+		free(batch);
+	}
+}
+
+/**
+ * This function runs the background reclaimer until it is stopped and the queue is empty.
+ * @param argument This is unused.
+ * @return This always returns NULL.
+ */
+static void* ll_reclaimerMain(void* argument){
+	pthread_mutex_lock(&reclaimLock);
+	while(reclaimRunning || (reclaimHead != NULL)){
+		if(reclaimHead == NULL){
+			pthread_cond_wait(&reclaimReady, &reclaimLock);
+		}
+		else{
+			pthread_mutex_unlock(&reclaimLock);
+			ll_reclaimStep(LL_RECLAIM_THREAD_BUDGET);
+			pthread_mutex_lock(&reclaimLock);
+		}
+	}
+	pthread_mutex_unlock(&reclaimLock);
+
+	return argument;
+}
+
+/**
+ * The first four bytes of every exported delta.
+ */
+#define LL_DELTA_MAGIC 0x31444C4Cu
+
+/**
+ * The version of the delta format written by ll_exportDelta.
+ */
+#define LL_DELTA_VERSION 1u
+
+/**
+ * The most bytes a number takes in a change record.
+ */
+#define LL_VARINT_MAX 10
+
+/**
+ * These are the kinds of records in a change log. A record is its kind in one byte followed
+ * by its fields, each written seven bits per byte with the top bit marking that more follow.
+ */
+#define LL_CHANGE_ADD 1u // An element was appended: size, data
+#define LL_CHANGE_INSERT 2u // An element was inserted: index, size, data
+#define LL_CHANGE_REMOVE 3u // A run of elements was removed: index, count
+#define LL_CHANGE_CLEAR 4u // Every element was removed
+
+/**
+ * This structure is the change log of a list. The records are kept in the format they are
+ * exported in, so exporting copies them in one go.
+ */
+struct changeLog {
+	uint64_t firstSequence; // The sequence number of the first record kept
+	uint64_t oldestSince; // The oldest sequence number a delta can be exported from
+	size_t count; // The number of records kept
+	size_t* offsets; // The position of every record kept in bytes
+	size_t offsetCapacity; // The number of offsets allocated
+	unsigned char* bytes; // The records kept, back to back
+	size_t used; // The number of bytes of records kept
+	size_t capacity; // The number of bytes allocated
+};
+
+/**
+ * This structure is the header of an exported delta, followed by its records.
+ */
+struct deltaHeader {
+	uint32_t magic; // LL_DELTA_MAGIC
+	uint32_t version; // LL_DELTA_VERSION
+	uint64_t firstSequence; // The sequence number of the first record in the delta
+	uint64_t count; // The number of records in the delta
+};
+
+/**
+ * This function makes room in the change log of a list for one more record.
+ * @param list This is a pointer to the list.
+ * @param bytes This is the largest number of bytes the record can take.
+ */
+static void ll_logReserve(struct linkedList* list, size_t bytes){
+	struct changeLog* log = list->changes;
+
+	if(log->count == log->offsetCapacity){
+		ll_chargeIndex(list, log->offsets, 0, false);
+		log->offsetCapacity = (log->offsetCapacity != 0) ? (log->offsetCapacity * 2) : 64;
+		log->offsets = (size_t*)realloc(log->offsets, log->offsetCapacity * sizeof(size_t));
+		ll_chargeIndex(list, log->offsets, 0, true);
+	}
+
+	if((log->capacity - log->used) < bytes){
+		ll_chargeIndex(list, log->bytes, 0, false);
+		while((log->capacity - log->used) < bytes){
+			log->capacity = (log->capacity != 0) ? (log->capacity * 2) : 4096;
+		}
+		log->bytes = (unsigned char*)realloc(log->bytes, log->capacity);
+		ll_chargeIndex(list, log->bytes, 0, true);
+	}
+}
+
+/**
+ * This function writes a number of a change record.
+ * @param out This is a pointer to room for LL_VARINT_MAX bytes.
+ * @param value This is the number.
+ * @return This returns the number of bytes written.
+ */
+static size_t ll_writeVarint(unsigned char* out, uint64_t value){
+	size_t length = 0;
+
+	while(value >= 0x80){
+		out[length] = (unsigned char)(value | 0x80);
+		value = value >> 7;
+		length = length + 1;
+	}
+	out[length] = (unsigned char)value;
+
+	return length + 1;
+}
+
+/**
+ * This function records a change in the change log of a list under the next sequence number.
+ * @param list This is a pointer to a list that tracks changes.
+ * @param kind This is the kind of the record, one of the LL_CHANGE values.
+ * @param index This is the index of an insertion or removal, ignored for the other kinds.
+ * @param count This is the size of the data of an addition or the number of elements removed.
+ * @param data This is a pointer to the data of an addition, NULL for the other kinds.
+ */
+static void ll_logChange(struct linkedList* list, uint32_t kind, ll_size_t index, ll_size_t count, const void* data){
+	struct changeLog* log = list->changes;
+
+	ll_logReserve(list, 1 + (2 * LL_VARINT_MAX) + ((data != NULL) ? count : 0));
+
+	log->offsets[log->count] = log->used;
+	log->count = log->count + 1;
+	log->bytes[log->used] = (unsigned char)kind;
+	log->used = log->used + 1;
+
+	if((kind == LL_CHANGE_INSERT) || (kind == LL_CHANGE_REMOVE)){
+		log->used = log->used + ll_writeVarint(log->bytes + log->used, index);
+	}
+	if(kind != LL_CHANGE_CLEAR){
+		log->used = log->used + ll_writeVarint(log->bytes + log->used, count);
+	}
+	if(data != NULL){
+		memcpy(log->bytes + log->used, data, count);
+		log->used = log->used + count;
+	}
+}
+
+/**
+ * This function records that a list was cleared. Every earlier record is dropped, since a
+ * replica at any sequence number only needs the clear and what follows it.
+ * @param list This is a pointer to a list that tracks changes.
+ */
+static void ll_logClear(struct linkedList* list){
+	struct changeLog* log = list->changes;
+
+	log->firstSequence = log->firstSequence + log->count;
+	log->oldestSince = 0;
+	log->count = 0;
+	log->used = 0;
+	ll_logChange(list, LL_CHANGE_CLEAR, 0, 0, NULL);
+}
+
+/**
+ * This function reads a number of a change record.
+ * @param in This is a pointer to the read position, which is moved behind the number.
+ * @param end This is a pointer to the end of the delta.
+ * @param value This is a pointer that receives the number.
+ * @return This returns true if the number was read, false if the delta ended first or the
+ *         number is too large.
+ */
+static bool ll_readVarint(const unsigned char** in, const unsigned char* end, uint64_t* value){
+	bool more = true;
+	uint32_t shift = 0;
+
+	*value = 0;
+	while(more && (*in < end) && (shift < 64)){
+		*value = *value | ((uint64_t)(**in & 0x7F) << shift);
+		more = ((**in & 0x80) != 0);
+		shift = shift + 7;
+		*in = *in + 1;
+	}
+
+	return !more;
+}
+
+/**
+ * This function applies one change record to a list.
+ * @param list This is a pointer to the list.
+ * @param in This is a pointer to the read position, which is moved behind the record.
+ * @param end This is a pointer to the end of the delta.
+ * @return This returns true if the record was applied, false if it is damaged or does not fit
+ *         the list.
+ */
+static bool ll_applyChange(struct linkedList* list, const unsigned char** in, const unsigned char* end){
+	bool completed = false;
+	uint32_t kind = **in;
+	uint64_t index = 0;
+	uint64_t count = 0;
+	bool valid;
+
+	*in = *in + 1;
+	valid = (kind >= LL_CHANGE_ADD) && (kind <= LL_CHANGE_CLEAR);
+	if(valid && ((kind == LL_CHANGE_INSERT) || (kind == LL_CHANGE_REMOVE))){
+		valid = ll_readVarint(in, end, &index) && (index <= LL_SIZE_MAX);
+	}
+	if(valid && (kind != LL_CHANGE_CLEAR)){
+		valid = ll_readVarint(in, end, &count) && (count <= LL_SIZE_MAX);
+	}
+	if(valid && ((kind == LL_CHANGE_ADD) || (kind == LL_CHANGE_INSERT))){
+		valid = (count <= (uint64_t)(end - *in));
+	}
+
+	if(valid){
+		switch(kind){
+			case LL_CHANGE_ADD:
+				completed = ll_add(list, *in, (ll_size_t)count);
+				*in = *in + count;
+				break;
+			case LL_CHANGE_INSERT:
+				completed = ll_addIndex(list, *in, (ll_size_t)count, (ll_size_t)index);
+				*in = *in + count;
+				break;
+			case LL_CHANGE_REMOVE:
+				if(count == 1){
+					completed = ll_remove(list, (ll_size_t)index);
+				}
+				else{
+					completed = (count != 0) && (index < list->size) && (count <= (list->size - index)) &&
+							(ll_removeRange(list, (ll_size_t)index, (ll_size_t)count) == count);
+				}
+				break;
+			default:
+				ll_clear(list);
+				completed = true;
+				break;
+		}
+	}
+
+	return completed;
+}
+
+/**
+ * This function initializes the elements in the linkedList structure to default values.
+ * @param list This is a pointer to the list to initialize.
+ */
+void ll_init(struct linkedList* list){
+	// Checks if the list parameter is NULL to avoid a null pointer dereference
+	if(list != NULL){
+		// Initializes the list values
+		list->head = NULL;
+		list->tail = NULL;
+		list->size = 0;
+		list->concurrentReaders = false;
+		list->retired = NULL;
+		list->retiredCount = 0;
+		list->payloadDestructor = NULL;
+		list->smallNodes = NULL;
+		list->sorted = NULL;
+		list->interned = NULL;
+		list->deferredReclaim = false;
+		memset(&list->nodeUsage, 0, sizeof(list->nodeUsage));
+		memset(&list->indexUsage, 0, sizeof(list->indexUsage));
+		list->cold = NULL;
+		list->changes = NULL;
+	}
+}
+
+/**
+ * This function adds an element to the linked list at the end of the list.
+ * @param list This is a pointer to the list to add to.
+ * @param object This is a pointer to the object to be added to the list.
+ * @param size This is the size of the object being added in bytes.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool ll_add(struct linkedList* list, const void* object, ll_size_t size){
+	bool completed = false;
+
+	// Checks all parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (object != NULL) && (size != 0) && (list->sorted == NULL)){
+		// Allocate space in memory for the new node and copy the object into it
+		struct listNode* node = ll_newNode(list, object, size);
+
+		// Link the new node in behind the old tail
+		ll_linkNode(list, node, NULL);
+
+		if(list->changes != NULL){
+			ll_logChange(list, LL_CHANGE_ADD, 0, size, object);
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function adds an element to the linked list at the desired index.
+ * @param list This is a pointer to the list to add to.
+ * @param object This is a pointer to the object to be added to the list.
+ * @param size This is the size of the object being added in bytes.
+ * @param index This is the index to add the object at.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool ll_addIndex(struct linkedList* list, const void* object, ll_size_t size, ll_size_t index){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferencing and index out of bounds errors
+	if((list != NULL) && (object != NULL) && (size != 0) && (index < list->size) && (list->sorted == NULL)){
+		// Allocate space in memory for the new node and copy the object into it
+		struct listNode* node = ll_newNode(list, object, size);
+
+		// Link the new node in front of the node that holds this index now
+		ll_linkNode(list, node, ll_nodeAt(list, index));
+
+		if(list->changes != NULL){
+			ll_logChange(list, LL_CHANGE_INSERT, index, size, object);
+		}
+
+		completed = true;
+	}
+	// If the index to add at is the last index, run the simple add function to avoid redundant code
+	else if((list != NULL) && (index == list->size)){
+		completed = ll_add(list, object, size);
+	}
+
+	return completed;
+}
+
+/**
+ * This function removes an object from the list at a given index.
+ * @param list This is a pointer to the list to remove from.
+ * @param index This is the index to remove the object from.
+ * @return This returns true if the remove was successful, false if it failed.
+ */
+bool ll_remove(struct linkedList* list, ll_size_t index){
+	bool completed = false;
+
+	// Check if the parameters are valid to avoid null pointer dereferencing and index out of bounds errors
+	if((list != NULL) && (index < list->size)){
+		struct listNode* node = ll_nodeAt(list, index);
+
+		ll_unlinkNode(list, node);
+
+		// Free the node and its data to avoid memory leaks
+		ll_releaseNode(list, node);
+
+		if(list->changes != NULL){
+			ll_logChange(list, LL_CHANGE_REMOVE, index, 1, NULL);
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function returns the data of a node for a caller reading it through its list. An
+ * element of a list with cold compression is marked as touched, so the next compression pass
+ * leaves it expanded.
+ * @param list This is a pointer to the list the node belongs to.
+ * @param node This is a pointer to the node.
+ * @return This returns a pointer to the data of the node.
+ */
+static void* ll_readNode(struct linkedList* list, struct listNode* node){
+	void* data = ll_nodeData(node);
+
+	// Only the first read since the last pass writes, other readers may be reading the node too
+	if((list->cold != NULL) && ((__atomic_load_n(&node->flags, __ATOMIC_RELAXED) & LL_NODE_TOUCHED) == 0)){
+		__atomic_fetch_or(&node->flags, LL_NODE_TOUCHED, __ATOMIC_RELAXED);
+	}
+
+	return data;
+}
+
+/**
+ * This function gets the object from the desired list index.
+ * @param list This is a pointer to the list to get the object from.
+ * @param index This is the index to get the object from.
+ */
+void* ll_get(struct linkedList* list, ll_size_t index){
+	void* result = NULL;
+
+	// Check if the parameters are valid values to avoid null pointer dereferences and index out of bounds errors
+	if((list != NULL) && (index < list->size)){
+		// Set the output to point at the data in the node
+		result = ll_readNode(list, ll_nodeAt(list, index));
+	}
+
+	return result;
+}
+
+/**
+ * This function frees the memory allocated for the nodes and data of objects in the list.
+ * The node links and size of the linkedList structure are reset to their default values,
+ * while its configuration (such as concurrent reader mode) is kept.
+ * @param list This is a pointer to the list to be cleared.
+ */
+void ll_clear(struct linkedList* list){
+	// Check if list is NULL to avoid null pointer dereferencing
+	if(list != NULL){
+		struct listNode* chain = list->head;
+
+		if(list->changes != NULL){
+			ll_logClear(list);
+		}
+
+		if(list->deferredReclaim){
+			// The reclaimer frees the nodes so clearing takes the same time for any size
+			ll_deferClear(list);
+		}
+		else{
+			// Detach the nodes from the list so no new reader can reach them
+			ll_resetNodes(list);
+
+			if(list->concurrentReaders){
+				// Wait for readers that may still be walking the detached chain, then free everything
+				ll_rcuSynchronize();
+				ll_freeChain(list, chain);
+				ll_freeRetired(list);
+			}
+			else{
+				// Free every node and the data in it to avoid memory leaks
+				ll_freeChain(list, chain);
+			}
+		}
+	}
+}
+
+/**
+ * This function returns the size element of the linked list structure.
+ * @param list This is a pointer to the list to return the size of.
+ * @return This returns the size of the list (the number of objects contained in the list).
+ */
+ll_size_t ll_size(struct linkedList* list){
+	ll_size_t num = 0;
+
+	// Check if list is NUll to avoid null pointer dereferencing
+	if(list != NULL){
+		// Set the output to the size of the list
+		num = list->size;
+	}
+
+	return num;
+}
+
+/**
+ * This function creates an iterator for a given linked list. The iterator starts at the head of the list.
+ * @param list This is a pointer to the list used to create the iterator.
+ * @return This returns a pointer to the linkedListIterator structure if the iterator generated correctly,
+ * 	       else it returns NULL.
+ */
+struct linkedListIterator* ll_getIterator(struct linkedList* list){
+	struct linkedListIterator* iterator = NULL;
+
+	// Checks if the list is NUll to avoid null pointer dereferencing
+	if(list != NULL){
+		// Allocate space in memory for the iterator
+		iterator = (struct linkedListIterator*) malloc(sizeof(struct linkedListIterator));
+
+		// Start the iterator at the head of the list
+		iterator->current = __atomic_load_n(&list->head, __ATOMIC_ACQUIRE);
+		iterator->previous = NULL;
+	}
+	return iterator;
+}
+
+/**
+ * This function determines if an iterator has another element or more data to retrieve.
+ * @param iter This is a pointer to the iterator check.
+ * @return This returns true if there is another element or more data has not been retrieved,
+ * 		   else it returns false.
+ */
+bool ll_hasNext(struct linkedListIterator* iter){
+	bool hasNext = false;
+
+	// Checks if the iterator is NUll to avoid null pointer dereferencing
+	if(iter != NULL){
+		// Checks if the current node of the iterator is NUll to tell if there is still data
+		// to access with the next method
+		if(iter->current != NULL){
+				hasNext = true;
+		}
+	}
+	return hasNext;
+}
+
+/**
+ * This function gets the data stored in the current node of the iterator and iterates to
+ * the next node in the list.
+ * @param iter This is a pointer to the iterator to access the data of and iterate.
+ */
+void* ll_next(struct linkedListIterator* iter){
+	void* data = NULL;
+
+	// Checks if the iterator is NUll to avoid null pointer dereferencing
+	if(iter != NULL){
+		// Checks if the current node of the iterator is NUll to avoid null pointer dereferencing
+		if(iter->current != NULL){
+			// Set the output to point at the data in the current node
+			data = ll_nodeData(iter->current);
+			// Iterate to the next node
+			iter->previous = iter->current;
+			iter->current = __atomic_load_n(&iter->current->nextNode, __ATOMIC_ACQUIRE);
+		}
+	}
+
+	return data;
+}
+
+/**
+ * This function creates an iterator positioned in front of the element at an index.
+ * @param list This is a pointer to the list used to create the iterator.
+ * @param index This is the index of the element, ll_size(list) to start at the end.
+ * @return This returns a pointer to the iterator, or NULL if the index is out of range.
+ */
+struct linkedListIterator* ll_getIteratorAt(struct linkedList* list, ll_size_t index){
+	struct linkedListIterator* iterator = NULL;
+
+	// Check if the parameters are valid to avoid null pointer dereferencing and index out of bounds errors
+	if((list != NULL) && (index <= list->size)){
+		iterator = (struct linkedListIterator*) malloc(sizeof(struct linkedListIterator));
+
+		if(index < list->size){
+			iterator->current = ll_nodeAt(list, index);
+			iterator->previous = iterator->current->prevNode;
+		}
+		else{
+			iterator->current = NULL;
+			iterator->previous = list->tail;
+		}
+	}
+
+	return iterator;
+}
+
+/**
+ * This function creates an iterator positioned at the end of a list.
+ * @param list This is a pointer to the list used to create the iterator.
+ * @return This returns a pointer to the iterator, or NULL if the list is NULL.
+ */
+struct linkedListIterator* ll_getReverseIterator(struct linkedList* list){
+	return ll_getIteratorAt(list, (list != NULL) ? list->size : 0);
+}
+
+/**
+ * This function determines if an iterator has an element before it.
+ * @param iter This is a pointer to the iterator to check.
+ * @return This returns true if ll_prev has an element to return, else it returns false.
+ */
+bool ll_hasPrev(struct linkedListIterator* iter){
+	return (iter != NULL) && (iter->previous != NULL);
+}
+
+/**
+ * This function moves an iterator back by one element and gets the data of that element.
+ * @param iter This is a pointer to the iterator to move.
+ * @return This returns a pointer to the data, or NULL if the iterator is at the front.
+ */
+void* ll_prev(struct linkedListIterator* iter){
+	void* data = NULL;
+
+	// Checks if the iterator and its previous node are NULL to avoid null pointer dereferencing
+	if((iter != NULL) && (iter->previous != NULL)){
+		data = ll_nodeData(iter->previous);
+		iter->current = iter->previous;
+		iter->previous = iter->previous->prevNode;
+	}
+
+	return data;
+}
+
+/**
+ * This function moves an iterator forward by a number of elements.
+ * @param iter This is a pointer to the iterator to move.
+ * @param count This is the number of elements to move past.
+ * @return This returns the number of elements moved past.
+ */
+ll_size_t ll_advance(struct linkedListIterator* iter, ll_size_t count){
+	ll_size_t moved = 0;
+
+	// Checks if the iterator is NULL to avoid null pointer dereferencing
+	if(iter != NULL){
+		while((moved < count) && (iter->current != NULL)){
+			iter->previous = iter->current;
+			iter->current = __atomic_load_n(&iter->current->nextNode, __ATOMIC_ACQUIRE);
+			moved = moved + 1;
+		}
+	}
+
+	return moved;
+}
+
+/**
+ * This function moves an iterator back by a number of elements.
+ * @param iter This is a pointer to the iterator to move.
+ * @param count This is the number of elements to move back past.
+ * @return This returns the number of elements moved back past.
+ */
+ll_size_t ll_retreat(struct linkedListIterator* iter, ll_size_t count){
+	ll_size_t moved = 0;
+
+	// Checks if the iterator is NULL to avoid null pointer dereferencing
+	if(iter != NULL){
+		while((moved < count) && (iter->previous != NULL)){
+			iter->current = iter->previous;
+			iter->previous = iter->previous->prevNode;
+			moved = moved + 1;
+		}
+	}
+
+	return moved;
+}
+
+/**
+ * This function enables or disables concurrent reader mode for a linked list.
+ * @param list This is a pointer to the list to configure.
+ * @param enabled This is true to enable concurrent readers, false to disable them.
+ * @return This returns true if the mode was changed, false if it failed.
+ */
+bool ll_setConcurrentReaders(struct linkedList* list, bool enabled){
+	bool completed = false;
+
+	// Check if list is NULL to avoid null pointer dereferencing, shared and packed payloads rule out readers
+	if((list != NULL) && (!enabled || ((list->interned == NULL) && (list->cold == NULL)))){
+		// Free nodes that are still waiting for readers before leaving the mode
+		if(!enabled){
+			ll_rcuReclaim(list);
+		}
+
+		list->concurrentReaders = enabled;
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function waits for a grace period and then frees every node retired by the writer.
+ * @param list This is a pointer to the list whose retired nodes should be freed.
+ */
+void ll_rcuReclaim(struct linkedList* list){
+	// Check if there is anything to reclaim to avoid waiting for readers needlessly
+	if((list != NULL) && (list->retired != NULL)){
+		// Every reader that could have reached a retired node has finished after this returns
+		ll_rcuSynchronize();
+
+		ll_freeRetired(list);
+	}
+}
+
+/**
+ * This function hands the data of an unlinked node over to the caller and frees the node.
+ * When concurrent readers are enabled they may still be reading the data, so the caller
+ * receives a copy and the node is retired instead. Borrowed data is never copied since the
+ * list does not free it.
+ * @param list This is a pointer to the list the node was unlinked from.
+ * @param node This is a pointer to the unlinked node.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data.
+ */
+static void* ll_takeData(struct linkedList* list, struct listNode* node, ll_size_t* size){
+	void* data = node->data;
+
+	if(size != NULL){
+		*size = node->dataSize;
+	}
+
+	uint32_t kind = node->flags & LL_PAYLOAD_MASK;
+
+	// Inline, shared and packed data cannot be handed over, so the caller always receives a copy
+	if((list->concurrentReaders && (kind != LL_PAYLOAD_BORROWED)) || (kind == LL_PAYLOAD_INLINE) || (kind == LL_PAYLOAD_INTERNED)){
+		data = malloc(node->dataSize);
+		memcpy(data, node->data, node->dataSize);
+		ll_releaseNode(list, node);
+	}
+	else if(kind == LL_PAYLOAD_COMPRESSED){
+		// The node already left the list, so its data is decoded without expanding the segment
+		data = malloc(node->dataSize);
+		ll_readCompressed(node, data);
+		ll_releaseNode(list, node);
+	}
+	else{
+		// Only the node is freed, the data now belongs to the caller
+		ll_deallocNode(node);
+	}
+
+	return data;
+}
+
+/**
+ * This function adds an element to the linked list at the front of the list.
+ * @param list This is a pointer to the list to add to.
+ * @param object This is a pointer to the object to be added to the list.
+ * @param size This is the size of the object being added in bytes.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool ll_pushFront(struct linkedList* list, const void* object, ll_size_t size){
+	bool completed = false;
+
+	// Checks all parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (object != NULL) && (size != 0) && (list->sorted == NULL)){
+		// Allocate space in memory for the new node and copy the object into it
+		struct listNode* node = ll_newNode(list, object, size);
+
+		// Link the new node in front of the old head
+		ll_linkNode(list, node, list->head);
+
+		if(list->changes != NULL){
+			ll_logChange(list, LL_CHANGE_INSERT, 0, size, object);
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function removes the first element of the list and hands its data to the caller.
+ * @param list This is a pointer to the list to remove from.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data, which the caller must free, or NULL if the list
+ *         is empty.
+ */
+void* ll_popFront(struct linkedList* list, ll_size_t* size){
+	void* data = NULL;
+
+	// Check if the list is NULL or empty to avoid null pointer dereferencing
+	if((list != NULL) && (list->head != NULL)){
+		struct listNode* node = list->head;
+
+		if(list->changes != NULL){
+			ll_logChange(list, LL_CHANGE_REMOVE, 0, 1, NULL);
+		}
+
+		ll_unlinkNode(list, node);
+		data = ll_takeData(list, node, size);
+	}
+
+	return data;
+}
+
+/**
+ * This function removes the last element of the list and hands its data to the caller.
+ * @param list This is a pointer to the list to remove from.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data, which the caller must free, or NULL if the list
+ *         is empty.
+ */
+void* ll_popBack(struct linkedList* list, ll_size_t* size){
+	void* data = NULL;
+
+	// Check if the list is NULL or empty to avoid null pointer dereferencing
+	if((list != NULL) && (list->tail != NULL)){
+		struct listNode* node = list->tail;
+
+		if(list->changes != NULL){
+			ll_logChange(list, LL_CHANGE_REMOVE, list->size - 1, 1, NULL);
+		}
+
+		ll_unlinkNode(list, node);
+		data = ll_takeData(list, node, size);
+	}
+
+	return data;
+}
+
+/**
+ * This function gets the data of the first element of the list without removing it.
+ * @param list This is a pointer to the list to look at.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data, or NULL if the list is empty.
+ */
+void* ll_peekFront(struct linkedList* list, ll_size_t* size){
+	void* data = NULL;
+
+	// Check if the list is NULL or empty to avoid null pointer dereferencing
+	if((list != NULL) && (list->head != NULL)){
+		data = ll_readNode(list, list->head);
+
+		if(size != NULL){
+			*size = list->head->dataSize;
+		}
+	}
+
+	return data;
+}
+
+/**
+ * This function gets the data of the last element of the list without removing it.
+ * @param list This is a pointer to the list to look at.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data, or NULL if the list is empty.
+ */
+void* ll_peekBack(struct linkedList* list, ll_size_t* size){
+	void* data = NULL;
+
+	// Check if the list is NULL or empty to avoid null pointer dereferencing
+	if((list != NULL) && (list->tail != NULL)){
+		data = ll_readNode(list, list->tail);
+
+		if(size != NULL){
+			*size = list->tail->dataSize;
+		}
+	}
+
+	return data;
+}
+
+/**
+ * This function moves elements from the front of one list to the end of another.
+ * @param dest This is a pointer to the list the elements are appended to.
+ * @param src This is a pointer to the list the elements are taken from.
+ * @param count This is the maximum number of elements to move.
+ * @return This returns the number of elements moved.
+ */
+ll_size_t ll_transfer(struct linkedList* dest, struct linkedList* src, ll_size_t count){
+	ll_size_t moved = 0;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((dest != NULL) && (src != NULL) && (dest != src) && (src->size != 0) && (count != 0) &&
+			(dest->sorted == NULL) && (src->sorted == NULL) && (src->interned == NULL) && (src->cold == NULL)){
+		struct listNode* first = src->head;
+		struct listNode* last = src->tail;
+		struct memoryUsage charge = src->nodeUsage;
+
+		moved = src->size;
+
+		// Find the last node to move unless the whole list is moved, and add up what the moved
+		// nodes cost walking from whichever end of the list is nearer
+		if(count <= (src->size / 2)){
+			memset(&charge, 0, sizeof(charge));
+			last = first;
+			ll_nodeCharge(first, &charge);
+			for(ll_size_t i = 1; i < count; i++){
+				last = last->nextNode;
+				ll_nodeCharge(last, &charge);
+			}
+			moved = count;
+		}
+		else if(count < src->size){
+			struct memoryUsage kept = {0};
+
+			for(ll_size_t i = src->size; i > count; i--){
+				ll_nodeCharge(last, &kept);
+				last = last->prevNode;
+			}
+			charge.payloadBytes = charge.payloadBytes - kept.payloadBytes;
+			charge.nodeBytes = charge.nodeBytes - kept.nodeBytes;
+			charge.borrowedBytes = charge.borrowedBytes - kept.borrowedBytes;
+			charge.allocatedBytes = charge.allocatedBytes - kept.allocatedBytes;
+			moved = count;
+		}
+
+		// The run leaves the change log of one list and enters the other
+		if(src->changes != NULL){
+			ll_logChange(src, LL_CHANGE_REMOVE, 0, moved, NULL);
+		}
+		if(dest->changes != NULL){
+			struct listNode* node = first;
+
+			for(ll_size_t i = 0; i < moved; i++){
+				ll_logChange(dest, LL_CHANGE_ADD, 0, node->dataSize, node->data);
+				node = node->nextNode;
+			}
+		}
+
+		// Detach the run from the source list
+		src->size = src->size - moved;
+		ll_charge(&dest->nodeUsage, &charge, true);
+		if(last->nextNode != NULL){
+			last->nextNode->prevNode = NULL;
+			__atomic_store_n(&src->head, last->nextNode, __ATOMIC_RELEASE);
+			ll_charge(&src->nodeUsage, &charge, false);
+		}
+		else{
+			ll_resetNodes(src);
+		}
+
+		// Append the run behind the tail of the destination list
+		first->prevNode = dest->tail;
+		__atomic_store_n(&last->nextNode, NULL, __ATOMIC_RELEASE);
+		if(dest->tail != NULL){
+			__atomic_store_n(&dest->tail->nextNode, first, __ATOMIC_RELEASE);
+		}
+		else{
+			__atomic_store_n(&dest->head, first, __ATOMIC_RELEASE);
+		}
+		dest->tail = last;
+		dest->size = dest->size + moved;
+
+		// Elements entering an interning list share their data like elements added to it
+		if(dest->interned != NULL){
+			for(struct listNode* node = first; node != NULL; node = node->nextNode){
+				ll_shareNode(dest, node);
+			}
+		}
+	}
+
+	return moved;
+}
+
+/**
+ * This function sets the function used to free data handed to the list with ll_addOwned.
+ * @param list This is a pointer to the list to configure.
+ * @param destructor This is the function that frees owned data, or NULL to use free.
+ * @return This returns true if the destructor was set, false if it failed.
+ */
+bool ll_setPayloadDestructor(struct linkedList* list, void (*destructor)(void*)){
+	bool completed = false;
+
+	// Check if list is NULL to avoid null pointer dereferencing
+	if(list != NULL){
+		list->payloadDestructor = destructor;
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function adds an element to the end of the list without copying it. The list takes
+ * ownership of the object.
+ * @param list This is a pointer to the list to add to.
+ * @param object This is a pointer to the object, which now belongs to the list.
+ * @param size This is the size of the object in bytes.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool ll_addOwned(struct linkedList* list, void* object, ll_size_t size){
+	bool completed = false;
+
+	// Checks all parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (object != NULL) && (size != 0) && (list->sorted == NULL)){
+		ll_linkNode(list, ll_wrapNode(list, object, size, LL_PAYLOAD_OWNED), NULL);
+		if(list->changes != NULL){
+			ll_logChange(list, LL_CHANGE_ADD, 0, size, object);
+		}
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function adds an element to the end of the list without copying it. The object still
+ * belongs to the caller.
+ * @param list This is a pointer to the list to add to.
+ * @param object This is a pointer to the object to store.
+ * @param size This is the size of the object in bytes.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool ll_addBorrowed(struct linkedList* list, void* object, ll_size_t size){
+	bool completed = false;
+
+	// Checks all parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (object != NULL) && (size != 0) && (list->sorted == NULL)){
+		ll_linkNode(list, ll_wrapNode(list, object, size, LL_PAYLOAD_BORROWED), NULL);
+		if(list->changes != NULL){
+			ll_logChange(list, LL_CHANGE_ADD, 0, size, object);
+		}
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function removes the element at an index and hands its data to the caller without
+ * copying it.
+ * @param list This is a pointer to the list to remove from.
+ * @param index This is the index to remove the element from.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data, or NULL if the remove failed.
+ */
+void* ll_take(struct linkedList* list, ll_size_t index, ll_size_t* size){
+	void* data = NULL;
+
+	// Check if the parameters are valid to avoid null pointer dereferencing and index out of bounds errors
+	if((list != NULL) && (index < list->size)){
+		struct listNode* node = ll_nodeAt(list, index);
+
+		if(list->changes != NULL){
+			ll_logChange(list, LL_CHANGE_REMOVE, index, 1, NULL);
+		}
+
+		ll_unlinkNode(list, node);
+		data = ll_takeData(list, node, size);
+	}
+
+	return data;
+}
+
+/**
+ * This function hands the data of the element at an index to the caller while leaving the
+ * element in the list.
+ * @param list This is a pointer to the list holding the element.
+ * @param index This is the index of the element.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data, or NULL if the index is out of range.
+ */
+void* ll_detach(struct linkedList* list, ll_size_t index, ll_size_t* size){
+	void* data = NULL;
+
+	// Check if the parameters are valid to avoid null pointer dereferencing and index out of bounds errors
+	if((list != NULL) && (index < list->size)){
+		struct listNode* node = ll_nodeAt(list, index);
+
+		// Shared data belongs to the other elements too, so the caller gets a private copy
+		if((node->flags & LL_PAYLOAD_MASK) == LL_PAYLOAD_INTERNED){
+			ll_unshareNode(list, node);
+		}
+
+		// Packed data is expanded first so the element holds a copy of its own to hand over
+		if((node->flags & LL_PAYLOAD_MASK) == LL_PAYLOAD_COMPRESSED){
+			ll_expandNode(node);
+		}
+
+		ll_chargeNode(list, node, false);
+
+		// Inline data goes away with the node, so the element keeps borrowing a copy instead
+		if((node->flags & LL_PAYLOAD_MASK) == LL_PAYLOAD_INLINE){
+			void* copy = malloc(node->dataSize);
+			memcpy(copy, node->data, node->dataSize);
+			__atomic_store_n(&node->data, copy, __ATOMIC_RELEASE);
+		}
+
+		data = node->data;
+		if(size != NULL){
+			*size = node->dataSize;
+		}
+
+		// The list no longer frees the data
+		node->flags = (node->flags & ~LL_PAYLOAD_MASK) | LL_PAYLOAD_BORROWED;
+		ll_chargeNode(list, node, true);
+	}
+
+	return data;
+}
+
+/**
+ * This function copies the data of every element back to back into one buffer. Payloads that
+ * already sit next to each other in memory are copied with a single memcpy.
+ * @param list This is a pointer to the list to export.
+ * @param buffer This is a pointer to the buffer to fill, or NULL to allocate one.
+ * @param bufferSize This is the size of the buffer in bytes, ignored if buffer is NULL.
+ * @param offsets This is an array of ll_size(list) + 1 entries that receives the offset of
+ *                every element followed by the total size, may be NULL.
+ * @param totalSize This is a pointer that receives the number of bytes needed, may be NULL.
+ * @return This returns a pointer to the filled buffer, or NULL if it failed.
+ */
+void* ll_toArray(struct linkedList* list, void* buffer, ll_size_t bufferSize, ll_size_t* offsets, ll_size_t* totalSize){
+	void* result = NULL;
+
+	// Checks if the list parameter is NULL to avoid a null pointer dereference
+	if((list != NULL) && (list->size != 0)){
+		struct listNode* node = list->head;
+		uint64_t total = 0;
+
+		// Add up the sizes first so the buffer can be checked or allocated in one go
+		while(node != NULL){
+			__builtin_prefetch(node->nextNode);
+			total = total + node->dataSize;
+			node = node->nextNode;
+		}
+
+		if(totalSize != NULL){
+			*totalSize = (total <= LL_SIZE_MAX) ? (ll_size_t)total : LL_SIZE_MAX;
+		}
+
+		if(total <= LL_SIZE_MAX){
+			if(buffer == NULL){
+				result = malloc(total);
+			}
+			else if(bufferSize >= total){
+				result = buffer;
+			}
+		}
+
+		if(result != NULL){
+			const char* runStart = NULL;
+			ll_size_t runLength = 0;
+			ll_size_t position = 0;
+			ll_size_t i = 0;
+
+			for(node = list->head; node != NULL; node = node->nextNode){
+				const char* data = (const char*)ll_nodeData(node);
+
+				if(node->nextNode != NULL){
+					__builtin_prefetch(node->nextNode);
+					__builtin_prefetch(node->nextNode->data);
+				}
+				if(offsets != NULL){
+					offsets[i] = position + runLength;
+				}
+
+				// Extend the current run if this payload follows it in memory, otherwise flush it
+				if((runStart != NULL) && ((runStart + runLength) == data)){
+					runLength = runLength + node->dataSize;
+				}
+				else{
+					if(runLength != 0){
+						memcpy((char*)result + position, runStart, runLength);
+						position = position + runLength;
+					}
+					runStart = data;
+					runLength = node->dataSize;
+				}
+
+				i = i + 1;
+			}
+
+			memcpy((char*)result + position, runStart, runLength);
+			if(offsets != NULL){
+				offsets[i] = position + runLength;
+			}
+		}
+	}
+
+	return result;
+}
+
+/**
+ * This function rounds a position in the data of an array node block up to the alignment an
+ * element needs. An object is at most aligned to the largest power of two dividing its size,
+ * so smaller elements are packed tighter than malloc would place them.
+ * @param position This is the offset of the first free byte.
+ * @param size This is the size of the element in bytes.
+ * @return This returns the offset to store the element at.
+ */
+static size_t ll_alignArrayData(size_t position, ll_size_t size){
+	size_t alignment = (size_t)(size & (~size + 1));
+
+	if(alignment > _Alignof(max_align_t)){
+		alignment = _Alignof(max_align_t);
+	}
+
+	return (position + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * This function copies elements stored back to back in a buffer into one array node block and
+ * appends their nodes to a list. The block takes elements until every slot is used or its data
+ * would grow past LL_ARRAY_BLOCK_BYTES, but always at least one.
+ * @param list This is a pointer to the list to append to.
+ * @param bytes This is a pointer to the buffer.
+ * @param offsets This is an array where element i spans offsets[i] to offsets[i + 1], or NULL if every element is elementSize bytes.
+ * @param first This is the index of the first element to copy.
+ * @param count This is the number of elements in the buffer.
+ * @param elementSize This is the size of every element in bytes, ignored if offsets is given.
+ * @return This returns the index of the first element left for the next block.
+ */
+static ll_size_t ll_importBlock(struct linkedList* list, const char* bytes, const ll_size_t* offsets, ll_size_t first,
+		ll_size_t count, ll_size_t elementSize){
+	size_t alignment = _Alignof(max_align_t);
+	size_t position = 0;
+	size_t header;
+	ll_size_t end = first;
+	bool full = false;
+	struct arrayNodeBlock* block;
+	char* data;
+
+	// Lay out the data first to know how many elements fit and how large the block is
+	while((end < count) && !full){
+		ll_size_t size = (offsets != NULL) ? (offsets[end + 1] - offsets[end]) : elementSize;
+		size_t start = ll_alignArrayData(position, size);
+
+		full = (end != first) && ((start + size) > LL_ARRAY_BLOCK_BYTES);
+		if(!full){
+			position = start + size;
+			end = end + 1;
+			full = ((end - first) == LL_ARRAY_BLOCK_NODES);
+		}
+	}
+
+	// The data starts behind the node slots at the alignment malloc guarantees
+	header = offsetof(struct arrayNodeBlock, nodes) + ((size_t)(end - first) * sizeof(struct listNode));
+	header = (header + alignment - 1) & ~(alignment - 1);
+	block = (struct arrayNodeBlock*)malloc(header + position);
+	data = (char*)block + header;
+
+	block->state = (uint32_t)(((uint64_t)1 << (end - first)) - 1);
+	position = 0;
+	for(ll_size_t i = first; i < end; i++){
+		struct listNode* node = &block->nodes[i - first];
+		size_t source = (offsets != NULL) ? offsets[i] : ((size_t)i * elementSize);
+		ll_size_t size = (offsets != NULL) ? (offsets[i + 1] - offsets[i]) : elementSize;
+
+		position = ll_alignArrayData(position, size);
+		memcpy(data + position, bytes + source, size);
+		node->data = data + position;
+		node->dataSize = size;
+		node->flags = LL_PAYLOAD_INLINE | LL_NODE_ARRAY | ((uint32_t)(i - first) << LL_NODE_SLOT_SHIFT);
+		ll_linkNode(list, node, NULL);
+		position = position + size;
+	}
+
+	return end;
+}
+
+/**
+ * This function appends the elements stored back to back in a buffer to the end of a list.
+ * @param list This is a pointer to the list to add to.
+ * @param buffer This is a pointer to the elements.
+ * @param offsets This is an array of count + 1 offsets where element i spans offsets[i] to
+ *                offsets[i + 1], or NULL if every element is elementSize bytes.
+ * @param count This is the number of elements in the buffer.
+ * @param elementSize This is the size of every element in bytes, ignored if offsets is given.
+ * @return This returns true if every element was added, false if nothing was added.
+ */
+bool ll_fromArray(struct linkedList* list, const void* buffer, const ll_size_t* offsets, ll_size_t count, ll_size_t elementSize){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (buffer != NULL) && ((offsets != NULL) || (elementSize != 0)) && (list->sorted == NULL)){
+		bool valid = true;
+
+		// Empty elements cannot be added, so reject the whole buffer before anything is allocated
+		for(ll_size_t i = 0; (i < count) && (offsets != NULL) && valid; i++){
+			valid = (offsets[i + 1] > offsets[i]);
+		}
+
+		if(valid){
+			struct linkedList pending;
+			const char* bytes = (const char*)buffer;
+
+			// Build the chain off to the side and splice it in at once
+			ll_init(&pending);
+
+			if(list->interned != NULL){
+				for(ll_size_t i = 0; i < count; i++){
+					size_t start = (offsets != NULL) ? offsets[i] : ((size_t)i * elementSize);
+					ll_size_t size = (offsets != NULL) ? (offsets[i + 1] - offsets[i]) : elementSize;
+
+					// Shared data lives in the table, so the node holds no data of its own
+					ll_linkNode(&pending, ll_wrapNode(list, ll_intern(list, bytes + start, size), size, LL_PAYLOAD_INTERNED), NULL);
+				}
+			}
+			else{
+				ll_size_t next = 0;
+
+				while(next < count){
+					next = ll_importBlock(&pending, bytes, offsets, next, count, elementSize);
+				}
+			}
+
+			ll_transfer(list, &pending, count);
+			completed = true;
+		}
+	}
+
+	return completed;
+}
+
+/**
+ * This function switches sorted mode on or off for an empty list.
+ * @param list This is a pointer to the list to configure, which must be empty.
+ * @param compare This is the function ordering two elements, or NULL to switch sorted mode off.
+ * @return This returns true if the mode was changed, false if it failed.
+ */
+bool ll_setSorted(struct linkedList* list, int (*compare)(const void* a, const void* b)){
+	bool completed = false;
+
+	// Check if list is NULL to avoid null pointer dereferencing, packed payloads cannot be compared
+	// and sorted insertions are not recorded in the change log
+	if((list != NULL) && (list->size == 0) && ((compare == NULL) || ((list->cold == NULL) && (list->changes == NULL)))){
+		if((compare != NULL) && (list->sorted == NULL)){
+			list->sorted = (struct sortedIndex*)malloc(sizeof(struct sortedIndex));
+			list->sorted->levels = 0;
+			list->sorted->random = 0x9E3779B97F4A7C15ull ^ (uint64_t)(uintptr_t)list;
+			list->sorted->head = (struct skipTower*)calloc(1, sizeof(struct skipTower) + (LL_SKIP_MAX_LEVELS * sizeof(struct skipTower*)));
+			ll_chargeIndex(list, list->sorted, 0, true);
+			ll_chargeIndex(list, list->sorted->head, 0, true);
+		}
+		else if((compare == NULL) && (list->sorted != NULL)){
+			ll_chargeIndex(list, list->sorted->head, 0, false);
+			ll_chargeIndex(list, list->sorted, 0, false);
+			free(list->sorted->head);
+			free(list->sorted);
+			list->sorted = NULL;
+		}
+
+		if(list->sorted != NULL){
+			list->sorted->compare = compare;
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function adds a copy of an object to a sorted list behind every element that is not
+ * greater than it.
+ * @param list This is a pointer to the sorted list to add to.
+ * @param object This is a pointer to the object to be added to the list.
+ * @param size This is the size of the object being added in bytes.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool ll_insertSorted(struct linkedList* list, const void* object, ll_size_t size){
+	bool completed = false;
+
+	// Checks all parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (object != NULL) && (size != 0) && (list->sorted != NULL)){
+		struct sortedIndex* index = list->sorted;
+		struct skipTower* update[LL_SKIP_MAX_LEVELS];
+		struct listNode* before = ll_skipFind(list, object, true, update);
+		struct listNode* node = ll_newNode(list, object, size);
+		uint32_t height = ll_skipHeight(index);
+
+		ll_linkNode(list, node, before);
+
+		if(height != 0){
+			struct skipTower* tower = (struct skipTower*)malloc(sizeof(struct skipTower) + (height * sizeof(struct skipTower*)));
+
+			ll_chargeIndex(list, tower, 0, true);
+
+			// New levels start out at the head tower
+			for(uint32_t level = index->levels; level < height; level++){
+				update[level] = index->head;
+			}
+			if(height > index->levels){
+				index->levels = height;
+			}
+
+			tower->node = node;
+			for(uint32_t level = 0; level < height; level++){
+				tower->next[level] = update[level]->next[level];
+				update[level]->next[level] = tower;
+			}
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function moves an iterator to the first element of a sorted list that is not less than
+ * a key.
+ * @param list This is a pointer to the sorted list to search.
+ * @param key This is a pointer to the key.
+ * @param iter This is a pointer to the iterator to move.
+ * @return This returns true if such an element exists, false otherwise.
+ */
+bool ll_lowerBound(struct linkedList* list, const void* key, struct linkedListIterator* iter){
+	bool found = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (key != NULL) && (iter != NULL) && (list->sorted != NULL)){
+		struct skipTower* update[LL_SKIP_MAX_LEVELS];
+
+		iter->current = ll_skipFind(list, key, false, update);
+		iter->previous = (iter->current != NULL) ? iter->current->prevNode : list->tail;
+		found = (iter->current != NULL);
+	}
+
+	return found;
+}
+
+/**
+ * This function removes the first element of a sorted list that is equal to a key.
+ * @param list This is a pointer to the sorted list to remove from.
+ * @param key This is a pointer to the key.
+ * @return This returns true if an element was removed, false otherwise.
+ */
+bool ll_removeValue(struct linkedList* list, const void* key){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (key != NULL) && (list->sorted != NULL)){
+		struct skipTower* update[LL_SKIP_MAX_LEVELS];
+		struct listNode* node = ll_skipFind(list, key, false, update);
+
+		if((node != NULL) && (list->sorted->compare(node->data, key) == 0)){
+			ll_unlinkNode(list, node);
+			ll_releaseNode(list, node);
+			completed = true;
+		}
+	}
+
+	return completed;
+}
+
+/**
+ * This function switches interning on or off for an empty list.
+ * @param list This is a pointer to the list to configure, which must be empty.
+ * @param enabled This is true to intern payloads, false to stop and free the table.
+ * @return This returns true if the mode was changed, false if it failed.
+ */
+bool ll_setInterning(struct linkedList* list, bool enabled){
+	bool completed = false;
+
+	// Check if list is NULL to avoid null pointer dereferencing, shared payloads rule out readers
+	if((list != NULL) && (list->size == 0) && !list->concurrentReaders){
+		if(enabled && (list->interned == NULL)){
+			list->interned = ll_newInternTable();
+			ll_chargeIndex(list, list->interned, 0, true);
+			ll_chargeIndex(list, list->interned->slots, 0, true);
+		}
+		else if(!enabled && (list->interned != NULL)){
+			ll_chargeIndex(list, list->interned->slots, 0, false);
+			ll_chargeIndex(list, list->interned, 0, false);
+			ll_freeInternTable(list->interned);
+			list->interned = NULL;
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function gets the data of an element for writing, copying shared data first.
+ * @param list This is a pointer to the list to get from.
+ * @param index This is the index of the element.
+ * @return This returns a pointer to data that only this element uses, or NULL if the index is
+ *         out of range.
+ */
+void* ll_getMutable(struct linkedList* list, ll_size_t index){
+	void* result = NULL;
+
+	// Check if the parameters are valid values to avoid null pointer dereferences and index out of bounds errors
+	if((list != NULL) && (index < list->size)){
+		struct listNode* node = ll_nodeAt(list, index);
+
+		// Even data used by this element alone is taken out of the table, since writing to it
+		// would leave it filed under the wrong hash
+		if((node->flags & LL_PAYLOAD_MASK) == LL_PAYLOAD_INTERNED){
+			ll_unshareNode(list, node);
+		}
+
+		result = ll_readNode(list, node);
+	}
+
+	return result;
+}
+
+/**
+ * This function reads the counters of a list that interns payloads.
+ * @param list This is a pointer to the list.
+ * @param stats This is a pointer to the structure that receives the counters.
+ * @return This returns true if the counters were read, false if the list does not intern.
+ */
+bool ll_internStats(struct linkedList* list, struct internStats* stats){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (stats != NULL) && (list->interned != NULL)){
+		*stats = list->interned->stats;
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function switches deferred reclamation on or off for a list.
+ * @param list This is a pointer to the list to configure.
+ * @param enabled This is true to hand removed nodes to the reclaim queue, false to free them
+ *                on the calling thread.
+ * @return This returns true if the mode was changed, false if it failed.
+ */
+bool ll_setDeferredReclaim(struct linkedList* list, bool enabled){
+	bool completed = false;
+
+	// Check if list is NULL to avoid null pointer dereferencing, the reclaimer cannot free packed payloads
+	if((list != NULL) && (!enabled || (list->cold == NULL))){
+		list->deferredReclaim = enabled;
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function removes a run of consecutive elements from a list.
+ * @param list This is a pointer to the list to remove from.
+ * @param index This is the index of the first element to remove.
+ * @param count This is the number of elements to remove.
+ * @return This returns the number of elements removed, which is less than count if the list
+ *         ends first.
+ */
+ll_size_t ll_removeRange(struct linkedList* list, ll_size_t index, ll_size_t count){
+	ll_size_t removed = 0;
+
+	// Check if the parameters are valid to avoid null pointer dereferencing and index out of bounds errors
+	if((list != NULL) && (index < list->size) && (count != 0)){
+		struct listNode* first = ll_nodeAt(list, index);
+		struct listNode* last = first;
+		struct memoryUsage charge = {0};
+
+		removed = ((list->size - index) < count) ? (list->size - index) : count;
+		if(list->changes != NULL){
+			ll_logChange(list, LL_CHANGE_REMOVE, index, removed, NULL);
+		}
+
+		// The index, shared payloads and memory counters belong to the list, so they are updated
+		// here either way
+		for(ll_size_t i = 0; i < removed; i++){
+			if(i != 0){
+				last = last->nextNode;
+			}
+			ll_nodeCharge(last, &charge);
+			if(list->sorted != NULL){
+				ll_unindexNode(list, last);
+			}
+			if(list->deferredReclaim && ((last->flags & LL_PAYLOAD_MASK) == LL_PAYLOAD_INTERNED)){
+				ll_releaseInterned(list, last->data);
+				last->flags = (last->flags & ~LL_PAYLOAD_MASK) | LL_PAYLOAD_BORROWED;
+			}
+		}
+
+		// Splice the run out in one step, leaving its next node pointers intact for readers
+		if(last->nextNode != NULL){
+			last->nextNode->prevNode = first->prevNode;
+		}
+		else{
+			list->tail = first->prevNode;
+		}
+		if(first->prevNode != NULL){
+			__atomic_store_n(&first->prevNode->nextNode, last->nextNode, __ATOMIC_RELEASE);
+		}
+		else{
+			__atomic_store_n(&list->head, last->nextNode, __ATOMIC_RELEASE);
+		}
+
+		list->size = list->size - removed;
+		ll_charge(&list->nodeUsage, &charge, false);
+		if(list->size == 0){
+			ll_dropSmallNodes(list);
+		}
+
+		if(list->deferredReclaim){
+			ll_queueReclaim(ll_newReclaimBatch(list, first, removed));
+		}
+		else{
+			struct listNode* node = first;
+
+			for(ll_size_t i = 0; i < removed; i++){
+				struct listNode* temp = node;
+				node = node->nextNode;
+				ll_releaseNode(list, temp);
+			}
+		}
+	}
+
+	return removed;
+}
+
+/**
+ * This function frees nodes waiting in the reclaim queue on the calling thread.
+ * @param budget This is the largest number of nodes to free.
+ * @return This returns the number of nodes freed, 0 if the queue is empty.
+ */
+size_t ll_reclaimStep(size_t budget){
+	size_t freed = 0;
+	bool empty = false;
+
+	while((freed < budget) && !empty){
+		struct reclaimBatch* batch;
+
+		// Take the oldest batch out of the queue so other threads can work on the next one
+		pthread_mutex_lock(&reclaimLock);
+		batch = reclaimHead;
+		if(batch != NULL){
+			reclaimHead = batch->next;
+			if(reclaimHead == NULL){
+				reclaimTail = NULL;
+			}
+		}
+		pthread_mutex_unlock(&reclaimLock);
+
+		if(batch != NULL){
+			freed = freed + ll_reclaimBatch(batch, budget - freed);
+
+			if((batch->count == 0) && (batch->retired == NULL) && (batch->towers == NULL)){
+				free(batch);
+			}
+			else{
+				// The budget ran out, so the rest of the batch goes back to the front of the queue
+				pthread_mutex_lock(&reclaimLock);
+				batch->next = reclaimHead;
+				reclaimHead = batch;
+				if(reclaimTail == NULL){
+					reclaimTail = batch;
+				}
+				pthread_mutex_unlock(&reclaimLock);
+			}
+		}
+		else{
+			empty = true;
+		}
+	}
+
+	return freed;
+}
+
+/**
+ * This function starts a background thread that frees the nodes in the reclaim queue.
+ * @return This returns true if the reclaimer is running, false if it could not be started.
+ */
+bool ll_startReclaimer(void){
+	bool completed = true;
+
+	pthread_mutex_lock(&reclaimLock);
+	if(!reclaimRunning){
+		reclaimRunning = true;
+		if(pthread_create(&reclaimThread, NULL, ll_reclaimerMain, NULL) != 0){
+			reclaimRunning = false;
+			completed = false;
+		}
+	}
+	pthread_mutex_unlock(&reclaimLock);
+
+	return completed;
+}
+
+/**
+ * This function stops the background reclaimer once it has emptied the reclaim queue.
+ */
+void ll_stopReclaimer(void){
+	bool running;
+
+	pthread_mutex_lock(&reclaimLock);
+	running = reclaimRunning;
+	reclaimRunning = false;
+	pthread_cond_signal(&reclaimReady);
+	pthread_mutex_unlock(&reclaimLock);
+
+	if(running){
+		pthread_join(reclaimThread, NULL);
+	}
+}
+
+/**
+ * This structure is an item of a mutation batch. The items form a treap ordered by position,
+ * which stands for the list as it will look after the queued operations. An item is either a
+ * run of elements already in the list or one element queued for insertion.
+ */
+struct batchItem {
+	uint32_t left; // The item holding the elements in front of this one, 0 if there is none
+	uint32_t right; // The item holding the elements behind this one, 0 if there is none
+	uint32_t priority; // The heap priority that keeps the treap balanced
+	ll_size_t total; // The number of elements held by this item and the items below it
+	ll_size_t start; // The index in the list of the first element of a run
+	ll_size_t count; // The number of elements in the run, 1 for an inserted element
+	struct listNode* node; // The node queued for insertion, NULL for a run
+};
+
+/**
+ * This structure is a batch of positional mutations queued for a list.
+ */
+struct listBatch {
+	struct linkedList* list; // The list the operations are applied to
+	struct batchItem* items; // The items of the treap, item 0 is unused so 0 can mean none
+	uint32_t itemCount; // The number of items in use, including item 0
+	uint32_t capacity; // The number of items allocated
+	uint32_t root; // The item at the root of the treap, 0 if the batch holds no elements
+	ll_size_t size; // The size the list will have after the queued operations
+	uint32_t random; // The state of the generator for item priorities
+};
+
+/**
+ * This function returns the number of elements held by an item and the items below it.
+ * @param batch This is a pointer to the batch.
+ * @param item This is the item, may be 0.
+ * @return This returns the number of elements.
+ */
+static ll_size_t ll_batchTotal(struct listBatch* batch, uint32_t item){
+	return (item != 0) ? batch->items[item].total : 0;
+}
+
+/**
+ * This function recomputes the element count of an item from the items below it.
+ * @param batch This is a pointer to the batch.
+ * @param item This is the item.
+ */
+static void ll_batchUpdate(struct listBatch* batch, uint32_t item){
+	struct batchItem* entry = &batch->items[item];
+
+	entry->total = ll_batchTotal(batch, entry->left) + entry->count + ll_batchTotal(batch, entry->right);
+}
+
+/**
+ * This function creates an item in a batch. The caller must have made room for it.
+ * @param batch This is a pointer to the batch.
+ * @param start This is the index of the first element of a run.
+ * @param count This is the number of elements in the run, 1 for an inserted element.
+ * @param node This is a pointer to the node queued for insertion, NULL for a run.
+ * @return This returns the new item.
+ */
+static uint32_t ll_batchItem(struct listBatch* batch, ll_size_t start, ll_size_t count, struct listNode* node){
+	uint32_t item = batch->itemCount;
+	struct batchItem* entry = &batch->items[item];
+
+	batch->random ^= batch->random << 13;
+	batch->random ^= batch->random >> 17;
+	batch->random ^= batch->random << 5;
+
+	entry->left = 0;
+	entry->right = 0;
+	entry->priority = batch->random;
+	entry->total = count;
+	entry->start = start;
+	entry->count = count;
+	entry->node = node;
+	batch->itemCount = batch->itemCount + 1;
+
+	return item;
+}
+
+/**
+ * This function splits a treap so the first elements end up in one part and the rest in the
+ * other. A run crossing the split is cut into two items, so the caller must have made room for
+ * one more item.
+ * @param batch This is a pointer to the batch.
+ * @param item This is the root of the treap to split, may be 0.
+ * @param position This is the number of elements that go into the first part.
+ * @param front This is a pointer that receives the root of the first part.
+ * @param back This is a pointer that receives the root of the second part.
+ */
+static void ll_batchSplit(struct listBatch* batch, uint32_t item, ll_size_t position, uint32_t* front, uint32_t* back){
+	if(item == 0){
+		*front = 0;
+		*back = 0;
+	}
+	else{
+		ll_size_t before = ll_batchTotal(batch, batch->items[item].left);
+
+		if(position <= before){
+			ll_batchSplit(batch, batch->items[item].left, position, front, &batch->items[item].left);
+			*back = item;
+		}
+		else if(position >= (before + batch->items[item].count)){
+			ll_batchSplit(batch, batch->items[item].right, position - before - batch->items[item].count, &batch->items[item].right, back);
+			*front = item;
+		}
+		else{
+			// Cut the run, the second half takes over the right subtree and the priority
+			ll_size_t cut = position - before;
+			uint32_t rest = ll_batchItem(batch, batch->items[item].start + cut, batch->items[item].count - cut, NULL);
+
+			batch->items[rest].priority = batch->items[item].priority;
+			batch->items[rest].right = batch->items[item].right;
+			batch->items[item].right = 0;
+			batch->items[item].count = cut;
+			ll_batchUpdate(batch, rest);
+			*front = item;
+			*back = rest;
+		}
+
+		ll_batchUpdate(batch, item);
+	}
+}
+
+/**
+ * This function joins two treaps, with the elements of the first in front of the second.
+ * @param batch This is a pointer to the batch.
+ * @param front This is the root of the first treap, may be 0.
+ * @param back This is the root of the second treap, may be 0.
+ * @return This returns the root of the joined treap.
+ */
+static uint32_t ll_batchMerge(struct listBatch* batch, uint32_t front, uint32_t back){
+	uint32_t root;
+
+	if((front == 0) || (back == 0)){
+		root = (front != 0) ? front : back;
+	}
+	else if(batch->items[front].priority >= batch->items[back].priority){
+		batch->items[front].right = ll_batchMerge(batch, batch->items[front].right, back);
+		ll_batchUpdate(batch, front);
+		root = front;
+	}
+	else{
+		batch->items[back].left = ll_batchMerge(batch, front, batch->items[back].left);
+		ll_batchUpdate(batch, back);
+		root = back;
+	}
+
+	return root;
+}
+
+/**
+ * This function makes sure a batch has room for a number of new items.
+ * @param batch This is a pointer to the batch.
+ * @param needed This is the number of items about to be created.
+ */
+static void ll_batchReserve(struct listBatch* batch, uint32_t needed){
+	if((batch->itemCount + needed) > batch->capacity){
+		batch->capacity = (batch->capacity * 2) + needed;
+		batch->items = (struct batchItem*)realloc(batch->items, batch->capacity * sizeof(struct batchItem));
+	}
+}
+
+/**
+ * This function frees a batch and every node it still holds.
+ * @param batch This is a pointer to the batch.
+ * @param freeNodes This is true to free the nodes queued for insertion.
+ */
+static void ll_batchFree(struct listBatch* batch, bool freeNodes){
+	if(freeNodes){
+		// Queued nodes that are no longer in the treap were freed when they were removed
+		for(uint32_t item = 1; item < batch->itemCount; item++){
+			if(batch->items[item].node != NULL){
+				ll_freeNode(batch->list, batch->items[item].node);
+			}
+		}
+	}
+
+	free(batch->items);
+	free(batch);
+}
+
+/**
+ * This function starts a batch of positional mutations for a list.
+ * @param list This is a pointer to the list the mutations are for.
+ * @return This returns a pointer to the new batch, or NULL if list is NULL.
+ */
+struct listBatch* ll_batchBegin(struct linkedList* list){
+	struct listBatch* batch = NULL;
+
+	// Check if list is NULL to avoid null pointer dereferencing, the change log records single operations
+	if((list != NULL) && (list->changes == NULL)){
+		batch = (struct listBatch*)malloc(sizeof(struct listBatch));
+		batch->list = list;
+		batch->capacity = 16;
+		batch->items = (struct batchItem*)malloc(batch->capacity * sizeof(struct batchItem));
+		batch->itemCount = 1;
+		batch->root = 0;
+		batch->size = list->size;
+		batch->random = 0x9E3779B9u;
+
+		// The whole list starts out as a single run
+		if(list->size != 0){
+			batch->root = ll_batchItem(batch, 0, list->size, NULL);
+		}
+	}
+
+	return batch;
+}
+
+/**
+ * This function queues the insertion of an element into a batch.
+ * @param batch This is a pointer to the batch.
+ * @param object This is a pointer to the object to be added to the list.
+ * @param size This is the size of the object being added in bytes.
+ * @param index This is the index to add the object at, given as if every earlier operation of
+ *              the batch had been applied.
+ * @return This returns true if the insertion was queued, false if it would fail.
+ */
+bool ll_batchAddIndex(struct listBatch* batch, const void* object, ll_size_t size, ll_size_t index){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferencing and index out of bounds errors
+	if((batch != NULL) && (object != NULL) && (size != 0) && (index <= batch->size) && (batch->list->sorted == NULL)){
+		uint32_t front;
+		uint32_t back;
+		uint32_t item;
+
+		ll_batchReserve(batch, 2);
+		ll_batchSplit(batch, batch->root, index, &front, &back);
+		item = ll_batchItem(batch, 0, 1, ll_newNode(batch->list, object, size));
+		batch->root = ll_batchMerge(batch, ll_batchMerge(batch, front, item), back);
+		batch->size = batch->size + 1;
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function queues the removal of an element into a batch.
+ * @param batch This is a pointer to the batch.
+ * @param index This is the index to remove the element from, given as if every earlier
+ *              operation of the batch had been applied.
+ * @return This returns true if the removal was queued, false if it would fail.
+ */
+bool ll_batchRemove(struct listBatch* batch, ll_size_t index){
+	bool completed = false;
+
+	// Check if the parameters are valid to avoid null pointer dereferencing and index out of bounds errors
+	if((batch != NULL) && (index < batch->size)){
+		uint32_t front;
+		uint32_t middle;
+		uint32_t back;
+
+		ll_batchReserve(batch, 2);
+		ll_batchSplit(batch, batch->root, index, &front, &middle);
+		ll_batchSplit(batch, middle, 1, &middle, &back);
+
+		// A queued node is freed now, an element of the list is removed by leaving it out
+		if(batch->items[middle].node != NULL){
+			ll_freeNode(batch->list, batch->items[middle].node);
+			batch->items[middle].node = NULL;
+		}
+
+		batch->root = ll_batchMerge(batch, front, back);
+		batch->size = batch->size - 1;
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function applies the operations of a batch to its list in one forward walk and frees
+ * the batch.
+ * @param batch This is a pointer to the batch.
+ * @return This returns true if the batch was applied, false if batch is NULL.
+ */
+bool ll_batchCommit(struct listBatch* batch){
+	bool completed = false;
+
+	// Check if batch is NULL to avoid null pointer dereferencing
+	if(batch != NULL){
+		struct linkedList* list = batch->list;
+		uint32_t* stack = (uint32_t*)malloc(batch->itemCount * sizeof(uint32_t));
+		uint32_t depth = 0;
+		uint32_t item = batch->root;
+		struct listNode* current = list->head; // The first element of the list not yet passed
+		ll_size_t position = 0; // The index the current element had when the batch began
+		ll_size_t original = list->size;
+
+		// Visit the items in order: runs of kept elements are walked over, the elements between
+		// them are removed and queued nodes are linked in front of the current element
+		while((item != 0) || (depth != 0)){
+			if(item != 0){
+				stack[depth] = item;
+				depth = depth + 1;
+				item = batch->items[item].left;
+			}
+			else{
+				struct batchItem* entry;
+
+				depth = depth - 1;
+				item = stack[depth];
+				entry = &batch->items[item];
+
+				if(entry->node != NULL){
+					ll_linkNode(list, entry->node, current);
+					entry->node = NULL;
+				}
+				else{
+					while(position < entry->start){
+						struct listNode* removed = current;
+
+						current = current->nextNode;
+						position = position + 1;
+						ll_unlinkNode(list, removed);
+						ll_releaseNode(list, removed);
+					}
+					while(position < (entry->start + entry->count)){
+						current = current->nextNode;
+						position = position + 1;
+					}
+				}
+
+				item = entry->right;
+			}
+		}
+
+		// Every element behind the last kept run was removed
+		while(position < original){
+			struct listNode* removed = current;
+
+			current = current->nextNode;
+			position = position + 1;
+			ll_unlinkNode(list, removed);
+			ll_releaseNode(list, removed);
+		}
+
+		free(stack);
+		ll_batchFree(batch, false);
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function drops a batch without applying it.
+ * @param batch This is a pointer to the batch, may be NULL.
+ */
+void ll_batchCancel(struct listBatch* batch){
+	// Check if batch is NULL to avoid null pointer dereferencing
+	if(batch != NULL){
+		ll_batchFree(batch, true);
+	}
+}
+
+/**
+ * This function adds up memory counters that other threads may be changing, and works out the
+ * slack and fragmentation of the total.
+ * @param counters This is a pointer to the counters.
+ * @param usage This is a pointer to the structure the counters are added to.
+ */
+static void ll_readCharges(struct memoryUsage* counters, struct memoryUsage* usage){
+	usage->payloadBytes = usage->payloadBytes + __atomic_load_n(&counters->payloadBytes, __ATOMIC_RELAXED);
+	usage->nodeBytes = usage->nodeBytes + __atomic_load_n(&counters->nodeBytes, __ATOMIC_RELAXED);
+	usage->indexBytes = usage->indexBytes + __atomic_load_n(&counters->indexBytes, __ATOMIC_RELAXED);
+	usage->borrowedBytes = usage->borrowedBytes + __atomic_load_n(&counters->borrowedBytes, __ATOMIC_RELAXED);
+	usage->allocatedBytes = usage->allocatedBytes + __atomic_load_n(&counters->allocatedBytes, __ATOMIC_RELAXED);
+
+	// Small nodes moved in from another list are paid for by its block, which can leave the
+	// receiving list with more in use than it allocated
+	uint64_t used = usage->payloadBytes + usage->nodeBytes + usage->indexBytes;
+	usage->slackBytes = (usage->allocatedBytes > used) ? (usage->allocatedBytes - used) : 0;
+	usage->fragmentation = (usage->allocatedBytes != 0) ? ((double)usage->slackBytes / (double)usage->allocatedBytes) : 0.0;
+}
+
+/**
+ * This function reads the memory used by a list.
+ * @param list This is a pointer to the list.
+ * @param usage This is a pointer to the structure that receives the memory used.
+ * @return This returns true if the memory used was read, false if a parameter is NULL.
+ */
+bool ll_memoryUsage(struct linkedList* list, struct memoryUsage* usage){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (usage != NULL)){
+		memset(usage, 0, sizeof(struct memoryUsage));
+		ll_readCharges(&list->nodeUsage, usage);
+		ll_readCharges(&list->indexUsage, usage);
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function reads the memory used by every list of the process together.
+ * @param usage This is a pointer to the structure that receives the memory used.
+ * @return This returns true if the memory used was read, false if usage is NULL.
+ */
+bool ll_processMemoryUsage(struct memoryUsage* usage){
+	bool completed = false;
+
+	// Check if usage is NULL to avoid null pointer dereferencing
+	if(usage != NULL){
+		memset(usage, 0, sizeof(struct memoryUsage));
+
+		pthread_mutex_lock(&usageLock);
+		ll_readCharges(&exitedUsage, usage);
+		for(struct usageShard* shard = usageShards; shard != NULL; shard = shard->next){
+			ll_readCharges(&shard->usage, usage);
+		}
+		pthread_mutex_unlock(&usageLock);
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function switches cold compression on or off for a list.
+ * @param list This is a pointer to the list to configure.
+ * @param enabled This is true to allow compression, false to expand everything and stop.
+ * @param hotWindow This is the number of elements at each end of the list that stay expanded.
+ * @return This returns true if the mode was changed, false if it failed.
+ */
+bool ll_setColdCompression(struct linkedList* list, bool enabled, ll_size_t hotWindow){
+	bool completed = false;
+
+	// Check if list is NULL to avoid null pointer dereferencing, packed payloads rule out
+	// readers, the reclaimer and the skip index
+	if((list != NULL) && (!enabled || (!list->concurrentReaders && !list->deferredReclaim && (list->sorted == NULL)))){
+		if(enabled && (list->cold == NULL)){
+			list->cold = (struct coldState*)calloc(1, sizeof(struct coldState));
+			pthread_mutex_init(&list->cold->expandLock, NULL);
+			ll_chargeIndex(list, list->cold, 0, true);
+		}
+		else if(!enabled && (list->cold != NULL)){
+			ll_expandCold(list);
+			ll_chargeIndex(list, list->cold, 0, false);
+			pthread_mutex_destroy(&list->cold->expandLock);
+			free(list->cold);
+			list->cold = NULL;
+		}
+
+		if(list->cold != NULL){
+			list->cold->hotWindow = hotWindow;
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function packs cold elements of a list into compressed segments. Runs of neighbouring
+ * elements with copied data are cut into segments of at most LL_COLD_SEGMENT_NODES elements
+ * and LL_COLD_SEGMENT_BYTES bytes, and an element that was expanded since the previous pass
+ * ends the run it would have joined.
+ * @param list This is a pointer to a list with cold compression on.
+ * @return This returns the number of elements packed.
+ */
+ll_size_t ll_compressCold(struct linkedList* list){
+	ll_size_t packed = 0;
+
+	// Check if list is NULL to avoid null pointer dereferencing, and skip lists that fit the hot window
+	if((list != NULL) && (list->cold != NULL) && (list->size > list->cold->hotWindow) &&
+			((list->size - list->cold->hotWindow) > list->cold->hotWindow)){
+		ll_size_t end = list->size - list->cold->hotWindow;
+		struct listNode* node = ll_nodeAt(list, list->cold->hotWindow);
+		struct listNode* runStart = NULL;
+		uint32_t runLength = 0;
+		uint32_t runBytes = 0;
+
+		for(ll_size_t i = list->cold->hotWindow; i < end; i++){
+			struct listNode* next = node->nextNode;
+			bool cold = ((node->flags & LL_PAYLOAD_MASK) == LL_PAYLOAD_COPY) && ((node->flags & LL_NODE_TOUCHED) == 0) &&
+					(node->dataSize <= LL_COLD_SEGMENT_BYTES);
+
+			// An element read since the last pass gets until the next one to be read again
+			node->flags = node->flags & ~LL_NODE_TOUCHED;
+
+			// Close the run when this element ends it or would not fit the segment
+			if((runLength != 0) && (!cold || (runLength == LL_COLD_SEGMENT_NODES) || ((runBytes + node->dataSize) > LL_COLD_SEGMENT_BYTES))){
+				packed = packed + ll_packRun(list, runStart, runLength, runBytes);
+				runLength = 0;
+				runBytes = 0;
+			}
+
+			if(cold){
+				if(runLength == 0){
+					runStart = node;
+				}
+				runLength = runLength + 1;
+				runBytes = runBytes + (uint32_t)node->dataSize;
+			}
+
+			node = next;
+		}
+
+		if(runLength != 0){
+			packed = packed + ll_packRun(list, runStart, runLength, runBytes);
+		}
+	}
+
+	return packed;
+}
+
+/**
+ * This function expands every compressed segment of a list.
+ * @param list This is a pointer to the list.
+ * @return This returns the number of elements expanded.
+ */
+ll_size_t ll_expandCold(struct linkedList* list){
+	ll_size_t expanded = 0;
+
+	// Check if list is NULL to avoid null pointer dereferencing, and skip lists with nothing packed
+	if((list != NULL) && (list->cold != NULL) && (list->cold->stats.packedElements != 0)){
+		expanded = list->cold->stats.packedElements;
+
+		for(struct listNode* node = list->head; node != NULL; node = node->nextNode){
+			if((node->flags & LL_PAYLOAD_MASK) == LL_PAYLOAD_COMPRESSED){
+				ll_expandNode(node);
+			}
+		}
+	}
+
+	return expanded;
+}
+
+/**
+ * This function reads the counters of cold compression for a list.
+ * @param list This is a pointer to the list.
+ * @param stats This is a pointer to the structure that receives the counters.
+ * @return This returns true if the counters were read, false if compression is off.
+ */
+bool ll_coldStats(struct linkedList* list, struct coldStats* stats){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (list->cold != NULL) && (stats != NULL)){
+		*stats = list->cold->stats;
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function switches change tracking on or off for a list.
+ * @param list This is a pointer to the list to configure.
+ * @param enabled This is true to record changes, false to stop and free the change log.
+ * @return This returns true if the mode was changed, false if it failed.
+ */
+bool ll_setChangeTracking(struct linkedList* list, bool enabled){
+	bool completed = false;
+
+	// Check if list is NULL to avoid null pointer dereferencing, sorted insertions are not recorded
+	if((list != NULL) && (!enabled || (list->sorted == NULL))){
+		if(enabled && (list->changes == NULL)){
+			list->changes = (struct changeLog*)calloc(1, sizeof(struct changeLog));
+			list->changes->firstSequence = 1;
+			ll_chargeIndex(list, list->changes, 0, true);
+		}
+		else if(!enabled && (list->changes != NULL)){
+			ll_chargeIndex(list, list->changes->bytes, 0, false);
+			ll_chargeIndex(list, list->changes->offsets, 0, false);
+			ll_chargeIndex(list, list->changes, 0, false);
+			free(list->changes->bytes);
+			free(list->changes->offsets);
+			free(list->changes);
+			list->changes = NULL;
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function returns the sequence number of the last change recorded for a list.
+ * @param list This is a pointer to the list.
+ * @return This returns the sequence number, or 0 if nothing was recorded or the list does not
+ *         track changes.
+ */
+uint64_t ll_changeSequence(struct linkedList* list){
+	uint64_t sequence = 0;
+
+	// Check if list is NULL to avoid null pointer dereferencing
+	if((list != NULL) && (list->changes != NULL)){
+		sequence = list->changes->firstSequence + list->changes->count - 1;
+	}
+
+	return sequence;
+}
+
+/**
+ * This function serializes the changes recorded for a list after a given sequence number.
+ * @param list This is a pointer to a list that tracks changes.
+ * @param since This is the sequence number of the last change the replica has applied.
+ * @param buffer This is a pointer to the buffer to fill, or NULL to have the function allocate
+ *               one that the caller must free.
+ * @param bufferSize This is the size of the buffer in bytes, ignored if buffer is NULL.
+ * @param totalSize This is a pointer that receives the size of the delta, may be NULL.
+ * @return This returns a pointer to the delta, or NULL if the changes are no longer kept or
+ *         the buffer is too small.
+ */
+void* ll_exportDelta(struct linkedList* list, uint64_t since, void* buffer, ll_size_t bufferSize, ll_size_t* totalSize){
+	void* result = NULL;
+
+	// Check the parameters for valid values, a delta can only start where the log still reaches
+	if((list != NULL) && (list->changes != NULL) && (since >= list->changes->oldestSince) && (since <= ll_changeSequence(list))){
+		struct changeLog* log = list->changes;
+		struct deltaHeader header;
+		size_t skip = (since >= log->firstSequence) ? (size_t)(since + 1 - log->firstSequence) : 0;
+		size_t start = (skip < log->count) ? log->offsets[skip] : log->used;
+		uint64_t total = sizeof(struct deltaHeader) + (log->used - start);
+
+		if(totalSize != NULL){
+			*totalSize = (total <= LL_SIZE_MAX) ? (ll_size_t)total : LL_SIZE_MAX;
+		}
+
+		if(total <= LL_SIZE_MAX){
+			if(buffer == NULL){
+				result = malloc(total);
+			}
+			else if(bufferSize >= total){
+				result = buffer;
+			}
+		}
+
+		if(result != NULL){
+			header.magic = LL_DELTA_MAGIC;
+			header.version = LL_DELTA_VERSION;
+			header.firstSequence = log->firstSequence + skip;
+			header.count = log->count - skip;
+			memcpy(result, &header, sizeof(header));
+			memcpy((char*)result + sizeof(header), log->bytes + start, log->used - start);
+		}
+	}
+
+	return result;
+}
+
+/**
+ * This function replays a delta exported by ll_exportDelta on a replica.
+ * @param replica This is a pointer to the list the changes are applied to.
+ * @param delta This is a pointer to the delta.
+ * @param size This is the size of the delta in bytes.
+ * @param sequence This is a pointer to the sequence number of the last change the replica has
+ *                 applied, which is moved to the last change applied from the delta.
+ * @return This returns true if every change was applied, false if the delta is damaged, does
+ *         not follow on from the replica or a change did not fit the replica.
+ */
+bool ll_applyDelta(struct linkedList* replica, const void* delta, ll_size_t size, uint64_t* sequence){
+	bool completed = false;
+	struct deltaHeader header;
+
+	// Check the parameters for valid values to avoid reading past the delta
+	if((replica != NULL) && (delta != NULL) && (sequence != NULL) && (size >= sizeof(header))){
+		memcpy(&header, delta, sizeof(header));
+
+		if((header.magic == LL_DELTA_MAGIC) && (header.version == LL_DELTA_VERSION)){
+			const unsigned char* in = (const unsigned char*)delta + sizeof(header);
+			const unsigned char* end = (const unsigned char*)delta + size;
+			uint64_t applied = 0;
+			bool valid;
+
+			// A delta must start right after the replica, except one starting with a clear, which
+			// replaces everything before it and only must not take the replica back
+			valid = (header.firstSequence == (*sequence + 1)) || ((header.count != 0) && (in < end) &&
+					(*in == LL_CHANGE_CLEAR) && (header.firstSequence > *sequence));
+
+			// Apply the changes in order as they are read
+			while(valid && (applied < header.count)){
+				valid = (in < end) && ll_applyChange(replica, &in, end);
+				if(valid){
+					applied = applied + 1;
+				}
+			}
+
+			if(applied != 0){
+				*sequence = header.firstSequence + applied - 1;
+			}
+			completed = valid && (in == end);
+		}
+	}
+
+	return completed;
+}
+
+/**
+ * This function drops the changes every replica has applied from the change log of a list.
+ * @param list This is a pointer to a list that tracks changes.
+ * @param sequence This is the sequence number of the last change to drop.
+ * @return This returns true if the changes were dropped, false if the sequence number was not
+ *         recorded yet.
+ */
+bool ll_trimChanges(struct linkedList* list, uint64_t sequence){
+	bool completed = false;
+
+	// Check if list is NULL to avoid null pointer dereferencing, and keep changes not recorded yet
+	if((list != NULL) && (list->changes != NULL) && (sequence <= ll_changeSequence(list))){
+		struct changeLog* log = list->changes;
+
+		if(sequence >= log->firstSequence){
+			size_t drop = (size_t)(sequence + 1 - log->firstSequence);
+			size_t start = (drop < log->count) ? log->offsets[drop] : log->used;
+
+			memmove(log->bytes, log->bytes + start, log->used - start);
+			for(size_t i = drop; i < log->count; i++){
+				log->offsets[i - drop] = log->offsets[i] - start;
+			}
+			log->used = log->used - start;
+			log->count = log->count - drop;
+			log->firstSequence = log->firstSequence + drop;
+
+			// A replica behind the dropped changes can still catch up if a clear comes next
+			log->oldestSince = ((log->count != 0) && (log->bytes[0] == LL_CHANGE_CLEAR)) ? 0 : sequence;
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
@@ -1,124 +1,913 @@
-/**
- * This file contains the interface for the linked list file. THis includes
- * defining all of the necessary structures and functions.
- * @file linkedlist.h
- * @author Max Kallenberger
- * @date September 17, 2017
- */
-
-#ifndef LINKEDLIST_H
-#define LINKEDLIST_H
-
-#include <stdbool.h>
-#include <stdint.h>
-#include <stddef.h>
-#include <malloc.h>
-#include <string.h>
-
-/**
- * This structure holds the data and links needed for an element in a linked list.
- */
-struct  listNode {
-  void* data; // A pointer to the data contained within the node
-  uint32_t dataSize; // The size of the data in the node
-  struct listNode* nextNode; // A pointer to the next node in the linked list
-  struct listNode* prevNode; // A pointer to the previous node in the linked list
-};
-
-/**
- * This structure is a linked list data structure that can be manipulated through function calls.
- */
-struct linkedList
-{
-  struct listNode* head; // A pointer to the first node in the linked list
-  struct listNode* tail; // A pointer to the last node in the linked list
-  uint32_t size; // The number of nodes in the linked list
-
-};
-
-/**
- * This structure provides the elements needed to iterate through the linked list data structure.
- */
-struct linkedListIterator
-{
-  struct listNode* current; // A pointer to the node the iterator is currently at
-};
-
-/**
- * This function initializes the elements in the linkedList structure to default values.
- * @param list This is a pointer to the list to initialize.
- */
-void ll_init(struct linkedList* list);
-
-/**
- * This function adds an element to the linked list at the end of the list.
- * @param list This is a pointer to the list to add to.
- * @param object This is a pointer to the object to be added to the list.
- * @param size This is the size of the object being added in bytes.
- * @return This returns true if the add was successful, false if it failed.
- */
-bool ll_add(struct linkedList* list, const void* object, uint32_t size);
-
-/**
- * This function adds an element to the linked list at the desired index.
- * @param list This is a pointer to the list to add to.
- * @param object This is a pointer to the object to be added to the list.
- * @param size This is the size of the object being added in bytes.
- * @param index This is the index to add the object at.
- * @return This returns true if the add was successful, false if it failed.
- */
-bool ll_addIndex(struct linkedList* list, const void* object, uint32_t size, uint32_t index);
-
-/**
- * This function removes an object from the list at a given index.
- * @param list This is a pointer to the list to remove from.
- * @param index This is the index to remove the object from.
- * @return This returns true if the remove was successful, false if it failed.
- */
-bool ll_remove(struct linkedList* list, uint32_t index);
-
-/**
- * This function gets the object from the desired list index.
- * @param list This is a pointer to the list to get the object from.
- * @param index This is the index to get the object from.
- */
-void* ll_get(struct linkedList* list, uint32_t index);
-
-/**
- * This function frees the memory allocated for the nodes and data of objects in the list.
- * The elements of the linkedList structure are reinitialized to their default values.
- * @param list This is a pointer to the list to be cleared.
- */
-void ll_clear(struct linkedList* list);
-
-/**
- * This function returns the size element of the linked list structure.
- * @param list This is a pointer to the list to return the size of.
- * @return This returns the size of the list (the number of objects contained in the list).
- */
-uint32_t ll_size(struct linkedList* list);
-
-/**
- * This function creates an iterator for a given linked list. The iterator starts at the head of the list.
- * @param list This is a pointer to the list used to create the iterator.
- * @return This returns a pointer to the linkedListIterator structure if the iterator generated correctly,
- * 	       else it returns NULL.
- */
-struct linkedListIterator* ll_getIterator(struct linkedList* list);
-
-/**
- * This function determines if an iterator has another element or more data to retrieve.
- * @param iter This is a pointer to the iterator check.
- * @return This returns true if there is another element or more data has not been retrieved,
- * 		   else it returns false.
- */
-bool ll_hasNext(struct linkedListIterator* iter);
-
-/**
- * This function gets the data stored in the current node of the iterator and iterates to
- * the next node in the list.
- * @param iter This is a pointer to the iterator to access the data of and iterate.
- */
-void* ll_next(struct linkedListIterator* iter);
-
-#endif /*LINKEDLIST_H*/
+/**
+ * This file contains the interface for the linked list file. THis includes
+ * defining all of the necessary structures and functions.
+ * @file linkedlist.h
+ * @author Max Kallenberger
+ * @date September 17, 2017
+ */
+
+#ifndef LINKEDLIST_H
+#define LINKEDLIST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <malloc.h>
+#include <string.h>
+
+/**
+ * This is the type of element counts, indexes and payload sizes. It is 32 bits wide by default,
+ * which keeps nodes small. Building the library and everything using it with LL_LARGE_LISTS
+ * makes it 64 bits wide for lists of more than 4 billion elements or payloads of more than
+ * 4 GB, at the cost of 8 more bytes per node.
+ */
+#ifdef LL_LARGE_LISTS
+typedef uint64_t ll_size_t;
+#define LL_SIZE_MAX UINT64_MAX
+#else
+typedef uint32_t ll_size_t;
+#define LL_SIZE_MAX UINT32_MAX
+#endif
+
+/**
+ * These values describe who owns the data of a node. They are stored in the flags of the node.
+ */
+#define LL_PAYLOAD_COPY 0x0u // The data is a copy made by the list and is freed with free
+#define LL_PAYLOAD_OWNED 0x1u // The data was handed to the list and is freed with the payload destructor
+#define LL_PAYLOAD_BORROWED 0x2u // The data belongs to the caller and is never freed by the list
+#define LL_PAYLOAD_INLINE 0x3u // The data is stored in the same allocation as the node and is freed with it
+#define LL_PAYLOAD_INTERNED 0x4u // The data is shared with equal elements of the list and reference counted
+#define LL_PAYLOAD_COMPRESSED 0x5u // The data is packed into a cold segment that data points to, see ll_nodeData
+#define LL_PAYLOAD_MASK 0xFu // Selects the payload kind from the flags of a node
+
+/**
+ * These values describe where the memory of a node comes from. They are stored in the flags of
+ * the node next to the payload kind.
+ */
+#define LL_NODE_SMALL 0x10u // The node is a slot of a small node block instead of its own allocation
+#define LL_NODE_POOLED 0x20u // The node came from the shared node pool
+#define LL_NODE_SLOT_SHIFT 8u // The slot number of a small or array node is stored in the flags from this bit up to LL_NODE_EXPANDING
+#define LL_NODE_TOUCHED 0x40u // The data was read through the list or expanded from a cold segment since the last compression pass
+#define LL_NODE_ARRAY 0x80u // The node and its data are a slot of a block filled by ll_fromArray
+#define LL_NODE_EXPANDING 0x8000u // A reader claimed the compressed node and is expanding its cold segment
+#define LL_NODE_MEMBER_SHIFT 16u // The position of a compressed node in its cold segment is stored from this bit on
+
+struct smallNodeBlock;
+struct sortedIndex;
+struct internTable;
+struct listBatch;
+struct coldState;
+struct changeLog;
+
+/**
+ * This structure holds the data and links needed for an element in a linked list.
+ */
+struct  listNode {
+  void* data; // A pointer to the data contained within the node
+  ll_size_t dataSize; // The size of the data in the node
+  uint32_t flags; // The payload kind of the data in the node and where the node is stored
+  struct listNode* nextNode; // A pointer to the next node in the linked list
+  struct listNode* prevNode; // A pointer to the previous node in the linked list
+};
+
+/**
+ * This structure describes the memory used by a list or by every list together, see
+ * ll_memoryUsage. The byte counts are kept up to date by the operations that change them.
+ */
+struct memoryUsage
+{
+  uint64_t payloadBytes; // The bytes of element data owned by the list, shared data counted once
+  uint64_t nodeBytes; // The bytes of node headers
+  uint64_t indexBytes; // The bytes of bookkeeping: small node blocks, skip index and interning table
+  uint64_t borrowedBytes; // The bytes of borrowed data the elements point at but do not own
+  uint64_t allocatedBytes; // The bytes the allocator handed out for all of the above except borrowed data
+  uint64_t slackBytes; // The allocated bytes holding none of the above: rounding and unused node slots
+  double fragmentation; // The share of the allocated bytes that is slack, from 0 to 1
+};
+
+/**
+ * This structure is a linked list data structure that can be manipulated through function calls.
+ */
+struct linkedList
+{
+  struct listNode* head; // A pointer to the first node in the linked list
+  struct listNode* tail; // A pointer to the last node in the linked list
+  ll_size_t size; // The number of nodes in the linked list
+  bool concurrentReaders; // True if lock-free readers may traverse the list while one thread writes to it
+  struct listNode* retired; // Removed nodes waiting for a grace period to end before they are freed
+  uint32_t retiredCount; // The number of nodes in the retired chain
+  void (*payloadDestructor)(void*); // Frees data handed over with ll_addOwned, NULL to use free
+  struct smallNodeBlock* smallNodes; // The contiguous block the first nodes are taken from, NULL if there is none
+  struct sortedIndex* sorted; // The skip index of a sorted list, NULL if the list is not sorted
+  struct internTable* interned; // The table of shared payloads, NULL if the list does not intern payloads
+  bool deferredReclaim; // True if ll_clear and ll_removeRange leave freeing the nodes to the reclaim queue
+  struct memoryUsage nodeUsage; // The memory of the linked nodes and the data only they use
+  struct memoryUsage indexUsage; // The memory of the small node block, skip index and shared payloads
+  struct coldState* cold; // The settings and counters of cold compression, NULL if it is off
+  struct changeLog* changes; // The changes recorded for replicas, NULL if changes are not tracked
+
+};
+
+/**
+ * This structure provides the elements needed to iterate through the linked list data structure.
+ */
+struct linkedListIterator
+{
+  struct listNode* current; // A pointer to the node the iterator is currently at
+  struct listNode* previous; // A pointer to the node ll_prev returns, NULL at the front of the list
+};
+
+/**
+ * This function initializes the elements in the linkedList structure to default values.
+ * @param list This is a pointer to the list to initialize.
+ */
+void ll_init(struct linkedList* list);
+
+/**
+ * This function adds an element to the linked list at the end of the list.
+ * @param list This is a pointer to the list to add to.
+ * @param object This is a pointer to the object to be added to the list.
+ * @param size This is the size of the object being added in bytes.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool ll_add(struct linkedList* list, const void* object, ll_size_t size);
+
+/**
+ * This function adds an element to the linked list at the desired index.
+ * @param list This is a pointer to the list to add to.
+ * @param object This is a pointer to the object to be added to the list.
+ * @param size This is the size of the object being added in bytes.
+ * @param index This is the index to add the object at.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool ll_addIndex(struct linkedList* list, const void* object, ll_size_t size, ll_size_t index);
+
+/**
+ * This function removes an object from the list at a given index.
+ * @param list This is a pointer to the list to remove from.
+ * @param index This is the index to remove the object from.
+ * @return This returns true if the remove was successful, false if it failed.
+ */
+bool ll_remove(struct linkedList* list, ll_size_t index);
+
+/**
+ * This function gets the object from the desired list index.
+ * @param list This is a pointer to the list to get the object from.
+ * @param index This is the index to get the object from.
+ */
+void* ll_get(struct linkedList* list, ll_size_t index);
+
+/**
+ * This function frees the memory allocated for the nodes and data of objects in the list.
+ * The elements of the linkedList structure are reinitialized to their default values. With
+ * deferred reclamation the nodes are only detached and freed later, see ll_setDeferredReclaim.
+ * @param list This is a pointer to the list to be cleared.
+ */
+void ll_clear(struct linkedList* list);
+
+/**
+ * This function creates an iterator for a given linked list. The iterator starts at the head of the list.
+ * @param list This is a pointer to the list used to create the iterator.
+ * @return This returns a pointer to the linkedListIterator structure if the iterator generated correctly,
+ * 	       else it returns NULL.
+ */
+struct linkedListIterator* ll_getIterator(struct linkedList* list);
+
+/**
+ * This function expands the cold segment a compressed node is packed in, giving every element
+ * of the segment its own copy of its data again. Threads reading the same list may call it at
+ * once: the first to claim the node expands its segment under the lock of the list, and the
+ * others wait until the node holds its data again.
+ * @param node This is a pointer to a node whose payload kind is LL_PAYLOAD_COMPRESSED.
+ * @return This returns a pointer to the data of the node.
+ */
+void* ll_expandNode(struct listNode* node);
+
+/**
+ * This function returns the data of a node. Code that walks the nodes of a list itself must
+ * read the data through this rather than the data member, since a node packed into a cold
+ * segment only holds a pointer to the segment until it is expanded.
+ * @param node This is a pointer to the node.
+ * @return This returns a pointer to the data of the node.
+ */
+static inline void* ll_nodeData(struct listNode* node){
+	return ((__atomic_load_n(&node->flags, __ATOMIC_ACQUIRE) & LL_PAYLOAD_MASK) == LL_PAYLOAD_COMPRESSED) ?
+			ll_expandNode(node) : node->data;
+}
+
+/**
+ * Defining LL_INLINE_FAST_PATH before including this header turns ll_size, ll_hasNext and
+ * ll_next into static inline functions, so iterating does not cost a call per element. The
+ * library always exports out-of-line versions as well, so code built either way links with it.
+ */
+#if defined(LL_INLINE_FAST_PATH) && !defined(LL_IMPLEMENTATION)
+
+/**
+ * This function returns the size element of the linked list structure.
+ * @param list This is a pointer to the list to return the size of.
+ * @return This returns the size of the list (the number of objects contained in the list).
+ */
+static inline ll_size_t ll_size(struct linkedList* list){
+	return (list != NULL) ? list->size : 0;
+}
+
+/**
+ * This function determines if an iterator has another element or more data to retrieve.
+ * @param iter This is a pointer to the iterator check.
+ * @return This returns true if there is another element or more data has not been retrieved,
+ * 		   else it returns false.
+ */
+static inline bool ll_hasNext(struct linkedListIterator* iter){
+	return (iter != NULL) && (iter->current != NULL);
+}
+
+/**
+ * This function gets the data stored in the current node of the iterator and iterates to
+ * the next node in the list.
+ * @param iter This is a pointer to the iterator to access the data of and iterate.
+ */
+static inline void* ll_next(struct linkedListIterator* iter){
+	void* data = NULL;
+
+	if((iter != NULL) && (iter->current != NULL)){
+		data = ll_nodeData(iter->current);
+		iter->previous = iter->current;
+		iter->current = __atomic_load_n(&iter->current->nextNode, __ATOMIC_ACQUIRE);
+	}
+
+	return data;
+}
+
+#else
+
+/**
+ * This function returns the size element of the linked list structure.
+ * @param list This is a pointer to the list to return the size of.
+ * @return This returns the size of the list (the number of objects contained in the list).
+ */
+ll_size_t ll_size(struct linkedList* list);
+
+/**
+ * This function determines if an iterator has another element or more data to retrieve.
+ * @param iter This is a pointer to the iterator check.
+ * @return This returns true if there is another element or more data has not been retrieved,
+ * 		   else it returns false.
+ */
+bool ll_hasNext(struct linkedListIterator* iter);
+
+/**
+ * This function gets the data stored in the current node of the iterator and iterates to
+ * the next node in the list.
+ * @param iter This is a pointer to the iterator to access the data of and iterate.
+ */
+void* ll_next(struct linkedListIterator* iter);
+
+#endif /*LL_INLINE_FAST_PATH*/
+
+/**
+ * This function creates an iterator positioned in front of the element at an index, so the
+ * next call to ll_next returns that element and the next call to ll_prev returns the one
+ * before it. The iterator is found by walking from whichever end of the list is nearer.
+ * @param list This is a pointer to the list used to create the iterator.
+ * @param index This is the index of the element, ll_size(list) to start at the end.
+ * @return This returns a pointer to the iterator, which the caller must free, or NULL if the
+ *         index is out of range.
+ */
+struct linkedListIterator* ll_getIteratorAt(struct linkedList* list, ll_size_t index);
+
+/**
+ * This function creates an iterator positioned at the end of a list, so repeated calls to
+ * ll_prev walk the list from the tail to the head.
+ * @param list This is a pointer to the list used to create the iterator.
+ * @return This returns a pointer to the iterator, which the caller must free, or NULL if the
+ *         list is NULL.
+ */
+struct linkedListIterator* ll_getReverseIterator(struct linkedList* list);
+
+/**
+ * This function determines if an iterator has an element before it.
+ * @param iter This is a pointer to the iterator to check.
+ * @return This returns true if ll_prev has an element to return, else it returns false.
+ */
+bool ll_hasPrev(struct linkedListIterator* iter);
+
+/**
+ * This function moves an iterator back by one element and gets the data of that element.
+ * Concurrent readers must not move iterators backwards.
+ * @param iter This is a pointer to the iterator to move.
+ * @return This returns a pointer to the data, or NULL if the iterator is at the front.
+ */
+void* ll_prev(struct linkedListIterator* iter);
+
+/**
+ * This function moves an iterator forward by a number of elements.
+ * @param iter This is a pointer to the iterator to move.
+ * @param count This is the number of elements to move past.
+ * @return This returns the number of elements moved past, which is less than count if the
+ *         end of the list was reached.
+ */
+ll_size_t ll_advance(struct linkedListIterator* iter, ll_size_t count);
+
+/**
+ * This function moves an iterator back by a number of elements.
+ * @param iter This is a pointer to the iterator to move.
+ * @param count This is the number of elements to move back past.
+ * @return This returns the number of elements moved back past, which is less than count if
+ *         the front of the list was reached.
+ */
+ll_size_t ll_retreat(struct linkedListIterator* iter, ll_size_t count);
+
+/**
+ * This function adds an element to the linked list at the front of the list.
+ * @param list This is a pointer to the list to add to.
+ * @param object This is a pointer to the object to be added to the list.
+ * @param size This is the size of the object being added in bytes.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool ll_pushFront(struct linkedList* list, const void* object, ll_size_t size);
+
+/**
+ * This function removes the first element of the list and hands its data to the caller
+ * without copying it.
+ * @param list This is a pointer to the list to remove from.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data, which now belongs to the caller unless it was
+ *         added with ll_addBorrowed, or NULL if the list is empty.
+ */
+void* ll_popFront(struct linkedList* list, ll_size_t* size);
+
+/**
+ * This function removes the last element of the list and hands its data to the caller
+ * without copying it.
+ * @param list This is a pointer to the list to remove from.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data, which now belongs to the caller unless it was
+ *         added with ll_addBorrowed, or NULL if the list is empty.
+ */
+void* ll_popBack(struct linkedList* list, ll_size_t* size);
+
+/**
+ * This function gets the data of the first element of the list without removing it.
+ * @param list This is a pointer to the list to look at.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data, or NULL if the list is empty.
+ */
+void* ll_peekFront(struct linkedList* list, ll_size_t* size);
+
+/**
+ * This function gets the data of the last element of the list without removing it.
+ * @param list This is a pointer to the list to look at.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data, or NULL if the list is empty.
+ */
+void* ll_peekBack(struct linkedList* list, ll_size_t* size);
+
+/**
+ * This function sets the function used to free data handed to the list with ll_addOwned.
+ * Lists that exchange owned elements through ll_transfer should use the same destructor.
+ * @param list This is a pointer to the list to configure.
+ * @param destructor This is the function that frees owned data, or NULL to use free.
+ * @return This returns true if the destructor was set, false if it failed.
+ */
+bool ll_setPayloadDestructor(struct linkedList* list, void (*destructor)(void*));
+
+/**
+ * This function adds an element to the end of the list without copying it. The list takes
+ * ownership of the object and frees it with the payload destructor when the element is removed.
+ * @param list This is a pointer to the list to add to.
+ * @param object This is a pointer to the object, which now belongs to the list.
+ * @param size This is the size of the object in bytes.
+ * @return This returns true if the add was successful, false if it failed, in which case the
+ *         caller still owns the object.
+ */
+bool ll_addOwned(struct linkedList* list, void* object, ll_size_t size);
+
+/**
+ * This function adds an element to the end of the list without copying it. The object still
+ * belongs to the caller, who must keep it alive for as long as it is in the list.
+ * @param list This is a pointer to the list to add to.
+ * @param object This is a pointer to the object to store.
+ * @param size This is the size of the object in bytes.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool ll_addBorrowed(struct linkedList* list, void* object, ll_size_t size);
+
+/**
+ * This function removes the element at an index and hands its data to the caller without
+ * copying it.
+ * @param list This is a pointer to the list to remove from.
+ * @param index This is the index to remove the element from.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data, which now belongs to the caller unless it was
+ *         added with ll_addBorrowed, or NULL if the remove failed.
+ */
+void* ll_take(struct linkedList* list, ll_size_t index, ll_size_t* size);
+
+/**
+ * This function hands the data of the element at an index to the caller while leaving the
+ * element in the list. From then on the element borrows the data, so the caller must keep it
+ * alive for as long as the element is in the list.
+ * @param list This is a pointer to the list holding the element.
+ * @param index This is the index of the element.
+ * @param size This is a pointer that receives the size of the data, may be NULL.
+ * @return This returns a pointer to the data, which now belongs to the caller unless it was
+ *         added with ll_addBorrowed, or NULL if the index is out of range.
+ */
+void* ll_detach(struct linkedList* list, ll_size_t index, ll_size_t* size);
+
+/**
+ * This function moves elements from the front of one list to the end of another without
+ * copying or allocating anything. Moving a whole list takes constant time. Copied data moved
+ * into an interning list is interned, which walks the moved elements.
+ * @param dest This is a pointer to the list the elements are appended to.
+ * @param src This is a pointer to the list the elements are taken from.
+ * @param count This is the maximum number of elements to move.
+ * @return This returns the number of elements moved.
+ */
+ll_size_t ll_transfer(struct linkedList* dest, struct linkedList* src, ll_size_t count);
+
+/**
+ * This function starts a batch of positional mutations for a list. Insertions and removals
+ * queued with ll_batchAddIndex and ll_batchRemove take their indexes as if every earlier
+ * operation of the batch had already been applied, exactly like a sequence of ll_addIndex and
+ * ll_remove calls, and ll_batchCommit then applies all of them in a single walk over the list.
+ * The list must not be changed by anything else until the batch is committed or cancelled.
+ * @param list This is a pointer to the list the mutations are for.
+ * @return This returns a pointer to the new batch, or NULL if list is NULL or tracks changes.
+ */
+struct listBatch* ll_batchBegin(struct linkedList* list);
+
+/**
+ * This function queues the insertion of an element. The object is copied straight away.
+ * @param batch This is a pointer to the batch.
+ * @param object This is a pointer to the object to be added to the list.
+ * @param size This is the size of the object being added in bytes.
+ * @param index This is the index to add the object at.
+ * @return This returns true if the insertion was queued, false if ll_addIndex would fail at
+ *         this point of the sequence.
+ */
+bool ll_batchAddIndex(struct listBatch* batch, const void* object, ll_size_t size, ll_size_t index);
+
+/**
+ * This function queues the removal of an element.
+ * @param batch This is a pointer to the batch.
+ * @param index This is the index to remove the element from.
+ * @return This returns true if the removal was queued, false if ll_remove would fail at this
+ *         point of the sequence.
+ */
+bool ll_batchRemove(struct listBatch* batch, ll_size_t index);
+
+/**
+ * This function applies the queued operations to the list and frees the batch. It takes
+ * O(n + k log k) time for k operations on a list of n elements.
+ * @param batch This is a pointer to the batch.
+ * @return This returns true if the batch was applied, false if batch is NULL.
+ */
+bool ll_batchCommit(struct listBatch* batch);
+
+/**
+ * This function frees a batch without applying it.
+ * @param batch This is a pointer to the batch, may be NULL.
+ */
+void ll_batchCancel(struct listBatch* batch);
+
+/**
+ * This function copies the data of every element back to back into one buffer. Data of
+ * neighbouring elements that already lies back to back, as ll_fromArray stores it, is copied
+ * in one go.
+ * @param list This is a pointer to the list to export.
+ * @param buffer This is a pointer to the buffer to fill, or NULL to have the function allocate
+ *               one that the caller must free.
+ * @param bufferSize This is the size of the buffer in bytes, ignored if buffer is NULL.
+ * @param offsets This is an array of ll_size(list) + 1 entries that receives the offset of
+ *                every element followed by the total size, may be NULL.
+ * @param totalSize This is a pointer that receives the number of bytes needed, may be NULL.
+ * @return This returns a pointer to the filled buffer, or NULL if the list is empty, the buffer
+ *         is too small or the data takes more than LL_SIZE_MAX bytes.
+ */
+void* ll_toArray(struct linkedList* list, void* buffer, ll_size_t bufferSize, ll_size_t* offsets, ll_size_t* totalSize);
+
+/**
+ * This function appends the elements stored back to back in a buffer to the end of a list.
+ * The nodes are allocated in blocks of up to 32 together with their data, which takes one
+ * allocation per block instead of two per element, and a block is freed once all of its
+ * elements are gone. Elements are only aligned as far as their size needs, so elements of the
+ * same size sit back to back and ll_toArray copies them out again in one go. The data of an
+ * interning list is interned as ll_add would.
+ * @param list This is a pointer to the list to add to.
+ * @param buffer This is a pointer to the elements.
+ * @param offsets This is an array of count + 1 offsets where element i spans offsets[i] to
+ *                offsets[i + 1], or NULL if every element is elementSize bytes.
+ * @param count This is the number of elements in the buffer.
+ * @param elementSize This is the size of every element in bytes, ignored if offsets is given.
+ * @return This returns true if every element was added, false if nothing was added.
+ */
+bool ll_fromArray(struct linkedList* list, const void* buffer, const ll_size_t* offsets, ll_size_t count, ll_size_t elementSize);
+
+/**
+ * This function finds the first element equal to a key. Elements are compared as 4 or 8 byte
+ * integers, and elements whose size differs from the key never match. Payloads are gathered
+ * into blocks and compared with the widest vector instructions the processor supports.
+ * @param list This is a pointer to the list to search.
+ * @param key This is a pointer to the key.
+ * @param keySize This is the size of the key in bytes, 4 or 8.
+ * @param index This is a pointer that receives the index of the element, may be NULL.
+ * @return This returns true if an equal element was found, false otherwise.
+ */
+bool ll_findEq(struct linkedList* list, const void* key, uint32_t keySize, ll_size_t* index);
+
+/**
+ * This function counts the elements equal to a key. Elements are compared as 4 or 8 byte
+ * integers, and elements whose size differs from the key never match.
+ * @param list This is a pointer to the list to search.
+ * @param key This is a pointer to the key.
+ * @param keySize This is the size of the key in bytes, 4 or 8.
+ * @return This returns the number of equal elements.
+ */
+ll_size_t ll_count(struct linkedList* list, const void* key, uint32_t keySize);
+
+/**
+ * This function finds the first element greater than a key. Elements are compared as signed
+ * 4 or 8 byte integers, and elements whose size differs from the key never match.
+ * @param list This is a pointer to the list to search.
+ * @param key This is a pointer to the key.
+ * @param keySize This is the size of the key in bytes, 4 or 8.
+ * @param index This is a pointer that receives the index of the element, may be NULL.
+ * @return This returns true if a greater element was found, false otherwise.
+ */
+bool ll_findFirstGreater(struct linkedList* list, const void* key, uint32_t keySize, ll_size_t* index);
+
+/**
+ * This function calls a function for every element of the list, splitting the list into
+ * segments of about equal length that run on the shared thread pool. The list must not be
+ * changed until the call returns. The calling thread walks segments too. Calls from several
+ * threads share the pool at the same time, and the function may itself walk another list in
+ * parallel: the nested call queues its segments on the worker it runs on and walks what no
+ * idle worker takes, so it neither waits for the outer call nor deadlocks.
+ * @param list This is a pointer to the list to walk.
+ * @param function This is the function called with the data, size and context of each element.
+ * @param context This is passed to every call of the function.
+ * @param threads This is the number of threads to spread the work over, 0 to use all processors.
+ * @return This returns true if the function was called for every element, false if it failed.
+ */
+bool ll_parallelForEach(struct linkedList* list, void (*function)(void* data, ll_size_t size, void* context),
+		void* context, uint32_t threads);
+
+/**
+ * This function folds every element of the list into a result, splitting the list into segments
+ * that are reduced in parallel on the shared thread pool. Each segment starts from a copy of the
+ * identity held in the result, and the partial results are combined in list order. Calls may
+ * run at the same time and nest the way they can for ll_parallelForEach.
+ * @param list This is a pointer to the list to reduce.
+ * @param reduce This is the function that folds the data and size of an element into an accumulator.
+ * @param combine This is the function that folds a partial result into an accumulator.
+ * @param result This is a pointer to the result, which must hold the identity value on entry.
+ * @param resultSize This is the size of the result in bytes.
+ * @param context This is passed to every call of reduce and combine.
+ * @param threads This is the number of threads to spread the work over, 0 to use all processors.
+ * @return This returns true if the list was reduced, false if it failed.
+ */
+bool ll_parallelReduce(struct linkedList* list,
+		void (*reduce)(void* accumulator, const void* data, ll_size_t size, void* context),
+		void (*combine)(void* accumulator, const void* partial, void* context),
+		void* result, uint32_t resultSize, void* context, uint32_t threads);
+
+/**
+ * This function switches sorted mode on or off for an empty list. A sorted list keeps its
+ * elements ordered by a comparator and indexes them with skip towers, so ll_insertSorted,
+ * ll_lowerBound and ll_removeValue take logarithmic time. Iteration still walks the nodes in
+ * order. Functions that add at a position or move elements between lists, such as ll_add,
+ * ll_addIndex, ll_pushFront and ll_transfer, fail on a sorted list, while removing by index
+ * still works. ll_clear keeps the list sorted, and switching sorted mode off frees the index.
+ * @param list This is a pointer to the list to configure, which must be empty.
+ * @param compare This is a function returning less than, equal to or greater than 0 when the
+ *                first element goes before, with or after the second, or NULL to switch sorted
+ *                mode off.
+ * @return This returns true if the mode was changed, false if it failed.
+ */
+bool ll_setSorted(struct linkedList* list, int (*compare)(const void* a, const void* b));
+
+/**
+ * This function adds a copy of an object to a sorted list behind every element that is not
+ * greater than it.
+ * @param list This is a pointer to the sorted list to add to.
+ * @param object This is a pointer to the object to be added to the list.
+ * @param size This is the size of the object being added in bytes.
+ * @return This returns true if the add was successful, false if it failed or the list is not
+ *         sorted.
+ */
+bool ll_insertSorted(struct linkedList* list, const void* object, ll_size_t size);
+
+/**
+ * This function moves an iterator to the first element of a sorted list that is not less than
+ * a key, which is where a range of elements starting at the key begins.
+ * @param list This is a pointer to the sorted list to search.
+ * @param key This is a pointer to the key.
+ * @param iter This is a pointer to the iterator to move, for example one from ll_getIterator.
+ * @return This returns true if such an element exists, false otherwise.
+ */
+bool ll_lowerBound(struct linkedList* list, const void* key, struct linkedListIterator* iter);
+
+/**
+ * This function removes the first element of a sorted list that is equal to a key.
+ * @param list This is a pointer to the sorted list to remove from.
+ * @param key This is a pointer to the key.
+ * @return This returns true if an element was removed, false otherwise.
+ */
+bool ll_removeValue(struct linkedList* list, const void* key);
+
+/**
+ * This structure holds the counters of a list that interns payloads.
+ */
+struct internStats
+{
+  uint64_t logicalBytes; // The bytes of data the elements hold as seen by the caller
+  uint64_t storedBytes; // The bytes of data actually allocated for the shared payloads
+  ll_size_t uniquePayloads; // The number of distinct payloads stored
+  ll_size_t references; // The number of elements sharing those payloads
+};
+
+/**
+ * This function switches interning on or off for an empty list. An interning list hashes every
+ * object copied in by ll_add, ll_addIndex, ll_pushFront and ll_insertSorted, and elements with
+ * identical bytes share one reference counted copy. ll_get then returns data that may be shared,
+ * which must not be written to; ll_getMutable gives an element a private copy first. Data taken
+ * out with ll_take, ll_detach or the pops is always a private copy. Elements cannot be moved
+ * out of an interning list with ll_transfer, but copies moved in with ll_transfer or added with
+ * ll_fromArray are interned. An interning list cannot have concurrent readers.
+ * @param list This is a pointer to the list to configure, which must be empty.
+ * @param enabled This is true to intern payloads, false to stop and free the table.
+ * @return This returns true if the mode was changed, false if it failed.
+ */
+bool ll_setInterning(struct linkedList* list, bool enabled);
+
+/**
+ * This function gets the data of an element for writing. Data shared with other elements is
+ * copied first, so writing to it does not change any other element.
+ * @param list This is a pointer to the list to get from.
+ * @param index This is the index of the element.
+ * @return This returns a pointer to data that only this element uses, or NULL if the index is
+ *         out of range.
+ */
+void* ll_getMutable(struct linkedList* list, ll_size_t index);
+
+/**
+ * This function reads the counters of a list that interns payloads. The dedup ratio is
+ * logicalBytes / storedBytes and the bytes saved are logicalBytes - storedBytes.
+ * @param list This is a pointer to the list.
+ * @param stats This is a pointer to the structure that receives the counters.
+ * @return This returns true if the counters were read, false if the list does not intern.
+ */
+bool ll_internStats(struct linkedList* list, struct internStats* stats);
+
+/**
+ * This function enables or disables concurrent reader mode for a linked list. In this mode
+ * a single writer thread may call ll_add, ll_addIndex, ll_remove and ll_clear while any number
+ * of reader threads iterate the list inside ll_rcuReadLock/ll_rcuReadUnlock without taking locks.
+ * Removed nodes are not freed until every reader that could still see them has finished.
+ * Readers may only walk the list forwards with ll_getIterator, ll_hasNext and ll_next.
+ * @param list This is a pointer to the list to configure.
+ * @param enabled This is true to enable concurrent readers, false to disable them.
+ * @return This returns true if the mode was changed, false if it failed.
+ */
+bool ll_setConcurrentReaders(struct linkedList* list, bool enabled);
+
+/**
+ * This function registers the calling thread as a reader. Registration happens automatically
+ * on the first call to ll_rcuReadLock, and the slot is released again when the thread exits.
+ * @return This returns true if the thread is registered, false if all reader slots are in use.
+ */
+bool ll_rcuRegisterThread(void);
+
+/**
+ * This function releases the reader slot held by the calling thread. The thread must not be
+ * inside a read-side critical section.
+ */
+void ll_rcuUnregisterThread(void);
+
+/**
+ * This function marks the start of a read-side critical section. Nodes reached inside the
+ * critical section stay valid until the matching ll_rcuReadUnlock. Critical sections may nest.
+ * No locks or atomic read-modify-write instructions are used.
+ * @return This returns true if the critical section was entered, false if the thread could not
+ *         be registered as a reader.
+ */
+bool ll_rcuReadLock(void);
+
+/**
+ * This function marks the end of a read-side critical section.
+ */
+void ll_rcuReadUnlock(void);
+
+/**
+ * This function waits until every read-side critical section that was active when it was
+ * called has ended. It must not be called from inside a read-side critical section.
+ */
+void ll_rcuSynchronize(void);
+
+/**
+ * This function waits for a grace period and then frees every node retired by the writer.
+ * It is called automatically once enough nodes have been retired, but a writer can call it
+ * to give memory back sooner.
+ * @param list This is a pointer to the list whose retired nodes should be freed.
+ */
+void ll_rcuReclaim(struct linkedList* list);
+
+/**
+ * This function switches deferred reclamation on or off for a list. With it enabled, ll_clear
+ * and ll_removeRange detach the removed nodes and append them to a process-wide reclaim queue
+ * instead of freeing them, so the caller does not pay for walking the chain and the list is
+ * ready for use as soon as they return. The queued nodes are freed by ll_reclaimStep or by the
+ * background reclaimer. Owned data is freed there with the payload destructor the list had at
+ * the time, which may then run on another thread. Nodes removed one at a time are still freed
+ * straight away.
+ * @param list This is a pointer to the list to configure.
+ * @param enabled This is true to hand removed nodes to the reclaim queue, false to free them
+ *                on the calling thread.
+ * @return This returns true if the mode was changed, false if it failed.
+ */
+bool ll_setDeferredReclaim(struct linkedList* list, bool enabled);
+
+/**
+ * This function removes a run of consecutive elements from a list. The run is spliced out in
+ * one step, and with deferred reclamation its nodes are handed to the reclaim queue as a whole.
+ * Sorted and interning lists still update their index and shared payloads for every element.
+ * @param list This is a pointer to the list to remove from.
+ * @param index This is the index of the first element to remove.
+ * @param count This is the number of elements to remove.
+ * @return This returns the number of elements removed, which is less than count if the list
+ *         ends first.
+ */
+ll_size_t ll_removeRange(struct linkedList* list, ll_size_t index, ll_size_t count);
+
+/**
+ * This function frees nodes waiting in the reclaim queue on the calling thread, oldest first.
+ * Calling it with a small budget from an event loop spreads the cost of a large clear over
+ * many calls. It may be called from any number of threads.
+ * @param budget This is the largest number of nodes to free.
+ * @return This returns the number of nodes freed, 0 if the queue is empty.
+ */
+size_t ll_reclaimStep(size_t budget);
+
+/**
+ * This function starts a background thread that frees the nodes in the reclaim queue as soon
+ * as they are queued. Starting it while it runs does nothing.
+ * @return This returns true if the reclaimer is running, false if it could not be started.
+ */
+bool ll_startReclaimer(void);
+
+/**
+ * This function stops the background reclaimer. It returns once the reclaimer has emptied the
+ * reclaim queue and exited.
+ */
+void ll_stopReclaimer(void);
+
+/**
+ * This function reads the memory used by a list: the element data, the node headers, the
+ * bookkeeping of its modes and what the allocator handed out for them, as reported by
+ * malloc_usable_size. Data handed over with ll_addOwned is counted at its size, since it may
+ * come from another allocator. Removed nodes stop counting when they are unlinked, even if
+ * readers or the reclaim queue keep them alive a while longer, and iterators are not counted
+ * since the caller frees them. The counters are kept up to date as the list changes, so this
+ * takes O(1) time and may be called from any thread while one thread writes to the list.
+ * @param list This is a pointer to the list.
+ * @param usage This is a pointer to the structure that receives the memory used.
+ * @return This returns true if the memory used was read, false if a parameter is NULL.
+ */
+bool ll_memoryUsage(struct linkedList* list, struct memoryUsage* usage);
+
+/**
+ * This function reads the memory used by every list of the process together, counted the same
+ * way as by ll_memoryUsage. Every thread keeps its own counters so writers never contend on
+ * them, and this adds up the counters of the threads that changed lists, which takes time
+ * independent of the number and size of lists. It may be called from any thread.
+ * @param usage This is a pointer to the structure that receives the memory used.
+ * @return This returns true if the memory used was read, false if usage is NULL.
+ */
+bool ll_processMemoryUsage(struct memoryUsage* usage);
+
+/**
+ * This structure holds the counters of cold compression for a list.
+ */
+struct coldStats
+{
+  uint64_t compressions; // The number of segments packed
+  uint64_t decompressions; // The number of segments expanded again because an element was touched
+  ll_size_t packedElements; // The number of elements held in segments right now
+  uint64_t rawBytes; // The bytes of data held in segments right now, before compression
+  uint64_t compressedBytes; // The bytes those segments take compressed
+};
+
+/**
+ * This function switches cold compression on or off for a list. With it on, ll_compressCold
+ * packs runs of elements outside the hot window at either end of the list into compressed
+ * segments, and reading an element of a segment through ll_get, an iterator or any other list
+ * function expands the whole segment again. Reads therefore write to the list, but readers
+ * claim a packed element before expanding its segment and expansions of one list take its
+ * lock, so several threads may read a list at once as long as no thread changes it or calls
+ * ll_compressCold. Only copied data is packed. Lists in concurrent reader, deferred
+ * reclaim or sorted mode cannot compress, and elements cannot be moved out with ll_transfer
+ * while it is on. Switching it off expands every segment and frees the state,
+ * which must be done before the list is discarded.
+ * @param list This is a pointer to the list to configure.
+ * @param enabled This is true to allow compression, false to expand everything and stop.
+ * @param hotWindow This is the number of elements at each end of the list that stay expanded.
+ * @return This returns true if the mode was changed, false if it failed.
+ */
+bool ll_setColdCompression(struct linkedList* list, bool enabled, ll_size_t hotWindow);
+
+/**
+ * This function packs cold elements of a list into compressed segments. An element is cold
+ * when it lies outside the hot window and was neither read with ll_get, ll_getMutable or the
+ * peeks nor expanded since the previous pass, so an element that is read keeps its own copy
+ * for at least one more pass. Walking the list with an iterator leaves no mark unless it
+ * expands a segment, since a walk reads every element alike and would keep the whole list
+ * hot. Data pointers returned for elements that get packed are no longer valid afterwards.
+ * @param list This is a pointer to a list with cold compression on.
+ * @return This returns the number of elements packed.
+ */
+ll_size_t ll_compressCold(struct linkedList* list);
+
+/**
+ * This function expands every compressed segment of a list.
+ * @param list This is a pointer to the list.
+ * @return This returns the number of elements expanded.
+ */
+ll_size_t ll_expandCold(struct linkedList* list);
+
+/**
+ * This function reads the counters of cold compression for a list.
+ * @param list This is a pointer to the list.
+ * @param stats This is a pointer to the structure that receives the counters.
+ * @return This returns true if the counters were read, false if compression is off.
+ */
+bool ll_coldStats(struct linkedList* list, struct coldStats* stats);
+
+/**
+ * This function switches change tracking on or off for a list. With it on, every function that
+ * adds elements, removes them or clears the list records the change under the next sequence
+ * number, starting from 1. ll_exportDelta serializes the changes made after a sequence number
+ * and ll_applyDelta replays them on a replica, so keeping a replica up to date costs time and
+ * memory in proportion to the changes rather than to the list. A replica starts out as a copy
+ * of the list made when tracking was switched on, which is sequence number 0. Sorted lists
+ * cannot track changes, batches cannot be started on a list that does, and writes through
+ * pointers to element data are not seen. Switching it off frees the log, which must be done
+ * before the list is discarded.
+ * @param list This is a pointer to the list to configure.
+ * @param enabled This is true to record changes, false to stop and free the change log.
+ * @return This returns true if the mode was changed, false if it failed.
+ */
+bool ll_setChangeTracking(struct linkedList* list, bool enabled);
+
+/**
+ * This function returns the sequence number of the last change recorded for a list.
+ * @param list This is a pointer to the list.
+ * @return This returns the sequence number, or 0 if nothing was recorded or the list does not
+ *         track changes.
+ */
+uint64_t ll_changeSequence(struct linkedList* list);
+
+/**
+ * This function serializes the changes recorded for a list after a given sequence number. The
+ * delta holds a header naming the sequence numbers it covers followed by one compact record per
+ * change, in the byte order of the host. Changes before the last clear are not kept, since the
+ * clear makes them unnecessary, so a delta from before it starts with the clear.
+ * @param list This is a pointer to a list that tracks changes.
+ * @param since This is the sequence number of the last change the replica has applied.
+ * @param buffer This is a pointer to the buffer to fill, or NULL to have the function allocate
+ *               one that the caller must free.
+ * @param bufferSize This is the size of the buffer in bytes, ignored if buffer is NULL.
+ * @param totalSize This is a pointer that receives the size of the delta, may be NULL.
+ * @return This returns a pointer to the delta, or NULL if the changes after since were dropped
+ *         with ll_trimChanges, since is ahead of the list or the buffer is too small.
+ */
+void* ll_exportDelta(struct linkedList* list, uint64_t since, void* buffer, ll_size_t bufferSize, ll_size_t* totalSize);
+
+/**
+ * This function replays a delta exported by ll_exportDelta on a replica in a single pass over
+ * the delta. The delta must start at the change right after the one the replica has applied
+ * last, so a delta that was already applied or that skips changes is refused. A delta starting
+ * with a clear may start later, since the clear makes the skipped changes unnecessary. A
+ * replica that tracks changes itself records the replayed changes, so replicas can be chained.
+ * @param replica This is a pointer to the list the changes are applied to.
+ * @param delta This is a pointer to the delta.
+ * @param size This is the size of the delta in bytes.
+ * @param sequence This is a pointer to the sequence number of the last change the replica has
+ *                 applied, 0 for a fresh copy. It is moved to the last change applied, which
+ *                 is where the replica stands even if not every change was applied.
+ * @return This returns true if every change was applied, false if the delta is damaged, does
+ *         not follow on from the replica or a change did not fit the replica.
+ */
+bool ll_applyDelta(struct linkedList* replica, const void* delta, ll_size_t size, uint64_t* sequence);
+
+/**
+ * This function drops changes every replica has applied from the change log of a list. Deltas
+ * can no longer be exported from before the dropped changes.
+ * @param list This is a pointer to a list that tracks changes.
+ * @param sequence This is the sequence number of the last change to drop.
+ * @return This returns true if the changes were dropped, false if the sequence number was not
+ *         recorded yet.
+ */
+bool ll_trimChanges(struct linkedList* list, uint64_t sequence);
+
+#endif /*LINKEDLIST_H*/
@@ -0,0 +1,281 @@
+/**
+ * This file contains the implementation of the block codec. The compressor is a single pass
+ * greedy matcher with a hash table of recent four byte sequences, as in LZ4, and skips ahead
+ * faster the longer it goes without finding a match so incompressible data passes quickly.
+ * @file llcodec.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "llcodec.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * The shortest back reference the format can express.
+ */
+#define LC_MIN_MATCH 4
+
+/**
+ * The number of bytes at the end of a block that are always stored as literals.
+ */
+#define LC_LAST_LITERALS 5
+
+/**
+ * The number of bytes at the end of a block in which no back reference may start.
+ */
+#define LC_MATCH_LIMIT 12
+
+/**
+ * The farthest back a reference can reach.
+ */
+#define LC_MAX_OFFSET 65535
+
+/**
+ * The number of bits of the hash of a four byte sequence, which sets the size of the table.
+ */
+#define LC_HASH_BITS 12
+
+/**
+ * The length that a four bit length field stores as 15 and continues in extra bytes.
+ */
+#define LC_LENGTH_MASK 15
+
+/**
+ * This function reads four bytes at any alignment.
+ * @param bytes This is a pointer to the bytes.
+ * @return This returns the bytes as a number.
+ */
+static uint32_t lc_read32(const uint8_t* bytes){
+	uint32_t value;
+
+	memcpy(&value, bytes, sizeof(value));
+
+	return value;
+}
+
+/**
+ * This function hashes a four byte sequence into the match table.
+ * @param sequence This is the sequence.
+ * @return This returns the slot of the sequence in the table.
+ */
+static uint32_t lc_hash(uint32_t sequence){
+	return (sequence * 2654435761u) >> (32 - LC_HASH_BITS);
+}
+
+/**
+ * This function writes the part of a length that does not fit its four bit field.
+ * @param out This is a pointer to where the bytes are written.
+ * @param length This is the length minus the 15 stored in the field.
+ * @return This returns a pointer behind the written bytes.
+ */
+static uint8_t* lc_writeLength(uint8_t* out, size_t length){
+	while(length >= 255){
+		*out = 255;
+		out = out + 1;
+		length = length - 255;
+	}
+	*out = (uint8_t)length;
+
+	return out + 1;
+}
+
+/**
+ * This function writes a sequence: a run of literals followed by a back reference.
+ * @param out This is a pointer to the write position, which is moved behind the sequence.
+ * @param end This is a pointer to the end of the destination buffer.
+ * @param literals This is a pointer to the literals.
+ * @param literalLength This is the number of literals.
+ * @param offset This is how far back the reference reaches, unused for the last sequence.
+ * @param matchLength This is the length of the reference, or 0 for the last sequence.
+ * @return This returns true if the sequence fit the buffer, false otherwise.
+ */
+static bool lc_writeSequence(uint8_t** out, const uint8_t* end, const uint8_t* literals, size_t literalLength,
+		size_t offset, size_t matchLength){
+	size_t needed = 1 + (literalLength / 255) + 1 + literalLength + 2 + (matchLength / 255) + 1;
+	bool fits = ((size_t)(end - *out) >= needed);
+
+	if(fits){
+		uint8_t* token = *out;
+		uint8_t* position = token + 1;
+		size_t matchCode = (matchLength != 0) ? (matchLength - LC_MIN_MATCH) : 0;
+
+		*token = (uint8_t)(((literalLength < LC_LENGTH_MASK) ? literalLength : LC_LENGTH_MASK) << 4);
+		if(literalLength >= LC_LENGTH_MASK){
+			position = lc_writeLength(position, literalLength - LC_LENGTH_MASK);
+		}
+		memcpy(position, literals, literalLength);
+		position = position + literalLength;
+
+		if(matchLength != 0){
+			position[0] = (uint8_t)offset;
+			position[1] = (uint8_t)(offset >> 8);
+			position = position + 2;
+
+			*token = *token | (uint8_t)((matchCode < LC_LENGTH_MASK) ? matchCode : LC_LENGTH_MASK);
+			if(matchCode >= LC_LENGTH_MASK){
+				position = lc_writeLength(position, matchCode - LC_LENGTH_MASK);
+			}
+		}
+
+		*out = position;
+	}
+
+	return fits;
+}
+
+/**
+ * This function returns the largest size compressing a block of a given size can produce.
+ * @param size This is the size of the block in bytes.
+ * @return This returns the size the destination of lc_compress needs to always succeed.
+ */
+size_t lc_compressBound(size_t size){
+	return size + (size / 255) + 16;
+}
+
+/**
+ * This function compresses a block.
+ * @param source This is a pointer to the block.
+ * @param size This is the size of the block in bytes.
+ * @param destination This is a pointer to the buffer that receives the compressed block.
+ * @param capacity This is the size of the buffer in bytes.
+ * @return This returns the size of the compressed block, or 0 if it does not fit the buffer.
+ */
+size_t lc_compress(const void* source, size_t size, void* destination, size_t capacity){
+	const uint8_t* in = (const uint8_t*)source;
+	uint8_t* out = (uint8_t*)destination;
+	const uint8_t* end = out + capacity;
+	uint32_t table[1u << LC_HASH_BITS]; // Each slot holds the position of a sequence plus one, 0 if empty
+	size_t anchor = 0; // The first byte not yet written
+	size_t position = 0;
+	bool fits = true;
+
+	memset(table, 0, sizeof(table));
+
+	if(size > LC_MATCH_LIMIT){
+		while((position < (size - LC_MATCH_LIMIT)) && fits){
+			uint32_t sequence = lc_read32(in + position);
+			uint32_t slot = lc_hash(sequence);
+			size_t candidate = table[slot];
+
+			table[slot] = (uint32_t)(position + 1);
+
+			if((candidate != 0) && ((position - (candidate - 1)) <= LC_MAX_OFFSET) && (lc_read32(in + candidate - 1) == sequence)){
+				size_t reference = candidate - 1;
+				size_t length = LC_MIN_MATCH;
+
+				while(((position + length) < (size - LC_LAST_LITERALS)) && (in[reference + length] == in[position + length])){
+					length = length + 1;
+				}
+
+				fits = lc_writeSequence(&out, end, in + anchor, position - anchor, position - reference, length);
+				position = position + length;
+				anchor = position;
+			}
+			else{
+				// Step further the longer nothing matched
+				position = position + 1 + ((position - anchor) >> 6);
+			}
+		}
+	}
+
+	if(fits){
+		fits = lc_writeSequence(&out, end, in + anchor, size - anchor, 0, 0);
+	}
+
+	return fits ? (size_t)(out - (uint8_t*)destination) : 0;
+}
+
+/**
+ * This function reads the part of a length stored after its four bit field.
+ * @param in This is a pointer to the read position, which is moved behind the length.
+ * @param end This is a pointer to the end of the compressed block.
+ * @param length This is a pointer to the length to add to.
+ * @return This returns true if the length was read, false if the block ended first.
+ */
+static bool lc_readLength(const uint8_t** in, const uint8_t* end, size_t* length){
+	bool valid = true;
+	uint8_t byte = 255;
+
+	while((byte == 255) && valid){
+		valid = (*in < end);
+		if(valid){
+			byte = **in;
+			*in = *in + 1;
+			*length = *length + byte;
+		}
+	}
+
+	return valid;
+}
+
+/**
+ * This function decompresses a block.
+ * @param source This is a pointer to the compressed block.
+ * @param size This is the size of the compressed block in bytes.
+ * @param destination This is a pointer to the buffer that receives the block.
+ * @param capacity This is the size of the buffer in bytes.
+ * @return This returns the size of the block, or 0 if the compressed block is damaged or does
+ *         not fit the buffer.
+ */
+size_t lc_decompress(const void* source, size_t size, void* destination, size_t capacity){
+	const uint8_t* in = (const uint8_t*)source;
+	const uint8_t* inEnd = in + size;
+	uint8_t* start = (uint8_t*)destination;
+	uint8_t* out = start;
+	uint8_t* outEnd = out + capacity;
+	bool valid = true;
+
+	while((in < inEnd) && valid){
+		uint8_t token = *in;
+		size_t literals = token >> 4;
+
+		in = in + 1;
+		if(literals == LC_LENGTH_MASK){
+			valid = lc_readLength(&in, inEnd, &literals);
+		}
+
+		valid = valid && (literals <= (size_t)(inEnd - in)) && (literals <= (size_t)(outEnd - out));
+		if(valid){
+			memcpy(out, in, literals);
+			in = in + literals;
+			out = out + literals;
+		}
+
+		// Every sequence but the last ends in a back reference
+		if(valid && (in < inEnd)){
+			size_t offset = 0;
+			size_t length = (token & LC_LENGTH_MASK);
+
+			valid = ((inEnd - in) >= 2);
+			if(valid){
+				offset = (size_t)in[0] | ((size_t)in[1] << 8);
+				in = in + 2;
+			}
+			if(valid && (length == LC_LENGTH_MASK)){
+				valid = lc_readLength(&in, inEnd, &length);
+			}
+			length = length + LC_MIN_MATCH;
+
+			valid = valid && (offset != 0) && (offset <= (size_t)(out - start)) && (length <= (size_t)(outEnd - out));
+			if(valid){
+				const uint8_t* match = out - offset;
+
+				// Overlapping references repeat the bytes just written, so they are copied one by one
+				if(offset >= length){
+					memcpy(out, match, length);
+				}
+				else{
+					for(size_t i = 0; i < length; i++){
+						out[i] = match[i];
+					}
+				}
+				out = out + length;
+			}
+		}
+	}
+
+	return valid ? (size_t)(out - start) : 0;
+}
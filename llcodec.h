@@ -0,0 +1,44 @@
+/**
+ * This file contains the interface for the block codec used to compress cold segments of
+ * lists. It writes the LZ4 block format: a sequence of literal runs and back references of at
+ * least four bytes reaching at most 64 KB back. It favours speed over ratio and decompresses
+ * at close to memory speed.
+ * @file llcodec.h
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#ifndef LLCODEC_H
+#define LLCODEC_H
+
+#include <stddef.h>
+
+/**
+ * This function returns the largest size compressing a block of a given size can produce.
+ * @param size This is the size of the block in bytes.
+ * @return This returns the size the destination of lc_compress needs to always succeed.
+ */
+size_t lc_compressBound(size_t size);
+
+/**
+ * This function compresses a block.
+ * @param source This is a pointer to the block.
+ * @param size This is the size of the block in bytes.
+ * @param destination This is a pointer to the buffer that receives the compressed block.
+ * @param capacity This is the size of the buffer in bytes.
+ * @return This returns the size of the compressed block, or 0 if it does not fit the buffer.
+ */
+size_t lc_compress(const void* source, size_t size, void* destination, size_t capacity);
+
+/**
+ * This function decompresses a block.
+ * @param source This is a pointer to the compressed block.
+ * @param size This is the size of the compressed block in bytes.
+ * @param destination This is a pointer to the buffer that receives the block.
+ * @param capacity This is the size of the buffer in bytes.
+ * @return This returns the size of the block, or 0 if the compressed block is damaged or does
+ *         not fit the buffer.
+ */
+size_t lc_decompress(const void* source, size_t size, void* destination, size_t capacity);
+
+#endif /*LLCODEC_H*/
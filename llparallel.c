@@ -0,0 +1,189 @@
+/**
+ * This file contains the parallel traversal functions of the linked list. The list is split
+ * into segments in a single walk, and each segment becomes a task on the shared thread pool.
+ * @file llparallel.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+#include "threadpool.h"
+
+/**
+ * The number of segments created per thread, so workers that finish early can steal work.
+ */
+#define LL_SEGMENTS_PER_THREAD 4
+
+/**
+ * This structure describes one segment of a parallel traversal.
+ */
+struct parallelSegment {
+	struct listNode* first; // The first node of the segment
+	ll_size_t count; // The number of nodes in the segment
+	void (*forEach)(void*, ll_size_t, void*); // The function called for every element, or NULL when reducing
+	void (*reduce)(void*, const void*, ll_size_t, void*); // The function folding elements into the accumulator
+	void* accumulator; // The partial result of the segment when reducing
+	void* context; // The context passed to the callbacks
+};
+
+/**
+ * This function runs a segment of a parallel traversal.
+ * @param argument This is a pointer to the parallelSegment to run.
+ */
+static void ll_runSegment(void* argument){
+	struct parallelSegment* segment = (struct parallelSegment*)argument;
+	struct listNode* node = segment->first;
+
+	for(ll_size_t i = 0; i < segment->count; i++){
+		if(segment->forEach != NULL){
+			segment->forEach(node->data, node->dataSize, segment->context);
+		}
+		else{
+			segment->reduce(segment->accumulator, node->data, node->dataSize, segment->context);
+		}
+		node = node->nextNode;
+	}
+}
+
+/**
+ * This function splits a list into segments and runs them on the shared thread pool.
+ * @param list This is a pointer to the list to walk.
+ * @param prototype This is a segment holding the callbacks and context to copy into every segment.
+ * @param accumulators This is an array of one accumulator per segment when reducing, or NULL.
+ * @param accumulatorSize This is the size of each accumulator in bytes.
+ * @param segments This is a pointer that receives the array of segments, which the caller frees.
+ * @param threads This is the number of threads to spread the work over, 0 to use all processors.
+ * @return This returns the number of segments.
+ */
+static uint32_t ll_runSegments(struct linkedList* list, const struct parallelSegment* prototype, char** accumulators,
+		uint32_t accumulatorSize, struct parallelSegment** segments, uint32_t threads){
+	struct threadPool* pool = tp_shared();
+	uint32_t count;
+	ll_size_t length;
+	struct listNode* node = list->head;
+	struct threadPoolTask* tasks;
+
+	// The workers read the data straight from the nodes, so packed elements are expanded first
+	if(list->cold != NULL){
+		ll_expandCold(list);
+	}
+
+	// A single thread walks the whole list as one segment, and no more threads are used than the pool has
+	if((threads == 0) || (threads > pool->workerCount)){
+		threads = pool->workerCount;
+	}
+	count = (threads == 1) ? 1 : (threads * LL_SEGMENTS_PER_THREAD);
+
+	// Never make more segments than there are elements
+	if(count > list->size){
+		count = list->size;
+	}
+	length = (list->size + count - 1) / count;
+	count = (list->size + length - 1) / length;
+
+	*segments = (struct parallelSegment*)malloc(count * sizeof(struct parallelSegment));
+	tasks = (struct threadPoolTask*)malloc(count * sizeof(struct threadPoolTask));
+	if(accumulators != NULL){
+		*accumulators = (char*)malloc((size_t)count * accumulatorSize);
+	}
+
+	// Place the split points in one walk using the known size of the list
+	for(uint32_t i = 0; i < count; i++){
+		struct parallelSegment* segment = &(*segments)[i];
+
+		*segment = *prototype;
+		segment->first = node;
+		segment->count = (((uint64_t)(i + 1) * length) <= list->size) ? length : (list->size - ((ll_size_t)i * length));
+		if(accumulators != NULL){
+			segment->accumulator = *accumulators + ((size_t)i * accumulatorSize);
+			memcpy(segment->accumulator, prototype->accumulator, accumulatorSize);
+		}
+
+		tasks[i].function = ll_runSegment;
+		tasks[i].argument = segment;
+
+		for(ll_size_t j = 0; j < segment->count; j++){
+			node = node->nextNode;
+		}
+	}
+
+	// A single segment is run on the calling thread to avoid waking the pool
+	if(count == 1){
+		ll_runSegment(&(*segments)[0]);
+	}
+	else{
+		tp_runWorkers(pool, tasks, count, threads);
+	}
+
+	free(tasks);
+
+	return count;
+}
+
+/**
+ * This function calls a function for every element of the list in parallel.
+ * @param list This is a pointer to the list to walk.
+ * @param function This is the function called with the data, size and context of each element.
+ * @param context This is passed to every call of the function.
+ * @param threads This is the number of threads to spread the work over, 0 to use all processors.
+ * @return This returns true if the function was called for every element, false if it failed.
+ */
+bool ll_parallelForEach(struct linkedList* list, void (*function)(void* data, ll_size_t size, void* context),
+		void* context, uint32_t threads){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (function != NULL)){
+		if(list->size != 0){
+			struct parallelSegment prototype = { NULL, 0, function, NULL, NULL, context };
+			struct parallelSegment* segments;
+
+			ll_runSegments(list, &prototype, NULL, 0, &segments, threads);
+			free(segments);
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function folds every element of the list into a result in parallel.
+ * @param list This is a pointer to the list to reduce.
+ * @param reduce This is the function that folds the data and size of an element into an accumulator.
+ * @param combine This is the function that folds a partial result into an accumulator.
+ * @param result This is a pointer to the result, which must hold the identity value on entry.
+ * @param resultSize This is the size of the result in bytes.
+ * @param context This is passed to every call of reduce and combine.
+ * @param threads This is the number of threads to spread the work over, 0 to use all processors.
+ * @return This returns true if the list was reduced, false if it failed.
+ */
+bool ll_parallelReduce(struct linkedList* list,
+		void (*reduce)(void* accumulator, const void* data, ll_size_t size, void* context),
+		void (*combine)(void* accumulator, const void* partial, void* context),
+		void* result, uint32_t resultSize, void* context, uint32_t threads){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (reduce != NULL) && (combine != NULL) && (result != NULL) && (resultSize != 0)){
+		if(list->size != 0){
+			struct parallelSegment prototype = { NULL, 0, NULL, reduce, result, context };
+			struct parallelSegment* segments;
+			char* accumulators;
+			uint32_t count = ll_runSegments(list, &prototype, &accumulators, resultSize, &segments, threads);
+
+			// Combine the partial results in list order so non-commutative operations work
+			for(uint32_t i = 0; i < count; i++){
+				combine(result, segments[i].accumulator, context);
+			}
+
+			free(accumulators);
+			free(segments);
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
@@ -0,0 +1,204 @@
+/**
+ * This file contains C++20 range views over the elements of a linked list. A view walks the
+ * node chain of the list it was made from, so it holds no elements of its own and making one
+ * allocates nothing. Views combine with the standard range adaptors:
+ *   for(int value : ll::view<int>(list) | std::views::filter(isEven) | std::views::take(10))
+ * and every stage of such a pipeline is lazy, so elements are only read as the loop asks for
+ * them and stopping early leaves the rest of the list untouched.
+ * @file llranges.h
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#ifndef LLRANGES_H
+#define LLRANGES_H
+
+#ifndef __cplusplus
+#error "llranges.h can only be used from C++"
+#endif
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+
+extern "C" {
+  #include "linkedlist.h"
+}
+
+namespace ll {
+
+/**
+ * This structure is an element of a list as produced by ll::elements, its data and its size.
+ */
+struct element {
+  void* data; // A pointer to the data of the element
+  ll_size_t size; // The size of the data in bytes
+};
+
+namespace detail {
+
+/**
+ * This structure describes how a view of elements of type T reads a node. Every element of
+ * the list must hold a T.
+ */
+template <typename T>
+struct nodeAccess {
+  using reference = T&;
+
+  static reference get(struct listNode* node) {
+    return *static_cast<T*>(ll_nodeData(node));
+  }
+};
+
+/**
+ * This structure describes how a view of untyped elements reads a node.
+ */
+template <>
+struct nodeAccess<element> {
+  using reference = element;
+
+  static reference get(struct listNode* node) {
+    return element{ll_nodeData(node), node->dataSize};
+  }
+};
+
+} // namespace detail
+
+/**
+ * This class is an iterator over the nodes of a list. It moves forward along the same links as
+ * ll_next, so it may be used by concurrent readers inside ll_rcuReadLock/ll_rcuReadUnlock, and
+ * backward along the previous node links like ll_prev.
+ */
+template <typename T>
+class listIterator {
+ public:
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using reference = typename detail::nodeAccess<T>::reference;
+  using iterator_concept = std::bidirectional_iterator_tag;
+
+  listIterator() = default;
+
+  /**
+   * This constructor creates an iterator standing on a node.
+   * @param node This is a pointer to the node, NULL for the end of the list.
+   * @param list This is a pointer to the list, used to step back from the end.
+   */
+  listIterator(struct listNode* node, struct linkedList* list) : node_(node), list_(list) {}
+
+  reference operator*() const {
+    return detail::nodeAccess<T>::get(node_);
+  }
+
+  listIterator& operator++() {
+    node_ = __atomic_load_n(&node_->nextNode, __ATOMIC_ACQUIRE);
+    return *this;
+  }
+
+  listIterator operator++(int) {
+    listIterator previous = *this;
+    ++*this;
+    return previous;
+  }
+
+  listIterator& operator--() {
+    node_ = (node_ != NULL) ? node_->prevNode : list_->tail;
+    return *this;
+  }
+
+  listIterator operator--(int) {
+    listIterator previous = *this;
+    --*this;
+    return previous;
+  }
+
+  bool operator==(const listIterator& other) const {
+    return node_ == other.node_;
+  }
+
+ private:
+  struct listNode* node_ = NULL; // The node the iterator stands on, NULL past the end
+  struct linkedList* list_ = NULL; // The list the node belongs to
+};
+
+/**
+ * This class is a view of the elements of a list as values of type T, or as ll::element when
+ * T is ll::element. It refers to the list without owning it, so the list must outlive the
+ * view and must not be changed while the view is being iterated.
+ */
+template <typename T>
+class listView : public std::ranges::view_interface<listView<T>> {
+ public:
+  listView() = default;
+
+  /**
+   * This constructor creates a view of a list.
+   * @param list This is the list to view.
+   */
+  explicit listView(struct linkedList& list) : list_(&list) {}
+
+  listIterator<T> begin() const {
+    return listIterator<T>(__atomic_load_n(&list_->head, __ATOMIC_ACQUIRE), list_);
+  }
+
+  listIterator<T> end() const {
+    return listIterator<T>(NULL, list_);
+  }
+
+  std::size_t size() const {
+    return ll_size(list_);
+  }
+
+ private:
+  struct linkedList* list_ = NULL; // The list the view refers to
+};
+
+/**
+ * This function creates a view of the elements of a list as values of type T.
+ * @param list This is the list to view, every element of which holds a T.
+ * @return This returns the view.
+ */
+template <typename T>
+listView<T> view(struct linkedList& list) {
+  return listView<T>(list);
+}
+
+/**
+ * This function creates a view of the elements of a list as data and size pairs.
+ * @param list This is the list to view.
+ * @return This returns the view.
+ */
+inline listView<element> elements(struct linkedList& list) {
+  return listView<element>(list);
+}
+
+/**
+ * This structure is the adaptor behind ll::as, which lets a view start a pipeline:
+ *   list | ll::as<int> | std::views::transform(twice)
+ */
+template <typename T>
+struct asAdaptor {};
+
+template <typename T>
+inline constexpr asAdaptor<T> as{};
+
+template <typename T>
+listView<T> operator|(struct linkedList& list, asAdaptor<T>) {
+  return listView<T>(list);
+}
+
+static_assert(std::ranges::view<listView<int>>);
+static_assert(std::ranges::bidirectional_range<listView<int>>);
+static_assert(std::ranges::sized_range<listView<int>>);
+static_assert(std::ranges::bidirectional_range<listView<element>>);
+
+} // namespace ll
+
+/**
+ * Iterators of a view point into the list rather than the view, so they stay valid when the
+ * view itself goes away.
+ */
+template <typename T>
+inline constexpr bool std::ranges::enable_borrowed_range<ll::listView<T>> = true;
+
+#endif /*LLRANGES_H*/
@@ -0,0 +1,164 @@
+/**
+ * This file contains the reader registry used by the concurrent reader mode of the linked
+ * list. Readers announce the epoch they started in, and writers wait for every reader that
+ * started before a change to leave its critical section before freeing memory.
+ * @file llrcu.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+/**
+ * The maximum number of threads that can be registered as readers at the same time.
+ */
+#define LL_RCU_MAX_READERS 256
+
+/**
+ * This structure holds the state of a single reader. Each reader is kept on its own
+ * cache line so readers never write to memory shared with other readers.
+ */
+struct rcuReader {
+	uint64_t epoch; // The epoch the reader entered its critical section in, 0 when not reading
+	bool inUse; // True if a thread owns this slot
+	char padding[64 - sizeof(uint64_t) - sizeof(bool)]; // Pads the slot to a full cache line
+} __attribute__((aligned(64)));
+
+static struct rcuReader readers[LL_RCU_MAX_READERS]; // The reader slots
+static uint32_t readerHighWater = 0; // One past the highest reader slot ever handed out
+static uint64_t globalEpoch = 1; // The current epoch, advanced by every grace period
+
+static __thread int readerSlot = -1; // The slot owned by the calling thread, -1 if unregistered
+static __thread uint32_t readerNesting = 0; // The depth of nested critical sections of the calling thread
+
+static pthread_once_t readerKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t readerKey; // Releases the reader slot of a thread when it exits
+
+/**
+ * This function releases the reader slot stored for an exiting thread.
+ * @param slot This is the slot pointer stored in the thread specific key.
+ */
+static void ll_rcuThreadExit(void* slot){
+	struct rcuReader* reader = (struct rcuReader*)slot;
+
+	__atomic_store_n(&reader->epoch, 0, __ATOMIC_RELEASE);
+	__atomic_store_n(&reader->inUse, false, __ATOMIC_RELEASE);
+}
+
+/**
+ * This function creates the thread specific key used to release reader slots.
+ */
+static void ll_rcuCreateKey(void){
+	pthread_key_create(&readerKey, ll_rcuThreadExit);
+}
+
+/**
+ * This function registers the calling thread as a reader.
+ * @return This returns true if the thread is registered, false if all reader slots are in use.
+ */
+bool ll_rcuRegisterThread(void){
+	bool registered = (readerSlot >= 0);
+
+	pthread_once(&readerKeyOnce, ll_rcuCreateKey);
+
+	// Claim the first free slot
+	for(int i = 0; (i < LL_RCU_MAX_READERS) && !registered; i++){
+		bool expected = false;
+
+		if(__atomic_compare_exchange_n(&readers[i].inUse, &expected, true, false,
+				__ATOMIC_ACQ_REL, __ATOMIC_RELAXED)){
+			uint32_t highWater = __atomic_load_n(&readerHighWater, __ATOMIC_RELAXED);
+
+			// Raise the high water mark so writers scan this slot
+			while((highWater < (uint32_t)(i + 1)) &&
+					!__atomic_compare_exchange_n(&readerHighWater, &highWater, i + 1, false,
+							__ATOMIC_ACQ_REL, __ATOMIC_RELAXED)){
+			}
+
+			readerSlot = i;
+			pthread_setspecific(readerKey, &readers[i]);
+			registered = true;
+		}
+	}
+
+	return registered;
+}
+
+/**
+ * This function releases the reader slot held by the calling thread.
+ */
+void ll_rcuUnregisterThread(void){
+	// Check if the thread holds a slot to avoid releasing another thread's slot
+	if(readerSlot >= 0){
+		pthread_setspecific(readerKey, NULL);
+		ll_rcuThreadExit(&readers[readerSlot]);
+		readerSlot = -1;
+		readerNesting = 0;
+	}
+}
+
+/**
+ * This function marks the start of a read-side critical section.
+ * @return This returns true if the critical section was entered, false if the thread could not
+ *         be registered as a reader.
+ */
+bool ll_rcuReadLock(void){
+	bool entered = true;
+
+	// Register the thread the first time it reads
+	if(readerSlot < 0){
+		entered = ll_rcuRegisterThread();
+	}
+
+	if(entered){
+		// Only the outermost critical section announces an epoch
+		if(readerNesting == 0){
+			__atomic_store_n(&readers[readerSlot].epoch,
+					__atomic_load_n(&globalEpoch, __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+
+			// Make the announcement visible before any node of the list is read
+			__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		}
+
+		readerNesting = readerNesting + 1;
+	}
+
+	return entered;
+}
+
+/**
+ * This function marks the end of a read-side critical section.
+ */
+void ll_rcuReadUnlock(void){
+	// Check if the thread is reading to avoid an unbalanced unlock corrupting the nesting count
+	if((readerSlot >= 0) && (readerNesting > 0)){
+		readerNesting = readerNesting - 1;
+
+		if(readerNesting == 0){
+			__atomic_store_n(&readers[readerSlot].epoch, 0, __ATOMIC_RELEASE);
+		}
+	}
+}
+
+/**
+ * This function waits until every read-side critical section that was active when it was
+ * called has ended.
+ */
+void ll_rcuSynchronize(void){
+	// Start a new epoch; readers entering from now on cannot see nodes unlinked before this point
+	uint64_t epoch = __atomic_add_fetch(&globalEpoch, 1, __ATOMIC_SEQ_CST);
+	uint32_t highWater = __atomic_load_n(&readerHighWater, __ATOMIC_ACQUIRE);
+
+	for(uint32_t i = 0; i < highWater; i++){
+		uint64_t readerEpoch = __atomic_load_n(&readers[i].epoch, __ATOMIC_ACQUIRE);
+
+		// Wait for readers that entered during an older epoch
+		while((readerEpoch != 0) && (readerEpoch < epoch)){
+			sched_yield();
+			readerEpoch = __atomic_load_n(&readers[i].epoch, __ATOMIC_ACQUIRE);
+		}
+	}
+}
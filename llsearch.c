@@ -0,0 +1,473 @@
+/**
+ * This file contains the search functions of the linked list for lists of 4 or 8 byte keys.
+ * The payloads of the nodes are gathered into blocks, and each block is compared with a kernel
+ * picked once at run time from the instruction sets the processor supports.
+ * @file llsearch.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "linkedlist.h"
+
+#include <pthread.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define LL_SEARCH_X86 1
+#endif
+
+/**
+ * The number of payloads gathered into a block before they are compared. Each comparison
+ * returns one bit per payload, so this must not be more than 64.
+ */
+#define LL_SEARCH_BLOCK 64
+
+/**
+ * This is the type of the comparison kernels. A kernel compares the first count keys of a
+ * block with a key and returns a mask with bit i set if key i matches.
+ */
+typedef uint64_t (*ll_searchKernel)(const void* block, uint32_t count, int64_t key);
+
+/**
+ * This structure holds the kernels chosen for the processor.
+ */
+struct searchKernels {
+	ll_searchKernel equal32; // Compares 4 byte keys for equality
+	ll_searchKernel greater32; // Finds 4 byte keys greater than the key
+	ll_searchKernel equal64; // Compares 8 byte keys for equality
+	ll_searchKernel greater64; // Finds 8 byte keys greater than the key
+};
+
+static pthread_once_t kernelsOnce = PTHREAD_ONCE_INIT;
+static struct searchKernels kernels; // The kernels used by every search
+
+/**
+ * This function compares 4 byte keys for equality one at a time.
+ * @param block This is a pointer to the keys.
+ * @param count This is the number of keys.
+ * @param key This is the key to compare with.
+ * @return This returns the mask of matching keys.
+ */
+static uint64_t ll_equal32Scalar(const void* block, uint32_t count, int64_t key){
+	const int32_t* values = (const int32_t*)block;
+	uint64_t mask = 0;
+
+	for(uint32_t i = 0; i < count; i++){
+		mask |= (uint64_t)(values[i] == (int32_t)key) << i;
+	}
+
+	return mask;
+}
+
+/**
+ * This function finds 4 byte keys greater than a key one at a time.
+ * @param block This is a pointer to the keys.
+ * @param count This is the number of keys.
+ * @param key This is the key to compare with.
+ * @return This returns the mask of matching keys.
+ */
+static uint64_t ll_greater32Scalar(const void* block, uint32_t count, int64_t key){
+	const int32_t* values = (const int32_t*)block;
+	uint64_t mask = 0;
+
+	for(uint32_t i = 0; i < count; i++){
+		mask |= (uint64_t)(values[i] > (int32_t)key) << i;
+	}
+
+	return mask;
+}
+
+/**
+ * This function compares 8 byte keys for equality one at a time.
+ * @param block This is a pointer to the keys.
+ * @param count This is the number of keys.
+ * @param key This is the key to compare with.
+ * @return This returns the mask of matching keys.
+ */
+static uint64_t ll_equal64Scalar(const void* block, uint32_t count, int64_t key){
+	const int64_t* values = (const int64_t*)block;
+	uint64_t mask = 0;
+
+	for(uint32_t i = 0; i < count; i++){
+		mask |= (uint64_t)(values[i] == key) << i;
+	}
+
+	return mask;
+}
+
+/**
+ * This function finds 8 byte keys greater than a key one at a time.
+ * @param block This is a pointer to the keys.
+ * @param count This is the number of keys.
+ * @param key This is the key to compare with.
+ * @return This returns the mask of matching keys.
+ */
+static uint64_t ll_greater64Scalar(const void* block, uint32_t count, int64_t key){
+	const int64_t* values = (const int64_t*)block;
+	uint64_t mask = 0;
+
+	for(uint32_t i = 0; i < count; i++){
+		mask |= (uint64_t)(values[i] > key) << i;
+	}
+
+	return mask;
+}
+
+#ifdef LL_SEARCH_X86
+
+/**
+ * This function compares 4 byte keys for equality four at a time with SSE.
+ * @param block This is a pointer to the keys.
+ * @param count This is the number of keys.
+ * @param key This is the key to compare with.
+ * @return This returns the mask of matching keys.
+ */
+__attribute__((target("sse4.2")))
+static uint64_t ll_equal32Sse(const void* block, uint32_t count, int64_t key){
+	const int32_t* values = (const int32_t*)block;
+	__m128i keys = _mm_set1_epi32((int32_t)key);
+	uint64_t mask = 0;
+	uint32_t i = 0;
+
+	for(; (i + 4) <= count; i += 4){
+		__m128i result = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)&values[i]), keys);
+		mask |= (uint64_t)_mm_movemask_ps(_mm_castsi128_ps(result)) << i;
+	}
+
+	// Compare the keys left over after the last full vector one at a time
+	if(i < count){
+		mask |= ll_equal32Scalar(&values[i], count - i, key) << i;
+	}
+
+	return mask;
+}
+
+/**
+ * This function finds 4 byte keys greater than a key four at a time with SSE.
+ * @param block This is a pointer to the keys.
+ * @param count This is the number of keys.
+ * @param key This is the key to compare with.
+ * @return This returns the mask of matching keys.
+ */
+__attribute__((target("sse4.2")))
+static uint64_t ll_greater32Sse(const void* block, uint32_t count, int64_t key){
+	const int32_t* values = (const int32_t*)block;
+	__m128i keys = _mm_set1_epi32((int32_t)key);
+	uint64_t mask = 0;
+	uint32_t i = 0;
+
+	for(; (i + 4) <= count; i += 4){
+		__m128i result = _mm_cmpgt_epi32(_mm_loadu_si128((const __m128i*)&values[i]), keys);
+		mask |= (uint64_t)_mm_movemask_ps(_mm_castsi128_ps(result)) << i;
+	}
+
+	// Compare the keys left over after the last full vector one at a time
+	if(i < count){
+		mask |= ll_greater32Scalar(&values[i], count - i, key) << i;
+	}
+
+	return mask;
+}
+
+/**
+ * This function compares 8 byte keys for equality two at a time with SSE.
+ * @param block This is a pointer to the keys.
+ * @param count This is the number of keys.
+ * @param key This is the key to compare with.
+ * @return This returns the mask of matching keys.
+ */
+__attribute__((target("sse4.2")))
+static uint64_t ll_equal64Sse(const void* block, uint32_t count, int64_t key){
+	const int64_t* values = (const int64_t*)block;
+	__m128i keys = _mm_set1_epi64x(key);
+	uint64_t mask = 0;
+	uint32_t i = 0;
+
+	for(; (i + 2) <= count; i += 2){
+		__m128i result = _mm_cmpeq_epi64(_mm_loadu_si128((const __m128i*)&values[i]), keys);
+		mask |= (uint64_t)_mm_movemask_pd(_mm_castsi128_pd(result)) << i;
+	}
+
+	// Compare the keys left over after the last full vector one at a time
+	if(i < count){
+		mask |= ll_equal64Scalar(&values[i], count - i, key) << i;
+	}
+
+	return mask;
+}
+
+/**
+ * This function finds 8 byte keys greater than a key two at a time with SSE.
+ * @param block This is a pointer to the keys.
+ * @param count This is the number of keys.
+ * @param key This is the key to compare with.
+ * @return This returns the mask of matching keys.
+ */
+__attribute__((target("sse4.2")))
+static uint64_t ll_greater64Sse(const void* block, uint32_t count, int64_t key){
+	const int64_t* values = (const int64_t*)block;
+	__m128i keys = _mm_set1_epi64x(key);
+	uint64_t mask = 0;
+	uint32_t i = 0;
+
+	for(; (i + 2) <= count; i += 2){
+		__m128i result = _mm_cmpgt_epi64(_mm_loadu_si128((const __m128i*)&values[i]), keys);
+		mask |= (uint64_t)_mm_movemask_pd(_mm_castsi128_pd(result)) << i;
+	}
+
+	// Compare the keys left over after the last full vector one at a time
+	if(i < count){
+		mask |= ll_greater64Scalar(&values[i], count - i, key) << i;
+	}
+
+	return mask;
+}
+
+/**
+ * This function compares 4 byte keys for equality eight at a time with AVX2.
+ * @param block This is a pointer to the keys.
+ * @param count This is the number of keys.
+ * @param key This is the key to compare with.
+ * @return This returns the mask of matching keys.
+ */
+__attribute__((target("avx2")))
+static uint64_t ll_equal32Avx2(const void* block, uint32_t count, int64_t key){
+	const int32_t* values = (const int32_t*)block;
+	__m256i keys = _mm256_set1_epi32((int32_t)key);
+	uint64_t mask = 0;
+	uint32_t i = 0;
+
+	for(; (i + 8) <= count; i += 8){
+		__m256i result = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)&values[i]), keys);
+		mask |= (uint64_t)_mm256_movemask_ps(_mm256_castsi256_ps(result)) << i;
+	}
+
+	// Compare the keys left over after the last full vector one at a time
+	if(i < count){
+		mask |= ll_equal32Scalar(&values[i], count - i, key) << i;
+	}
+
+	return mask;
+}
+
+/**
+ * This function finds 4 byte keys greater than a key eight at a time with AVX2.
+ * @param block This is a pointer to the keys.
+ * @param count This is the number of keys.
+ * @param key This is the key to compare with.
+ * @return This returns the mask of matching keys.
+ */
+__attribute__((target("avx2")))
+static uint64_t ll_greater32Avx2(const void* block, uint32_t count, int64_t key){
+	const int32_t* values = (const int32_t*)block;
+	__m256i keys = _mm256_set1_epi32((int32_t)key);
+	uint64_t mask = 0;
+	uint32_t i = 0;
+
+	for(; (i + 8) <= count; i += 8){
+		__m256i result = _mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i*)&values[i]), keys);
+		mask |= (uint64_t)_mm256_movemask_ps(_mm256_castsi256_ps(result)) << i;
+	}
+
+	// Compare the keys left over after the last full vector one at a time
+	if(i < count){
+		mask |= ll_greater32Scalar(&values[i], count - i, key) << i;
+	}
+
+	return mask;
+}
+
+/**
+ * This function compares 8 byte keys for equality four at a time with AVX2.
+ * @param block This is a pointer to the keys.
+ * @param count This is the number of keys.
+ * @param key This is the key to compare with.
+ * @return This returns the mask of matching keys.
+ */
+__attribute__((target("avx2")))
+static uint64_t ll_equal64Avx2(const void* block, uint32_t count, int64_t key){
+	const int64_t* values = (const int64_t*)block;
+	__m256i keys = _mm256_set1_epi64x(key);
+	uint64_t mask = 0;
+	uint32_t i = 0;
+
+	for(; (i + 4) <= count; i += 4){
+		__m256i result = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)&values[i]), keys);
+		mask |= (uint64_t)_mm256_movemask_pd(_mm256_castsi256_pd(result)) << i;
+	}
+
+	// Compare the keys left over after the last full vector one at a time
+	if(i < count){
+		mask |= ll_equal64Scalar(&values[i], count - i, key) << i;
+	}
+
+	return mask;
+}
+
+/**
+ * This function finds 8 byte keys greater than a key four at a time with AVX2.
+ * @param block This is a pointer to the keys.
+ * @param count This is the number of keys.
+ * @param key This is the key to compare with.
+ * @return This returns the mask of matching keys.
+ */
+__attribute__((target("avx2")))
+static uint64_t ll_greater64Avx2(const void* block, uint32_t count, int64_t key){
+	const int64_t* values = (const int64_t*)block;
+	__m256i keys = _mm256_set1_epi64x(key);
+	uint64_t mask = 0;
+	uint32_t i = 0;
+
+	for(; (i + 4) <= count; i += 4){
+		__m256i result = _mm256_cmpgt_epi64(_mm256_loadu_si256((const __m256i*)&values[i]), keys);
+		mask |= (uint64_t)_mm256_movemask_pd(_mm256_castsi256_pd(result)) << i;
+	}
+
+	// Compare the keys left over after the last full vector one at a time
+	if(i < count){
+		mask |= ll_greater64Scalar(&values[i], count - i, key) << i;
+	}
+
+	return mask;
+}
+
+#endif /*LL_SEARCH_X86*/
+
+/**
+ * This function picks the fastest kernels the processor supports.
+ */
+static void ll_selectKernels(void){
+	kernels.equal32 = ll_equal32Scalar;
+	kernels.greater32 = ll_greater32Scalar;
+	kernels.equal64 = ll_equal64Scalar;
+	kernels.greater64 = ll_greater64Scalar;
+
+#ifdef LL_SEARCH_X86
+	__builtin_cpu_init();
+
+	if(__builtin_cpu_supports("avx2")){
+		kernels.equal32 = ll_equal32Avx2;
+		kernels.greater32 = ll_greater32Avx2;
+		kernels.equal64 = ll_equal64Avx2;
+		kernels.greater64 = ll_greater64Avx2;
+	}
+	else if(__builtin_cpu_supports("sse4.2")){
+		kernels.equal32 = ll_equal32Sse;
+		kernels.greater32 = ll_greater32Sse;
+		kernels.equal64 = ll_equal64Sse;
+		kernels.greater64 = ll_greater64Sse;
+	}
+#endif
+}
+
+/**
+ * This function searches a list block by block.
+ * @param list This is a pointer to the list to search.
+ * @param key This is a pointer to the key.
+ * @param keySize This is the size of the key in bytes, 4 or 8.
+ * @param greater This is true to look for greater elements, false to look for equal ones.
+ * @param countAll This is true to count every match, false to stop at the first one.
+ * @param index This is a pointer that receives the index of the first match, may be NULL.
+ * @return This returns the number of matches found.
+ */
+static ll_size_t ll_search(struct linkedList* list, const void* key, uint32_t keySize, bool greater, bool countAll, ll_size_t* index){
+	ll_size_t matches = 0;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (key != NULL) && ((keySize == 4) || (keySize == 8))){
+		int64_t block[LL_SEARCH_BLOCK] __attribute__((aligned(32)));
+		struct listNode* node = list->head;
+		ll_size_t position = 0;
+		ll_searchKernel kernel;
+		int64_t value;
+
+		pthread_once(&kernelsOnce, ll_selectKernels);
+
+		// Widen the key so every kernel takes the same argument
+		if(keySize == 4){
+			int32_t narrow;
+			memcpy(&narrow, key, sizeof(narrow));
+			value = narrow;
+			kernel = greater ? kernels.greater32 : kernels.equal32;
+		}
+		else{
+			memcpy(&value, key, sizeof(value));
+			kernel = greater ? kernels.greater64 : kernels.equal64;
+		}
+
+		while((node != NULL) && (countAll || (matches == 0))){
+			uint64_t valid = 0;
+			uint64_t found;
+			uint32_t lanes = 0;
+
+			// Gather the next block of keys, remembering which nodes have the right size
+			while((node != NULL) && (lanes < LL_SEARCH_BLOCK)){
+				if(node->nextNode != NULL){
+					__builtin_prefetch(node->nextNode);
+				}
+				if(node->dataSize != keySize){
+					// The kernels read every lane, so lanes of other sizes are zeroed rather than left stale
+					memset((char*)block + (lanes * keySize), 0, keySize);
+				}
+				else if(keySize == 4){
+					memcpy((char*)block + (lanes * 4), ll_nodeData(node), 4);
+					valid |= (uint64_t)1 << lanes;
+				}
+				else{
+					memcpy((char*)block + (lanes * 8), ll_nodeData(node), 8);
+					valid |= (uint64_t)1 << lanes;
+				}
+				lanes = lanes + 1;
+				node = node->nextNode;
+			}
+
+			found = kernel(block, lanes, value) & valid;
+
+			if(found != 0){
+				if((matches == 0) && (index != NULL)){
+					*index = position + (ll_size_t)__builtin_ctzll(found);
+				}
+				matches = matches + (ll_size_t)__builtin_popcountll(found);
+			}
+
+			position = position + lanes;
+		}
+	}
+
+	return matches;
+}
+
+/**
+ * This function finds the first element equal to a key.
+ * @param list This is a pointer to the list to search.
+ * @param key This is a pointer to the key.
+ * @param keySize This is the size of the key in bytes, 4 or 8.
+ * @param index This is a pointer that receives the index of the element, may be NULL.
+ * @return This returns true if an equal element was found, false otherwise.
+ */
+bool ll_findEq(struct linkedList* list, const void* key, uint32_t keySize, ll_size_t* index){
+	return ll_search(list, key, keySize, false, false, index) != 0;
+}
+
+/**
+ * This function counts the elements equal to a key.
+ * @param list This is a pointer to the list to search.
+ * @param key This is a pointer to the key.
+ * @param keySize This is the size of the key in bytes, 4 or 8.
+ * @return This returns the number of equal elements.
+ */
+ll_size_t ll_count(struct linkedList* list, const void* key, uint32_t keySize){
+	return ll_search(list, key, keySize, false, true, NULL);
+}
+
+/**
+ * This function finds the first element greater than a key.
+ * @param list This is a pointer to the list to search.
+ * @param key This is a pointer to the key.
+ * @param keySize This is the size of the key in bytes, 4 or 8.
+ * @param index This is a pointer that receives the index of the element, may be NULL.
+ * @return This returns true if a greater element was found, false otherwise.
+ */
+bool ll_findFirstGreater(struct linkedList* list, const void* key, uint32_t keySize, ll_size_t* index){
+	return ll_search(list, key, keySize, true, false, index) != 0;
+}
@@ -0,0 +1,440 @@
+/**
+ * This file contains the implementation of the node pool functions using the structures
+ * defined in the header file. The magazine layer follows "Magazines and Vmem" by Bonwick and
+ * Adams: a thread holds a loaded and a spare magazine and only trades with the depot when both
+ * are empty or both are full, so at least a magazine worth of operations passes between
+ * trips to the depot lock.
+ * @file nodepool.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "nodepool.h"
+#include "linkedlist.h"
+
+#include <malloc.h>
+#include <pthread.h>
+#include <stdlib.h>
+
+#ifdef LL_HUGE_PAGES
+#include <sys/mman.h>
+#endif
+
+/**
+ * The number of nodes a magazine holds.
+ */
+#define NP_MAGAZINE_SIZE 64
+
+/**
+ * The number of magazines of free nodes the depot keeps. Threads that free nodes beyond this
+ * give them back to the system, which bounds the memory the pool holds on to.
+ */
+#define NP_DEPOT_LIMIT 256
+
+/**
+ * This structure is a stack of free nodes.
+ */
+struct nodeMagazine {
+	uint32_t count; // The number of nodes in the magazine
+	struct nodeMagazine* next; // The next magazine in the depot
+	void* nodes[NP_MAGAZINE_SIZE]; // The free nodes
+};
+
+/**
+ * This structure holds the magazines of one thread.
+ */
+struct nodeCache {
+	struct nodeMagazine* loaded; // The magazine nodes are taken from and freed to
+	struct nodeMagazine* spare; // The magazine swapped in when the loaded one is empty or full
+};
+
+static pthread_mutex_t depotLock = PTHREAD_MUTEX_INITIALIZER; // Protects the depot and its counters
+static struct nodeMagazine* fullMagazines = NULL; // Depot magazines holding nodes
+static struct nodeMagazine* emptyMagazines = NULL; // Depot magazines holding no nodes
+static uint32_t fullCount = 0; // The number of magazines in fullMagazines
+static struct nodePoolStats poolStats; // The counters of the pool
+
+#ifdef LL_HUGE_PAGES
+/**
+ * The size of a transparent huge page on x86-64 and most arm64 kernels.
+ */
+#define NP_HUGE_PAGE_SIZE ((size_t)2 << 20)
+
+/**
+ * The size of the chunks the node store maps at a time.
+ */
+#define NP_STORE_CHUNK (32 * NP_HUGE_PAGE_SIZE)
+
+/**
+ * This structure is a free node in the node store.
+ */
+struct storeNode {
+	struct storeNode* next; // The next free node
+};
+
+static char* storeNext = NULL; // The next unused node in the current chunk, protected by depotLock
+static char* storeEnd = NULL; // The end of the current chunk
+static struct storeNode* storeFree = NULL; // Nodes given back to the store
+#endif
+
+static __thread struct nodeCache cache; // The magazines of the calling thread
+
+static pthread_once_t cacheKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t cacheKey; // Returns the magazines of a thread to the depot when it exits
+
+#ifdef LL_HUGE_PAGES
+/**
+ * This function maps a new chunk for the node store. The depot lock must be held.
+ * @return This returns true if a chunk was mapped, false if the system has no memory left.
+ */
+static bool np_mapChunk(void){
+	size_t size = NP_STORE_CHUNK + NP_HUGE_PAGE_SIZE;
+	char* region = (char*)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	bool mapped = false;
+
+	if(region != MAP_FAILED){
+		char* aligned = (char*)(((uintptr_t)region + NP_HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(NP_HUGE_PAGE_SIZE - 1));
+		size_t tail = (size_t)((region + size) - (aligned + NP_STORE_CHUNK));
+
+		// Give back the ends of the mapping so the chunk starts on a huge page boundary
+		if(aligned != region){
+			munmap(region, (size_t)(aligned - region));
+		}
+		if(tail != 0){
+			munmap(aligned + NP_STORE_CHUNK, tail);
+		}
+		madvise(aligned, NP_STORE_CHUNK, MADV_HUGEPAGE);
+
+		storeNext = aligned;
+		storeEnd = aligned + NP_STORE_CHUNK;
+		poolStats.storeBytes = poolStats.storeBytes + NP_STORE_CHUNK;
+		mapped = true;
+	}
+
+	return mapped;
+}
+
+/**
+ * This function fills an empty magazine with nodes from the node store, so the lock is taken
+ * once per magazine rather than once per node.
+ * @param magazine This is a pointer to the magazine to fill.
+ */
+static void np_refill(struct nodeMagazine* magazine){
+	bool available = true;
+
+	pthread_mutex_lock(&depotLock);
+	while((magazine->count < NP_MAGAZINE_SIZE) && available){
+		if(storeFree != NULL){
+			magazine->nodes[magazine->count] = storeFree;
+			storeFree = storeFree->next;
+			magazine->count = magazine->count + 1;
+		}
+		else if((storeNext + sizeof(struct listNode)) <= storeEnd){
+			magazine->nodes[magazine->count] = storeNext;
+			storeNext = storeNext + sizeof(struct listNode);
+			magazine->count = magazine->count + 1;
+		}
+		else{
+			available = np_mapChunk();
+		}
+	}
+	pthread_mutex_unlock(&depotLock);
+
+	// Without room for another chunk a node still fits on the heap, and the store takes it later
+	if(magazine->count == 0){
+		magazine->nodes[0] = malloc(sizeof(struct listNode));
+		magazine->count = 1;
+	}
+
+	// The magazine is a stack, so reverse it to hand fresh nodes out in address order
+	for(uint32_t i = 0; i < (magazine->count / 2); i++){
+		void* temp = magazine->nodes[i];
+
+		magazine->nodes[i] = magazine->nodes[magazine->count - 1 - i];
+		magazine->nodes[magazine->count - 1 - i] = temp;
+	}
+
+	__atomic_add_fetch(&poolStats.systemAllocations, magazine->count, __ATOMIC_RELAXED);
+}
+#endif
+
+/**
+ * This function gives every node in a magazine back to the system, or to the node store when
+ * built with LL_HUGE_PAGES.
+ * @param magazine This is a pointer to the magazine to empty.
+ * @return This returns the number of nodes given back.
+ */
+static uint32_t np_drain(struct nodeMagazine* magazine){
+	uint32_t count = magazine->count;
+
+#ifdef LL_HUGE_PAGES
+	pthread_mutex_lock(&depotLock);
+	for(uint32_t i = 0; i < count; i++){
+		struct storeNode* node = (struct storeNode*)magazine->nodes[i];
+
+		node->next = storeFree;
+		storeFree = node;
+	}
+	pthread_mutex_unlock(&depotLock);
+#else
+	for(uint32_t i = 0; i < count; i++){
+		free(magazine->nodes[i]);
+	}
+#endif
+	magazine->count = 0;
+
+	__atomic_add_fetch(&poolStats.systemFrees, count, __ATOMIC_RELAXED);
+
+	return count;
+}
+
+/**
+ * This function hands a magazine to the depot. The depot lock must be held.
+ * @param magazine This is a pointer to the magazine.
+ * @return This returns true if the depot took the magazine, false if it is full and the
+ *         caller still owns the magazine.
+ */
+static bool np_deposit(struct nodeMagazine* magazine){
+	bool taken = true;
+
+	if(magazine->count == 0){
+		magazine->next = emptyMagazines;
+		emptyMagazines = magazine;
+	}
+	else if(fullCount < NP_DEPOT_LIMIT){
+		magazine->next = fullMagazines;
+		fullMagazines = magazine;
+		fullCount = fullCount + 1;
+		poolStats.depotNodes = poolStats.depotNodes + magazine->count;
+	}
+	else{
+		taken = false;
+	}
+
+	return taken;
+}
+
+/**
+ * This function returns the magazines of an exiting thread to the depot.
+ * @param argument This is a pointer to the cache of the thread.
+ */
+static void np_threadExit(void* argument){
+	struct nodeCache* exiting = (struct nodeCache*)argument;
+	struct nodeMagazine* magazines[2] = {exiting->loaded, exiting->spare};
+
+	exiting->loaded = NULL;
+	exiting->spare = NULL;
+
+	for(int i = 0; i < 2; i++){
+		bool taken;
+
+		pthread_mutex_lock(&depotLock);
+		taken = np_deposit(magazines[i]);
+		pthread_mutex_unlock(&depotLock);
+
+		if(!taken){
+			np_drain(magazines[i]);
+			free(magazines[i]);
+		}
+	}
+}
+
+/**
+ * This function creates the thread specific key used to return magazines.
+ */
+static void np_createKey(void){
+	pthread_key_create(&cacheKey, np_threadExit);
+}
+
+/**
+ * This function returns the cache of the calling thread, setting it up on first use.
+ * @return This returns a pointer to the cache.
+ */
+static struct nodeCache* np_cache(void){
+	if(cache.loaded == NULL){
+		pthread_once(&cacheKeyOnce, np_createKey);
+
+		cache.loaded = (struct nodeMagazine*)malloc(sizeof(struct nodeMagazine));
+		cache.spare = (struct nodeMagazine*)malloc(sizeof(struct nodeMagazine));
+		cache.loaded->count = 0;
+		cache.spare->count = 0;
+
+		pthread_setspecific(cacheKey, &cache);
+	}
+
+	return &cache;
+}
+
+/**
+ * This function swaps the loaded and spare magazines of a cache.
+ * @param local This is a pointer to the cache.
+ */
+static void np_swap(struct nodeCache* local){
+	struct nodeMagazine* temp = local->loaded;
+
+	local->loaded = local->spare;
+	local->spare = temp;
+}
+
+/**
+ * This function allocates a node from the pool of the calling thread.
+ * @return This returns a pointer to memory for one struct listNode.
+ */
+void* np_alloc(void){
+	struct nodeCache* local = np_cache();
+	void* node = NULL;
+
+	if(local->loaded->count == 0){
+		if(local->spare->count != 0){
+			np_swap(local);
+		}
+		else{
+			// Both magazines are empty, so trade the loaded one for a full one from the depot
+			pthread_mutex_lock(&depotLock);
+			if(fullMagazines != NULL){
+				struct nodeMagazine* full = fullMagazines;
+
+				fullMagazines = full->next;
+				fullCount = fullCount - 1;
+				poolStats.depotNodes = poolStats.depotNodes - full->count;
+				poolStats.depotTrades = poolStats.depotTrades + 1;
+
+				np_deposit(local->loaded);
+				local->loaded = full;
+			}
+			pthread_mutex_unlock(&depotLock);
+		}
+	}
+
+#ifdef LL_HUGE_PAGES
+	if(local->loaded->count == 0){
+		np_refill(local->loaded);
+	}
+#endif
+
+	if(local->loaded->count != 0){
+		local->loaded->count = local->loaded->count - 1;
+		node = local->loaded->nodes[local->loaded->count];
+	}
+	else{
+		node = malloc(sizeof(struct listNode));
+		__atomic_add_fetch(&poolStats.systemAllocations, 1, __ATOMIC_RELAXED);
+	}
+
+	return node;
+}
+
+/**
+ * This function returns a node to the pool of the calling thread.
+ * @param node This is a pointer to a node allocated with np_alloc, may be NULL.
+ */
+void np_free(void* node){
+	// Checks if the node parameter is NULL to avoid storing it
+	if(node != NULL){
+		struct nodeCache* local = np_cache();
+
+		if(local->loaded->count == NP_MAGAZINE_SIZE){
+			if(local->spare->count != NP_MAGAZINE_SIZE){
+				np_swap(local);
+			}
+			else{
+				struct nodeMagazine* empty = NULL;
+				bool taken;
+
+				// Both magazines are full, so trade the spare one for an empty one from the depot
+				pthread_mutex_lock(&depotLock);
+				taken = np_deposit(local->spare);
+				if(taken){
+					empty = emptyMagazines;
+					if(empty != NULL){
+						emptyMagazines = empty->next;
+					}
+					poolStats.depotTrades = poolStats.depotTrades + 1;
+				}
+				pthread_mutex_unlock(&depotLock);
+
+				if(taken){
+					if(empty == NULL){
+						empty = (struct nodeMagazine*)malloc(sizeof(struct nodeMagazine));
+						empty->count = 0;
+					}
+					local->spare = local->loaded;
+					local->loaded = empty;
+				}
+				else{
+					// The depot holds as many nodes as it may, so these go back to the system
+					np_drain(local->loaded);
+				}
+			}
+		}
+
+		local->loaded->nodes[local->loaded->count] = node;
+		local->loaded->count = local->loaded->count + 1;
+	}
+}
+
+/**
+ * This function gives the free nodes held by the depot and by the magazines of the calling
+ * thread back to the system.
+ * @return This returns the number of nodes given back.
+ */
+size_t np_trim(void){
+	struct nodeMagazine* full;
+	struct nodeMagazine* empty;
+	size_t trimmed = 0;
+
+	// Take every magazine out of the depot and free them without holding the lock
+	pthread_mutex_lock(&depotLock);
+	full = fullMagazines;
+	empty = emptyMagazines;
+	fullMagazines = NULL;
+	emptyMagazines = NULL;
+	fullCount = 0;
+	poolStats.depotNodes = 0;
+	pthread_mutex_unlock(&depotLock);
+
+	while(full != NULL){
+		struct nodeMagazine* temp = full;
+		full = full->next;
+		trimmed = trimmed + np_drain(temp);
+		free(temp);
+	}
+	while(empty != NULL){
+		struct nodeMagazine* temp = empty;
+		empty = empty->next;
+		free(temp);
+	}
+
+	if(cache.loaded != NULL){
+		trimmed = trimmed + np_drain(cache.loaded) + np_drain(cache.spare);
+	}
+
+	malloc_trim(0);
+
+	return trimmed;
+}
+
+/**
+ * This function reads the counters of the node pool.
+ * @param stats This is a pointer to the structure that receives the counters.
+ * @return This returns true if the counters were read, false if stats is NULL.
+ */
+bool np_stats(struct nodePoolStats* stats){
+	bool completed = false;
+
+	// Checks if the stats parameter is NULL to avoid a null pointer dereference
+	if(stats != NULL){
+		pthread_mutex_lock(&depotLock);
+		stats->depotTrades = poolStats.depotTrades;
+		stats->depotNodes = poolStats.depotNodes;
+		stats->storeBytes = poolStats.storeBytes;
+		pthread_mutex_unlock(&depotLock);
+
+		stats->systemAllocations = __atomic_load_n(&poolStats.systemAllocations, __ATOMIC_RELAXED);
+		stats->systemFrees = __atomic_load_n(&poolStats.systemFrees, __ATOMIC_RELAXED);
+
+		completed = true;
+	}
+
+	return completed;
+}
@@ -0,0 +1,63 @@
+/**
+ * This file contains the interface for the node pool shared by every linked list. Each thread
+ * keeps two magazines of free nodes it allocates from and frees to without locking, and only
+ * goes to the shared depot to trade a full or empty magazine. A node may be freed on a
+ * different thread than the one that allocated it.
+ *
+ * When the library is built with LL_HUGE_PAGES, nodes come from a store of 64 MB chunks
+ * aligned to 2 MB and marked for transparent huge pages, instead of one malloc per node.
+ * Nodes allocated together then sit next to each other and a traversal touches far fewer
+ * pages. The store keeps its chunks for the life of the process, so nodes given back to the
+ * system go to the free list of the store rather than to free.
+ * @file nodepool.h
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * This structure holds counters describing the node pool.
+ */
+struct nodePoolStats
+{
+  uint64_t depotTrades; // The number of times a thread traded a magazine with the depot
+  uint64_t systemAllocations; // The number of nodes allocated from the system
+  uint64_t systemFrees; // The number of nodes given back to the system
+  uint32_t depotNodes; // The number of free nodes held by the depot right now
+  uint64_t storeBytes; // The bytes of huge page chunks mapped for nodes, 0 without LL_HUGE_PAGES
+};
+
+/**
+ * This function allocates a node from the pool of the calling thread.
+ * @return This returns a pointer to memory for one struct listNode.
+ */
+void* np_alloc(void);
+
+/**
+ * This function returns a node to the pool of the calling thread.
+ * @param node This is a pointer to a node allocated with np_alloc, may be NULL.
+ */
+void np_free(void* node);
+
+/**
+ * This function gives the free nodes held by the depot and by the magazines of the calling
+ * thread back to the system, and asks the allocator to return free memory to the operating
+ * system. Other threads keep their magazines until they trade with the depot or exit.
+ * @return This returns the number of nodes given back.
+ */
+size_t np_trim(void);
+
+/**
+ * This function reads the counters of the node pool.
+ * @param stats This is a pointer to the structure that receives the counters.
+ * @return This returns true if the counters were read, false if stats is NULL.
+ */
+bool np_stats(struct nodePoolStats* stats);
+
+#endif /*NODEPOOL_H*/
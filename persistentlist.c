@@ -0,0 +1,350 @@
+/**
+ * This file contains the implementation of the persistent linked list functions using the
+ * structures defined in the header file. Versions share nodes through reference counts, and
+ * nodes share their data through a reference counted header stored in front of the data.
+ * @file persistentlist.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "persistentlist.h"
+
+/**
+ * This structure is stored in front of the data of every persistent node. It is 16 bytes long
+ * so the data following it keeps the alignment malloc guarantees.
+ */
+struct persistentPayload {
+	uint32_t refCount; // The number of nodes sharing the data
+	uint32_t reserved[3]; // Keeps the data that follows aligned
+};
+
+/**
+ * This function returns the shared header in front of node data.
+ * @param data This is a pointer to the data of a persistent node.
+ * @return This returns a pointer to the header of the data.
+ */
+static struct persistentPayload* pl_payload(const void* data){
+	return ((struct persistentPayload*)data) - 1;
+}
+
+/**
+ * This function allocates a node that holds a new reference to shared data.
+ * @param data This is a pointer to the shared data, which gains a reference.
+ * @param size This is the size of the data in bytes.
+ * @return This returns a pointer to the new node with a reference count of one.
+ */
+static struct persistentNode* pl_newNode(const void* data, uint32_t size){
+	struct persistentNode* node = (struct persistentNode*)malloc(sizeof(struct persistentNode));
+
+	__atomic_add_fetch(&pl_payload(data)->refCount, 1, __ATOMIC_RELAXED);
+
+	node->data = data;
+	node->dataSize = size;
+	node->refCount = 1;
+	node->nextNode = NULL;
+
+	return node;
+}
+
+/**
+ * This function takes an additional reference to a node.
+ * @param node This is a pointer to the node, may be NULL.
+ */
+static void pl_retainNode(struct persistentNode* node){
+	if(node != NULL){
+		__atomic_add_fetch(&node->refCount, 1, __ATOMIC_RELAXED);
+	}
+}
+
+/**
+ * This function drops a reference to a node. Nodes and data no longer referenced are freed, and
+ * the reference a freed node held to its successor is dropped in turn.
+ * @param node This is a pointer to the node, may be NULL.
+ */
+static void pl_releaseNode(struct persistentNode* node){
+	// Walk down the chain for as long as the last reference to a node is dropped
+	while((node != NULL) && (__atomic_sub_fetch(&node->refCount, 1, __ATOMIC_ACQ_REL) == 0)){
+		struct persistentNode* next = node->nextNode;
+		struct persistentPayload* payload = pl_payload(node->data);
+
+		if(__atomic_sub_fetch(&payload->refCount, 1, __ATOMIC_ACQ_REL) == 0){
+			free(payload);
+		}
+		free(node);
+
+		node = next;
+	}
+}
+
+/**
+ * This function makes sure the nodes in front of an index belong to this version only, copying
+ * the ones that are shared with other versions. A node is owned by this version if its only
+ * reference comes from this version, and once a shared node has been copied its successor gains
+ * a reference from the copy, so every later node in the prefix is copied as well.
+ * @param list This is a pointer to the version to change.
+ * @param index This is the number of nodes to take ownership of.
+ * @return This returns a pointer to the link that points at the node at the index.
+ */
+static struct persistentNode** pl_ownPrefix(struct persistentList* list, uint32_t index){
+	struct persistentNode** link = &list->head;
+
+	for(uint32_t i = 0; i < index; i++){
+		struct persistentNode* node = *link;
+
+		// Copy the node if another version can reach it
+		if(__atomic_load_n(&node->refCount, __ATOMIC_ACQUIRE) != 1){
+			struct persistentNode* copy = pl_newNode(node->data, node->dataSize);
+
+			copy->nextNode = node->nextNode;
+			pl_retainNode(copy->nextNode);
+
+			*link = copy;
+			pl_releaseNode(node);
+		}
+
+		link = &(*link)->nextNode;
+	}
+
+	return link;
+}
+
+/**
+ * This function initializes a persistent list to an empty version.
+ * @param list This is a pointer to the list to initialize.
+ */
+void pl_init(struct persistentList* list){
+	// Checks if the list parameter is NULL to avoid a null pointer dereference
+	if(list != NULL){
+		list->head = NULL;
+		list->size = 0;
+	}
+}
+
+/**
+ * This function makes a new version that shares all of its nodes with an existing one.
+ * @param list This is a pointer to the version to take a snapshot of.
+ * @param snapshot This is a pointer to an initialized or cleared list that receives the snapshot.
+ * @return This returns true if the snapshot was taken, false if it failed.
+ */
+bool pl_snapshot(const struct persistentList* list, struct persistentList* snapshot){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (snapshot != NULL) && (list != snapshot)){
+		// Release whatever the snapshot held before so nothing leaks
+		pl_clear(snapshot);
+
+		pl_retainNode(list->head);
+		snapshot->head = list->head;
+		snapshot->size = list->size;
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function adds an element to the end of a version.
+ * @param list This is a pointer to the version to add to.
+ * @param object This is a pointer to the object to be added to the list.
+ * @param size This is the size of the object being added in bytes.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool pl_add(struct persistentList* list, const void* object, uint32_t size){
+	bool completed = false;
+
+	// Check if list is NULL to avoid null pointer dereferencing
+	if(list != NULL){
+		completed = pl_addIndex(list, object, size, list->size);
+	}
+
+	return completed;
+}
+
+/**
+ * This function adds an element to a version at the desired index.
+ * @param list This is a pointer to the version to add to.
+ * @param object This is a pointer to the object to be added to the list.
+ * @param size This is the size of the object being added in bytes.
+ * @param index This is the index to add the object at.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool pl_addIndex(struct persistentList* list, const void* object, uint32_t size, uint32_t index){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferencing and index out of bounds errors
+	if((list != NULL) && (object != NULL) && (size != 0) && (index <= list->size)){
+		// Copy the object into data that can be shared between versions
+		struct persistentPayload* payload = (struct persistentPayload*)malloc(sizeof(struct persistentPayload) + size);
+		payload->refCount = 0;
+		memcpy(payload + 1, object, size);
+
+		struct persistentNode* node = pl_newNode(payload + 1, size);
+		struct persistentNode** link = pl_ownPrefix(list, index);
+
+		// The new node takes over the reference the link held to the rest of the list
+		node->nextNode = *link;
+		*link = node;
+
+		list->size = list->size + 1;
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function removes an object from a version at a given index.
+ * @param list This is a pointer to the version to remove from.
+ * @param index This is the index to remove the object from.
+ * @return This returns true if the remove was successful, false if it failed.
+ */
+bool pl_remove(struct persistentList* list, uint32_t index){
+	bool completed = false;
+
+	// Check if the parameters are valid to avoid null pointer dereferencing and index out of bounds errors
+	if((list != NULL) && (index < list->size)){
+		struct persistentNode** link = pl_ownPrefix(list, index);
+		struct persistentNode* removed = *link;
+
+		// Link past the removed node, which may still be used by other versions
+		pl_retainNode(removed->nextNode);
+		*link = removed->nextNode;
+		pl_releaseNode(removed);
+
+		list->size = list->size - 1;
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function gets the object from the desired index of a version.
+ * @param list This is a pointer to the version to get the object from.
+ * @param index This is the index to get the object from.
+ * @return This returns a pointer to the shared data, or NULL if the index is out of range.
+ */
+const void* pl_get(const struct persistentList* list, uint32_t index){
+	const void* result = NULL;
+
+	// Check if the parameters are valid values to avoid null pointer dereferences and index out of bounds errors
+	if((list != NULL) && (index < list->size)){
+		struct persistentNode* node = list->head;
+
+		// Walk to the node to retrieve data from
+		for(uint32_t i = 0; i < index; i++){
+			node = node->nextNode;
+		}
+
+		result = node->data;
+	}
+
+	return result;
+}
+
+/**
+ * This function releases a version.
+ * @param list This is a pointer to the version to be cleared.
+ */
+void pl_clear(struct persistentList* list){
+	// Check if list is NULL to avoid null pointer dereferencing
+	if(list != NULL){
+		pl_releaseNode(list->head);
+		pl_init(list);
+	}
+}
+
+/**
+ * This function returns the number of elements in a version.
+ * @param list This is a pointer to the version to return the size of.
+ * @return This returns the size of the version.
+ */
+uint32_t pl_size(const struct persistentList* list){
+	uint32_t num = 0;
+
+	// Check if list is NUll to avoid null pointer dereferencing
+	if(list != NULL){
+		num = list->size;
+	}
+
+	return num;
+}
+
+/**
+ * This function builds a version holding a copy of every element of a linked list.
+ * @param list This is a pointer to an initialized or cleared version to fill.
+ * @param source This is a pointer to the linked list to copy.
+ * @return This returns true if the version was built, false if it failed.
+ */
+bool pl_fromList(struct persistentList* list, struct linkedList* source){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((list != NULL) && (source != NULL)){
+		struct persistentNode** link;
+
+		pl_clear(list);
+		link = &list->head;
+
+		// Append behind the last node directly so building the version stays linear
+		for(struct listNode* node = source->head; node != NULL; node = node->nextNode){
+			struct persistentPayload* payload = (struct persistentPayload*)malloc(sizeof(struct persistentPayload) + node->dataSize);
+			payload->refCount = 0;
+			memcpy(payload + 1, ll_nodeData(node), node->dataSize);
+
+			*link = pl_newNode(payload + 1, node->dataSize);
+			link = &(*link)->nextNode;
+			list->size = list->size + 1;
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function creates an iterator for a version.
+ * @param list This is a pointer to the version used to create the iterator.
+ * @return This returns a pointer to the persistentListIterator structure if the iterator generated
+ *         correctly, else it returns NULL.
+ */
+struct persistentListIterator* pl_getIterator(const struct persistentList* list){
+	struct persistentListIterator* iterator = NULL;
+
+	// Checks if the list is NUll to avoid null pointer dereferencing
+	if(list != NULL){
+		iterator = (struct persistentListIterator*) malloc(sizeof(struct persistentListIterator));
+		iterator->current = list->head;
+	}
+
+	return iterator;
+}
+
+/**
+ * This function determines if an iterator has another element to retrieve.
+ * @param iter This is a pointer to the iterator check.
+ * @return This returns true if there is another element, else it returns false.
+ */
+bool pl_hasNext(struct persistentListIterator* iter){
+	return (iter != NULL) && (iter->current != NULL);
+}
+
+/**
+ * This function gets the data stored in the current node of the iterator and iterates to
+ * the next node in the version.
+ * @param iter This is a pointer to the iterator to access the data of and iterate.
+ */
+const void* pl_next(struct persistentListIterator* iter){
+	const void* data = NULL;
+
+	// Checks if the iterator and its current node are NULL to avoid null pointer dereferencing
+	if((iter != NULL) && (iter->current != NULL)){
+		data = iter->current->data;
+		iter->current = iter->current->nextNode;
+	}
+
+	return data;
+}
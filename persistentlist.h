@@ -0,0 +1,142 @@
+/**
+ * This file contains the interface for the persistent linked list. A persistent list is an
+ * immutable version of a list: changing it produces a new version that shares every node it
+ * did not have to touch with the old one, so old versions stay valid and can be read by other
+ * threads while the new version is edited.
+ * @file persistentlist.h
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#ifndef PERSISTENTLIST_H
+#define PERSISTENTLIST_H
+
+#include "linkedlist.h"
+
+/**
+ * This structure holds the data and link of an element in a persistent list. Nodes and their
+ * data are shared between versions and counted, so they must never be changed directly.
+ */
+struct persistentNode {
+  const void* data; // A pointer to the shared data contained within the node
+  uint32_t dataSize; // The size of the data in the node
+  uint32_t refCount; // The number of versions and nodes pointing at this node
+  struct persistentNode* nextNode; // A pointer to the next node in the persistent list
+};
+
+/**
+ * This structure is one version of a persistent list.
+ */
+struct persistentList
+{
+  struct persistentNode* head; // A pointer to the first node of this version
+  uint32_t size; // The number of nodes in this version
+};
+
+/**
+ * This structure provides the elements needed to iterate through a version of a persistent list.
+ */
+struct persistentListIterator
+{
+  struct persistentNode* current; // A pointer to the node the iterator is currently at
+};
+
+/**
+ * This function initializes a persistent list to an empty version.
+ * @param list This is a pointer to the list to initialize.
+ */
+void pl_init(struct persistentList* list);
+
+/**
+ * This function makes a new version that shares all of its nodes with an existing one. This
+ * takes constant time no matter how long the list is.
+ * @param list This is a pointer to the version to take a snapshot of.
+ * @param snapshot This is a pointer to an initialized or cleared list that receives the snapshot.
+ * @return This returns true if the snapshot was taken, false if it failed.
+ */
+bool pl_snapshot(const struct persistentList* list, struct persistentList* snapshot);
+
+/**
+ * This function adds an element to the end of a version. Nodes shared with other versions are
+ * copied, but the data they hold is not.
+ * @param list This is a pointer to the version to add to.
+ * @param object This is a pointer to the object to be added to the list.
+ * @param size This is the size of the object being added in bytes.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool pl_add(struct persistentList* list, const void* object, uint32_t size);
+
+/**
+ * This function adds an element to a version at the desired index. Only the nodes in front
+ * of the index that are shared with other versions are copied.
+ * @param list This is a pointer to the version to add to.
+ * @param object This is a pointer to the object to be added to the list.
+ * @param size This is the size of the object being added in bytes.
+ * @param index This is the index to add the object at.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool pl_addIndex(struct persistentList* list, const void* object, uint32_t size, uint32_t index);
+
+/**
+ * This function removes an object from a version at a given index. Only the nodes in front
+ * of the index that are shared with other versions are copied.
+ * @param list This is a pointer to the version to remove from.
+ * @param index This is the index to remove the object from.
+ * @return This returns true if the remove was successful, false if it failed.
+ */
+bool pl_remove(struct persistentList* list, uint32_t index);
+
+/**
+ * This function gets the object from the desired index of a version.
+ * @param list This is a pointer to the version to get the object from.
+ * @param index This is the index to get the object from.
+ * @return This returns a pointer to the shared data, or NULL if the index is out of range.
+ */
+const void* pl_get(const struct persistentList* list, uint32_t index);
+
+/**
+ * This function releases a version. Nodes and data no longer used by any version are freed.
+ * The list is reinitialized to an empty version.
+ * @param list This is a pointer to the version to be cleared.
+ */
+void pl_clear(struct persistentList* list);
+
+/**
+ * This function returns the number of elements in a version.
+ * @param list This is a pointer to the version to return the size of.
+ * @return This returns the size of the version.
+ */
+uint32_t pl_size(const struct persistentList* list);
+
+/**
+ * This function builds a version holding a copy of every element of a linked list.
+ * @param list This is a pointer to an initialized or cleared version to fill.
+ * @param source This is a pointer to the linked list to copy.
+ * @return This returns true if the version was built, false if it failed.
+ */
+bool pl_fromList(struct persistentList* list, struct linkedList* source);
+
+/**
+ * This function creates an iterator for a version. The iterator starts at the head of the version
+ * and stays valid for as long as the version is not changed or cleared.
+ * @param list This is a pointer to the version used to create the iterator.
+ * @return This returns a pointer to the persistentListIterator structure if the iterator generated
+ *         correctly, else it returns NULL.
+ */
+struct persistentListIterator* pl_getIterator(const struct persistentList* list);
+
+/**
+ * This function determines if an iterator has another element to retrieve.
+ * @param iter This is a pointer to the iterator check.
+ * @return This returns true if there is another element, else it returns false.
+ */
+bool pl_hasNext(struct persistentListIterator* iter);
+
+/**
+ * This function gets the data stored in the current node of the iterator and iterates to
+ * the next node in the version.
+ * @param iter This is a pointer to the iterator to access the data of and iterate.
+ */
+const void* pl_next(struct persistentListIterator* iter);
+
+#endif /*PERSISTENTLIST_H*/
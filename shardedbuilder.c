@@ -0,0 +1,257 @@
+/**
+ * This file contains the implementation of the sharded list builder functions using the
+ * structures defined in the header file.
+ * @file shardedbuilder.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "shardedbuilder.h"
+
+#include <stdlib.h>
+
+/**
+ * This function returns the sequence number of the head of a shard.
+ * @param shard This is a pointer to a shard that is not empty.
+ * @return This returns the sequence number.
+ */
+static uint64_t sb_headSequence(const struct builderShard* shard){
+	return shard->sequences[shard->sequenceStart];
+}
+
+/**
+ * This function moves a shard down a min-heap of shards ordered by head sequence number until
+ * the heap property holds again.
+ * @param builder This is a pointer to the builder the shards belong to.
+ * @param heap This is the heap of shard indexes.
+ * @param count This is the number of shards in the heap.
+ * @param position This is the position of the shard to move down.
+ */
+static void sb_siftDown(struct shardedBuilder* builder, uint32_t* heap, uint32_t count, uint32_t position){
+	bool done = false;
+
+	while(!done){
+		uint32_t smallest = position;
+		uint32_t left = (2 * position) + 1;
+		uint32_t right = left + 1;
+
+		if((left < count) && (sb_headSequence(&builder->shards[heap[left]]) < sb_headSequence(&builder->shards[heap[smallest]]))){
+			smallest = left;
+		}
+		if((right < count) && (sb_headSequence(&builder->shards[heap[right]]) < sb_headSequence(&builder->shards[heap[smallest]]))){
+			smallest = right;
+		}
+
+		if(smallest != position){
+			uint32_t temp = heap[position];
+			heap[position] = heap[smallest];
+			heap[smallest] = temp;
+			position = smallest;
+		}
+		else{
+			done = true;
+		}
+	}
+}
+
+/**
+ * This function empties a shard so it can be used again.
+ * @param shard This is a pointer to the shard to reset.
+ */
+static void sb_resetShard(struct builderShard* shard){
+	ll_clear(&shard->list);
+	shard->sequenceStart = 0;
+}
+
+/**
+ * This function checks if a list is the list of one of the shards of a builder.
+ * @param builder This is a pointer to the builder.
+ * @param list This is a pointer to the list.
+ * @return This returns true if the list belongs to a shard, false otherwise.
+ */
+static bool sb_isShardList(const struct shardedBuilder* builder, const struct linkedList* list){
+	bool found = false;
+
+	for(uint32_t i = 0; (i < builder->shardCount) && !found; i++){
+		found = (&builder->shards[i].list == list);
+	}
+
+	return found;
+}
+
+/**
+ * This function initializes a sharded builder.
+ * @param builder This is a pointer to the builder to initialize.
+ * @param shardCount This is the number of shards, must not be 0.
+ * @return This returns true if the builder was initialized, false if it failed.
+ */
+bool sb_init(struct shardedBuilder* builder, uint32_t shardCount){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((builder != NULL) && (shardCount != 0)){
+		// Allocate the shards on cache line boundaries so they never share a cache line
+		builder->shards = (struct builderShard*)aligned_alloc(64, shardCount * sizeof(struct builderShard));
+		builder->shardCount = shardCount;
+
+		for(uint32_t i = 0; i < shardCount; i++){
+			ll_init(&builder->shards[i].list);
+			builder->shards[i].sequences = NULL;
+			builder->shards[i].sequenceStart = 0;
+			builder->shards[i].sequenceCapacity = 0;
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function frees every element that has not been merged and the shards of the builder.
+ * @param builder This is a pointer to the builder to destroy.
+ */
+void sb_destroy(struct shardedBuilder* builder){
+	// Checks if the builder parameter is NULL to avoid a null pointer dereference
+	if((builder != NULL) && (builder->shards != NULL)){
+		for(uint32_t i = 0; i < builder->shardCount; i++){
+			ll_clear(&builder->shards[i].list);
+			free(builder->shards[i].sequences);
+		}
+
+		free(builder->shards);
+		builder->shards = NULL;
+		builder->shardCount = 0;
+	}
+}
+
+/**
+ * This function adds a copy of an object to the end of a shard.
+ * @param builder This is a pointer to the builder to add to.
+ * @param shard This is the index of the shard owned by the calling thread.
+ * @param object This is a pointer to the object to be added.
+ * @param size This is the size of the object being added in bytes.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool sb_add(struct shardedBuilder* builder, uint32_t shard, const void* object, uint32_t size){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((builder != NULL) && (shard < builder->shardCount)){
+		struct builderShard* target = &builder->shards[shard];
+		uint64_t sequence = 0;
+
+		// Follow on from the last sequence number of the shard
+		if(target->list.size != 0){
+			sequence = target->sequences[target->sequenceStart + target->list.size - 1] + 1;
+		}
+
+		completed = sb_addSequenced(builder, shard, sequence, object, size);
+	}
+
+	return completed;
+}
+
+/**
+ * This function adds a copy of an object to the end of a shard with a given sequence number.
+ * @param builder This is a pointer to the builder to add to.
+ * @param shard This is the index of the shard owned by the calling thread.
+ * @param sequence This is the sequence number that orders the element in a sequence merge.
+ * @param object This is a pointer to the object to be added.
+ * @param size This is the size of the object being added in bytes.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool sb_addSequenced(struct shardedBuilder* builder, uint32_t shard, uint64_t sequence, const void* object, uint32_t size){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((builder != NULL) && (shard < builder->shardCount)){
+		struct builderShard* target = &builder->shards[shard];
+		ll_size_t end = target->sequenceStart + target->list.size;
+
+		// Sequence numbers must not decrease within a shard
+		if((target->list.size == 0) || (target->sequences[end - 1] <= sequence)){
+			// Grow the sequence array by doubling so appends stay amortized constant time
+			if(end == target->sequenceCapacity){
+				ll_size_t capacity = (target->sequenceCapacity == 0) ? 64 : (target->sequenceCapacity * 2);
+				target->sequences = (uint64_t*)realloc(target->sequences, (size_t)capacity * sizeof(uint64_t));
+				target->sequenceCapacity = capacity;
+			}
+
+			if(ll_add(&target->list, object, size)){
+				target->sequences[end] = sequence;
+				completed = true;
+			}
+		}
+	}
+
+	return completed;
+}
+
+/**
+ * This function moves the elements of every shard to the end of a list without copying them.
+ * @param builder This is a pointer to the builder to merge.
+ * @param list This is a pointer to the list that receives the elements.
+ * @param order This selects the order of the elements in the list.
+ * @return This returns the number of elements moved.
+ */
+ll_size_t sb_merge(struct shardedBuilder* builder, struct linkedList* list, enum shardedMergeOrder order){
+	ll_size_t moved = 0;
+
+	// Check the parameters for valid values to avoid null pointer dereferences, and reject lists
+	// ll_transfer cannot append to before any shard is touched
+	if((builder != NULL) && (list != NULL) && (list->sorted == NULL) && !sb_isShardList(builder, list)){
+		if(order == SB_ORDER_SEQUENCE){
+			uint32_t* heap = (uint32_t*)malloc(builder->shardCount * sizeof(uint32_t));
+			uint32_t count = 0;
+
+			// Build a min-heap of the shards that have elements
+			for(uint32_t i = 0; i < builder->shardCount; i++){
+				if(builder->shards[i].list.size != 0){
+					heap[count] = i;
+					count = count + 1;
+				}
+			}
+			for(uint32_t i = count / 2; i > 0; i--){
+				sb_siftDown(builder, heap, count, i - 1);
+			}
+
+			// Repeatedly move the head with the lowest sequence number
+			while(count != 0){
+				struct builderShard* shard = &builder->shards[heap[0]];
+
+				if(ll_transfer(list, &shard->list, 1) == 1){
+					moved = moved + 1;
+					shard->sequenceStart = shard->sequenceStart + 1;
+
+					if(shard->list.size == 0){
+						count = count - 1;
+						heap[0] = heap[count];
+					}
+					sb_siftDown(builder, heap, count, 0);
+				}
+				else{
+					// Leave the rest in the shards rather than retrying a transfer that cannot succeed
+					count = 0;
+				}
+			}
+
+			free(heap);
+		}
+		else{
+			// Stitch the shards together one after another
+			for(uint32_t i = 0; i < builder->shardCount; i++){
+				moved = moved + ll_transfer(list, &builder->shards[i].list, builder->shards[i].list.size);
+			}
+		}
+
+		// Only shards that were emptied are reset, so a failed transfer never drops elements
+		for(uint32_t i = 0; i < builder->shardCount; i++){
+			if(builder->shards[i].list.size == 0){
+				sb_resetShard(&builder->shards[i]);
+			}
+		}
+	}
+
+	return moved;
+}
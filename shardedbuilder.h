@@ -0,0 +1,94 @@
+/**
+ * This file contains the interface for the sharded list builder. Each thread appends to its own
+ * shard without locks or shared writes, and the shards are stitched into a normal linked list
+ * once all threads are done.
+ * @file shardedbuilder.h
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#ifndef SHARDEDBUILDER_H
+#define SHARDEDBUILDER_H
+
+#include "linkedlist.h"
+
+/**
+ * These values select the order of the elements in a merged list.
+ */
+enum shardedMergeOrder
+{
+  SB_ORDER_ARBITRARY, // The shards are appended one after another, which takes O(shards)
+  SB_ORDER_SEQUENCE // The elements are ordered by their sequence numbers, which takes O(n log shards)
+};
+
+/**
+ * This structure is the private part of a sharded builder used by one thread. It is aligned to
+ * a cache line so threads appending to neighbouring shards never share a cache line.
+ */
+struct builderShard
+{
+  struct linkedList list; // The elements added to this shard
+  uint64_t* sequences; // The sequence number of every element of the shard, in list order
+  ll_size_t sequenceStart; // The index of the sequence number of the head of the list
+  ll_size_t sequenceCapacity; // The number of sequence numbers the array can hold
+} __attribute__((aligned(64)));
+
+/**
+ * This structure builds one list from many threads.
+ */
+struct shardedBuilder
+{
+  struct builderShard* shards; // The shards, one per thread
+  uint32_t shardCount; // The number of shards
+};
+
+/**
+ * This function initializes a sharded builder.
+ * @param builder This is a pointer to the builder to initialize.
+ * @param shardCount This is the number of shards, usually the number of threads, must not be 0.
+ * @return This returns true if the builder was initialized, false if it failed.
+ */
+bool sb_init(struct shardedBuilder* builder, uint32_t shardCount);
+
+/**
+ * This function frees every element that has not been merged and the shards of the builder.
+ * @param builder This is a pointer to the builder to destroy.
+ */
+void sb_destroy(struct shardedBuilder* builder);
+
+/**
+ * This function adds a copy of an object to the end of a shard. Each shard may only be used by
+ * one thread at a time. The element gets the sequence number following the last one in the shard.
+ * @param builder This is a pointer to the builder to add to.
+ * @param shard This is the index of the shard owned by the calling thread.
+ * @param object This is a pointer to the object to be added.
+ * @param size This is the size of the object being added in bytes.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool sb_add(struct shardedBuilder* builder, uint32_t shard, const void* object, uint32_t size);
+
+/**
+ * This function adds a copy of an object to the end of a shard with a given sequence number.
+ * Sequence numbers must not decrease within a shard.
+ * @param builder This is a pointer to the builder to add to.
+ * @param shard This is the index of the shard owned by the calling thread.
+ * @param sequence This is the sequence number that orders the element in a sequence merge.
+ * @param object This is a pointer to the object to be added.
+ * @param size This is the size of the object being added in bytes.
+ * @return This returns true if the add was successful, false if it failed.
+ */
+bool sb_addSequenced(struct shardedBuilder* builder, uint32_t shard, uint64_t sequence, const void* object, uint32_t size);
+
+/**
+ * This function moves the elements of every shard to the end of a list without copying them.
+ * No thread may add to the builder during the merge. The shards are empty afterwards and can
+ * be used again. A sorted list or the list of a shard cannot receive the elements, and merging
+ * into one moves nothing and leaves the shards as they are.
+ * @param builder This is a pointer to the builder to merge.
+ * @param list This is a pointer to the list that receives the elements.
+ * @param order This selects the order of the elements in the list.
+ * @return This returns the number of elements moved, 0 if the list cannot receive them.
+ */
+ll_size_t sb_merge(struct shardedBuilder* builder, struct linkedList* list, enum shardedMergeOrder order);
+
+#endif /*SHARDEDBUILDER_H*/
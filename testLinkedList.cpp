@@ -1,711 +1,3033 @@
-/**
- * This file contains the test suite for the linked list library.
- * @file testLinkedList.cpp
- * @author Walter Schilling
- * @date September 1, 2017
- *
- */
-#include "testLinkedList.h"
-#include <malloc.h>
-#include <TestAssert.h>
-#include <cstring>
-
-CPPUNIT_TEST_SUITE_REGISTRATION(LinkedListTestCase);
-
-#include <CompilerOutputter.h>
-#include <extensions/TestFactoryRegistry.h>
-#include <TestResult.h>
-#include <TestResultCollector.h>
-#include <TestRunner.h>
-#include <BriefTestProgressListener.h>
-#include <iostream>
-
-/**
- * This is the main method for the test program.  It will invoke the cppunit test harness.
- * @param argc This is the count of arguments.  Not used in this program.
- * @param argv This is the arguments passed in.  Not used for the execution of this program.
- * @return The return will be 0 if successful or non zero if an error occurs.
- */
-int main (int argc, char* argv[])
-{
-	// informs test-listener about testresults
-	CPPUNIT_NS :: TestResult testresult;
-
-	// register listener for collecting the test-results
-	CPPUNIT_NS :: TestResultCollector collectedresults;
-	testresult.addListener (&collectedresults);
-
-	// register listener for per-test progress output
-	CPPUNIT_NS :: BriefTestProgressListener progress;
-	testresult.addListener (&progress);
-
-	// insert test-suite at test-runner by registry
-	CPPUNIT_NS :: TestRunner testrunner;
-	testrunner.addTest (CPPUNIT_NS :: TestFactoryRegistry :: getRegistry ().makeTest ());
-	testrunner.run (testresult);
-
-	// output results in compiler-format
-	CPPUNIT_NS :: CompilerOutputter compileroutputter (&collectedresults, std::cerr);
-	compileroutputter.write ();
-
-	// return 0 if tests were successful
-	return collectedresults.wasSuccessful () ? 0 : 1;
-}
-
-/**
- * This method will setup a basic linked list that can be used for further testing.
- * In essence, it will add a set of items to the linked list and verify that the data
- * has been setup properly before allowing the other tests to run.
- */
-void LinkedListTestCase::setupBasicList() {
-	ll_add(&myList, "CS3841", 7);
-	ll_add(&myList, "Operating", 11);
-	ll_add(&myList, "Systems", 8);
-	ll_add(&myList, "Fall", 5);
-	ll_add(&myList, "Quarter", 8);
-
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->data, "CS3841")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->data, "Operating")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->nextNode->data, "Systems")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->nextNode->nextNode->data, "Fall")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->nextNode->nextNode->nextNode->data, "Quarter")==0);
-}
-
-/**
- * This method will be called to setup the tests.  It will perform an initialization
- * on the given linked list.
- */
-void LinkedListTestCase::setUp() {
-	printf("Setup being called.");
-	// Initialize the linked list to be an empty list.
-	ll_init(&myList);
-}
-
-/**
- * This method will clear the given linked list, freeing any and all allocated memory
- * and allowing the system to operate.
- */
-void LinkedListTestCase::tearDown() {
-	printf("Teardown being called.");
-	// Clear the linked list, making certain everything is empty.
-	ll_clear(&myList);
-}
-
-/**
- * This method will verify that the init method is functioning properly.
- */
-void LinkedListTestCase::testInit() {
-	ll_init(&myList);
-	CPPUNIT_ASSERT_MESSAGE("Size not zero.", ll_size(&myList)==0);
-	CPPUNIT_ASSERT_MESSAGE("Head not null.", myList.head==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Tail not null.", myList.tail==NULL);
-}
-
-/**
- * This method will ensure that trying to add to a NULL list is handled properly.
- */
-void LinkedListTestCase::testAddNullList() {
-	// Check that null is handled properly.
-	CPPUNIT_ASSERT_MESSAGE("Improper handling of null list",
-			ll_add(NULL, "Hello", 6)==false);
-}
-
-/**
- * This method will verify that trying to add NULL items to the list results in an
- * appropriate failure.
- */
-void LinkedListTestCase::testAddNullObject() {
-	// Check that null is handled properly.
-	CPPUNIT_ASSERT_MESSAGE("Improper handling of NULL object.",
-			ll_add(&myList, NULL, 0)==false);
-}
-
-/**
- * This method ensures that trying to add an item of length zero fails appropriately.
- */
-void LinkedListTestCase::testAddZeroSize() {
-	CPPUNIT_ASSERT_MESSAGE("Improper handling of 0 size.",
-			ll_add(&myList, "Hello", 0)==false);
-}
-
-/**
- * This method will test adding a single item onto the list.  It will verify that
- * the item is added appropriately from a location standpoint and that the size
- * is correct.
- */
-void LinkedListTestCase::testSingleElementAdd() {
-	// Add a single valid element.
-	CPPUNIT_ASSERT_MESSAGE("Inappropriate return value from simple add.",
-			ll_add(&myList, "Hello", 6)==true);
-	CPPUNIT_ASSERT_MESSAGE("Head and tail of list match.",
-			myList.head==myList.tail);
-	CPPUNIT_ASSERT_MESSAGE("Size is incorrect.", myList.size==1);
-}
-
-struct testStructure
-{
-	char name[10];
-	int number;
-	char name2[10];
-	int number2;
-	char name3[10];
-};
-
-
-/**
- * This method will test adding a single item onto the list.  It will verify that
- * the item is added appropriately from a location standpoint and that the size
- * is correct.
- */
-void LinkedListTestCase::testSingleElementAddOfStructure() {
-	struct testStructure testInstance;
-	strcpy(&testInstance.name[0],  "ABCDEFGHI");
-	strcpy(&testInstance.name2[0], "JKLMNOPQR");
-	strcpy(&testInstance.name3[0], "012345678");
-	testInstance.number=0;
-	testInstance.number2=0;
-
-
-	// Add a single valid element.
-	CPPUNIT_ASSERT_MESSAGE("Inappropriate return value from simple add.",
-			ll_add(&myList, &testInstance, sizeof(struct testStructure))==true);
-	CPPUNIT_ASSERT_MESSAGE("Head and tail of list match.",
-			myList.head==myList.tail);
-	CPPUNIT_ASSERT_MESSAGE("Size is incorrect.", myList.size==1);
-	CPPUNIT_ASSERT_MESSAGE("Structures do not properly match.", memcmp(&testInstance, (struct testStructure*)ll_get(&myList, 0), sizeof(struct testStructure))==0);
-}
-
-
-
-/**
- * This test will ensure that the add method creates a separate memory block appropriately
- * and does not simply add a pointer to the passed in data, potentially causing memory
- * issues in the future.
- */
-void LinkedListTestCase::testAddCreatesSeparateMemoryBlock() {
-	char const *messages[] = { "Hello", "World" };
-	char *dataToAdd = new char[6];
-
-	strcpy(dataToAdd, (char*) &messages[0][0]);
-
-	// Add the first message.
-	ll_add(&myList, dataToAdd, 6);
-
-	// Add a single valid element.
-	CPPUNIT_ASSERT_MESSAGE("Memory not properly allocated for block",
-			myList.head->data!=dataToAdd);
-	CPPUNIT_ASSERT_MESSAGE("Memory not properly allocated for block",
-			myList.head->data!=&dataToAdd);
-	CPPUNIT_ASSERT_MESSAGE("Memory not properly allocated for block",
-			myList.head->data!=&messages[0][0]);
-
-	delete [] dataToAdd;
-	dataToAdd = new char[6];
-
-	// Add the second message.
-	strcpy(dataToAdd, (char*) &messages[1][0]);
-
-	ll_add(&myList, dataToAdd, 6);
-	delete [] dataToAdd;
-
-	CPPUNIT_ASSERT_MESSAGE("Memory not properly allocated for block",
-			myList.tail->data!=dataToAdd);
-	CPPUNIT_ASSERT_MESSAGE("Memory not properly allocated for block",
-			myList.tail->data!=&dataToAdd);
-	CPPUNIT_ASSERT_MESSAGE("Memory not properly allocated for block",
-			myList.tail->data!=&messages[0][0]);
-}
-
-/**
- * This method will test adding two items onto the list.  It will verify that
- * the item is added appropriately from a location standpoint and that the size
- * is correct.
- */
-void LinkedListTestCase::testTwoElementAdd() {
-	// Add a single valid element.
-	CPPUNIT_ASSERT_MESSAGE("Inappropriate return value from simple add.",
-			ll_add(&myList, "Hello", 6)==true);
-
-	// Add a second valid element.
-	CPPUNIT_ASSERT_MESSAGE("Inappropriate return value from simple add.",
-			ll_add(&myList, "World", 6)==true);
-	CPPUNIT_ASSERT_MESSAGE("Head and tail of list match.",
-			myList.head!=myList.tail);
-	CPPUNIT_ASSERT_MESSAGE("Size is incorrect.", myList.size==2);
-	CPPUNIT_ASSERT_MESSAGE(
-			"List data does not match properly for head element.",
-			strcmp((const char *)myList.head->data,"Hello")==0);
-	CPPUNIT_ASSERT_MESSAGE(
-			"List data does not match properly for tail element.",
-			strcmp((const char *)myList.tail->data, "World")==0);
-	CPPUNIT_ASSERT_MESSAGE("List does not walk properly in forward direction.",
-			strcmp((const char *)myList.head->nextNode->data, "World")==0);
-	CPPUNIT_ASSERT_MESSAGE(
-			"List does not walk properly in a backward direction.",
-			strcmp((const char *)myList.tail->prevNode->data, "Hello")==0);
-}
-
-/**
- * This method will test adding three items onto the list.  It will verify that
- * the item is added appropriately from a location standpoint and that the size
- * is correct.
- */
-
-void LinkedListTestCase::testThreeElementAdd() {
-	// Add a single valid element.
-	CPPUNIT_ASSERT_MESSAGE("Inappropriate return value from simple add.",
-			ll_add(&myList, "Hello", 6)==true);
-
-	// Add a second valid element.
-	CPPUNIT_ASSERT_MESSAGE("Inappropriate return value from simple add.",
-			ll_add(&myList, "World", 6)==true);
-
-	// Add a third valid element
-	CPPUNIT_ASSERT_MESSAGE("Inappropriate return value from simple add.",
-			ll_add(&myList, "This is London.", 16)==true);
-	CPPUNIT_ASSERT_MESSAGE("Head and tail of list match.",
-			myList.head!=myList.tail);
-	CPPUNIT_ASSERT_MESSAGE("Size is incorrect.", myList.size==3);
-	CPPUNIT_ASSERT_MESSAGE(
-			"List data does not match properly for head element.",
-			strcmp((const char *)myList.head->data,"Hello")==0);
-	CPPUNIT_ASSERT_MESSAGE(
-			"List data does not match properly for tail element.",
-			strcmp((const char *)myList.tail->data, "This is London.")==0);
-	CPPUNIT_ASSERT_MESSAGE("List does not walk properly in forward direction.",
-			strcmp((const char *)myList.head->nextNode->data, "World")==0);
-	CPPUNIT_ASSERT_MESSAGE("List does not walk properly in forward direction.",
-			strcmp((const char *)myList.head->nextNode->nextNode->data, "This is London.")==0);
-	CPPUNIT_ASSERT_MESSAGE(
-			"List does not walk properly in a backward direction.",
-			strcmp((const char *)myList.tail->prevNode->data, "World")==0);
-	CPPUNIT_ASSERT_MESSAGE(
-			"List does not walk properly in a backward direction.",
-			strcmp((const char *)myList.tail->prevNode->prevNode->data, "Hello")==0);
-}
-
-/**
- * This method will that trying to remove from a null list fails.
- */
-
-void LinkedListTestCase::testRemoveNullListFails() {
-	setupBasicList();
-
-	CPPUNIT_ASSERT_MESSAGE("Checking that a NULL list is ignored.",
-			ll_remove(NULL, 5)==false);
-}
-
-/**
- * This method will test adding a single item onto the list.  It will verify that
- * the item is added appropriately from a location standpoint and that the size
- * is correct.
- */
-
-void LinkedListTestCase::testRemoveOutOfRangeElementFails() {
-	setupBasicList();
-	CPPUNIT_ASSERT_MESSAGE("Checking that an out of range element is ignored.",
-			ll_remove(&myList, 5)==false);
-}
-
-/**
- * This method will verify that we can properly remove the tail of the given list.
- */
-void LinkedListTestCase::testRemoveTail() {
-	setupBasicList();
-
-	// Try removing the tail as a first attempt.
-	CPPUNIT_ASSERT_MESSAGE("Tail removal failed.", ll_remove(&myList, 4)==true);
-	CPPUNIT_ASSERT_MESSAGE("Tail message incorrect after removal.",
-			strcmp("Fall", (const char*)myList.tail->data)==0);
-	CPPUNIT_ASSERT_MESSAGE("Tail has a next element.",
-			myList.tail->nextNode==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==4);
-
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->data, "CS3841")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->data, "Operating")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->nextNode->data, "Systems")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->nextNode->nextNode->data, "Fall")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			myList.head->nextNode->nextNode->nextNode->nextNode==NULL);
-}
-
-/**
- * This test verifies that the remove head function operates properly.
- */
-void LinkedListTestCase::testRemoveHead() {
-	setupBasicList();
-
-	// Now try removing the head.
-	CPPUNIT_ASSERT_MESSAGE("Head removal failed.", ll_remove(&myList, 0)==true);
-	CPPUNIT_ASSERT_MESSAGE("Head message incorrect after removal.",
-			strcmp("Operating", (const char*)myList.head->data)==0);
-	CPPUNIT_ASSERT_MESSAGE("Head has previous element.",
-			myList.head->prevNode==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==4);
-
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->data, "Operating")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->data, "Systems")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->nextNode->data, "Fall")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->nextNode->nextNode->data, "Quarter")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			myList.head->nextNode->nextNode->nextNode->nextNode==NULL);
-}
-
-/**
- * This method will verify that removing from the middle of the list functions properly.
- */
-void LinkedListTestCase::testRemoveMiddle() {
-	setupBasicList();
-
-	// Now try removing the head.
-	CPPUNIT_ASSERT_MESSAGE("Middle removal failed.",
-			ll_remove(&myList, 2)==true);
-	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==4);
-
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->data, "CS3841")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->data, "Operating")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->nextNode->data, "Fall")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->nextNode->nextNode->data, "Quarter")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			myList.head->nextNode->nextNode->nextNode->nextNode==NULL);
-}
-
-/**
- * This method will test the remove operation extensivly.
- */
-void LinkedListTestCase::testRemove() {
-	setupBasicList();
-
-	// Try removing the tail as a first attempt.
-	CPPUNIT_ASSERT_MESSAGE("Tail removal failed.", ll_remove(&myList, 4)==true);
-	CPPUNIT_ASSERT_MESSAGE("Tail message incorrect after removal.",
-			strcmp("Fall", (const char*)myList.tail->data)==0);
-	CPPUNIT_ASSERT_MESSAGE("Tail has a next element.",
-			myList.tail->nextNode==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==4);
-
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->data, "CS3841")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->data, "Operating")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->nextNode->data, "Systems")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->nextNode->nextNode->data, "Fall")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			myList.head->nextNode->nextNode->nextNode->nextNode==NULL);
-
-	// Now remove the head.
-	CPPUNIT_ASSERT_MESSAGE("Head removal failed.", ll_remove(&myList, 0)==true);
-	CPPUNIT_ASSERT_MESSAGE("Tail message incorrect after removal.",
-			strcmp("Fall", (const char*)myList.tail->data)==0);
-	CPPUNIT_ASSERT_MESSAGE("Tail has a next element.",
-			myList.tail->nextNode==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Head has a previous element.",
-			myList.head->prevNode==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==3);
-
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->data, "Operating")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->data, "Systems")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->nextNode->data, "Fall")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			myList.head->nextNode->nextNode->nextNode==NULL);
-
-	// Now try removing from the middle
-	CPPUNIT_ASSERT_MESSAGE("Middle removal failed.",
-			ll_remove(&myList, 1)==true);
-	CPPUNIT_ASSERT_MESSAGE("Tail message incorrect after removal.",
-			strcmp("Fall", (const char*)myList.tail->data)==0);
-	CPPUNIT_ASSERT_MESSAGE("Tail has a next element.",
-			myList.tail->nextNode==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Head has a previous element.",
-			myList.head->prevNode==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==2);
-
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->data, "Operating")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->nextNode->data, "Fall")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			myList.head->nextNode->nextNode==NULL);
-
-	// Remove from the end of the list again.
-	CPPUNIT_ASSERT_MESSAGE("Tail removal failed.", ll_remove(&myList, 1)==true);
-	CPPUNIT_ASSERT_MESSAGE("Tail message incorrect after removal.",
-			strcmp("Operating", (const char*)myList.tail->data)==0);
-	CPPUNIT_ASSERT_MESSAGE("Tail has a next element.",
-			myList.tail->nextNode==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Head has a previous element.",
-			myList.head->prevNode==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==1);
-
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			strcmp((char*)myList.head->data, "Operating")==0);
-	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
-			myList.head->nextNode==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Head and tail should match at this point.",
-			myList.head==myList.tail);
-
-	// Now try removing the head.
-	CPPUNIT_ASSERT_MESSAGE("Head removal failed.", ll_remove(&myList, 0)==true);
-	CPPUNIT_ASSERT_MESSAGE("Head and tail should be NULL.", myList.head==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Head and tail should be NULL.", myList.tail==NULL);
-
-	// We we should have an empty list.  Check all of the status.
-	CPPUNIT_ASSERT_MESSAGE("Head not set properly.", myList.head==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Tail not set properly.", myList.tail==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Size not set properly.", myList.size==0);
-}
-
-/**
- * This method ensures that the addIndex method is functioning properly.
- */
-void LinkedListTestCase::testAddIndex() {
-	// Start by setting up a basic list.
-	ll_add(&myList, "Hello", 6);
-	ll_add(&myList, "This is London.", 16);
-
-	// Check to make sure the list is in the right shape.  This should never fail unless one of the test above is also failing.
-	CPPUNIT_ASSERT_MESSAGE("Size is incorrect.", myList.size==2);
-
-	// Check to make ceratin all of the invalid parameters fail properly.
-	CPPUNIT_ASSERT_MESSAGE("Invalid list parameter",
-			ll_addIndex(NULL, "World", 6, 1)==false);
-	CPPUNIT_ASSERT_MESSAGE("Invalid object to add.",
-			ll_addIndex(&myList, NULL, 6, 1)==false);
-	CPPUNIT_ASSERT_MESSAGE("Invalid size of object to add.",
-			ll_addIndex(&myList, "World", 0, 1)==false);
-	CPPUNIT_ASSERT_MESSAGE("Invalid index for add.",
-			ll_addIndex(&myList, "World", 6, 3)==false);
-
-	// Check to make certain adding to the tail effectivly works.
-	CPPUNIT_ASSERT_MESSAGE("Improper tail element with addIndex function.",
-			ll_addIndex(&myList, "Here is the news.", 18, 2)==true);
-	CPPUNIT_ASSERT_MESSAGE("Size improper after add.", myList.size==3);
-	CPPUNIT_ASSERT_MESSAGE("Tail set up properly.",
-			strcmp("Here is the news.", (const char*)myList.tail->data)==0);
-	CPPUNIT_ASSERT_MESSAGE("Tail not given null as next element.",
-			myList.tail->nextNode==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Previous not set up properly from tail add.",
-			strcmp("This is London.", (const char*)myList.tail->prevNode->data)==0);
-
-	// Now try adding to the head of the list.
-	CPPUNIT_ASSERT_MESSAGE("Improper behavior of addindex function.",
-			ll_addIndex(&myList, "CS3841", 7, 0)==true);
-	CPPUNIT_ASSERT_MESSAGE("Size improper after add.", myList.size==4);
-	CPPUNIT_ASSERT_MESSAGE("Head set up properly.",
-			strcmp("CS3841", (const char*)myList.head->data)==0);
-	CPPUNIT_ASSERT_MESSAGE("Head not given null as previous element.",
-			myList.head->prevNode==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Next not set up properly from tail add.",
-			strcmp("Hello", (const char*)myList.head->nextNode->data)==0);
-
-	// Now try adding in the middle of the list.
-	CPPUNIT_ASSERT_MESSAGE("Improper tail element with addIndex function.",
-			ll_addIndex(&myList, "World", 6, 2)==true);
-	CPPUNIT_ASSERT_MESSAGE("Size improper after add.", myList.size==5);
-
-	// Now walk ther list and check everything.
-	// List list should be the following.
-
-	CPPUNIT_ASSERT_MESSAGE("Head set up properly.",
-			strcmp("CS3841", (const char*)(myList.head->data))==0);
-	CPPUNIT_ASSERT_MESSAGE("Head not given null as previous element.",
-			myList.head->prevNode==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Next not set up properly from tail add.",
-			strcmp("Hello", (const char*)myList.head->nextNode->data)==0);
-
-	struct listNode* n = myList.head;
-	CPPUNIT_ASSERT_MESSAGE("Head is incorrect.",
-			strcmp("CS3841", (const char*)n->data)==0);
-	CPPUNIT_ASSERT_MESSAGE("Improper next link.", n->nextNode!=NULL);
-	CPPUNIT_ASSERT_MESSAGE("Improper previous link.", n->prevNode==NULL);
-
-	// Walk to the next node.
-	n = n->nextNode;
-	CPPUNIT_ASSERT_MESSAGE("Node data is incorrect.",
-			strcmp("Hello", (const char*)n->data)==0);
-	CPPUNIT_ASSERT_MESSAGE("Improper next link.", n->nextNode!=NULL);
-	CPPUNIT_ASSERT_MESSAGE("Improper previous link.", n->prevNode!=NULL);
-
-	// Walk to the next node.
-	n = n->nextNode;
-	CPPUNIT_ASSERT_MESSAGE("Node data is incorrect.",
-			strcmp("World", (const char*)n->data)==0);
-	CPPUNIT_ASSERT_MESSAGE("Improper next link.", n->nextNode!=NULL);
-	CPPUNIT_ASSERT_MESSAGE("Improper previous link.", n->prevNode!=NULL);
-
-	// Walk to the next node.
-	n = n->nextNode;
-	CPPUNIT_ASSERT_MESSAGE("Node data is incorrect.",
-			strcmp("This is London.", (const char*)n->data)==0);
-	CPPUNIT_ASSERT_MESSAGE("Improper next link.", n->nextNode!=NULL);
-	CPPUNIT_ASSERT_MESSAGE("Improper previous link.", n->prevNode!=NULL);
-
-	// Walk to the next node.
-	n = n->nextNode;
-	CPPUNIT_ASSERT_MESSAGE("Node data is incorrect.",
-			strcmp("Here is the news.", (const char*)n->data)==0);
-	CPPUNIT_ASSERT_MESSAGE("Improper next link.", n->nextNode==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Improper previous link.", n->prevNode!=NULL);
-}
-
-/**
- * This method ensures that the get operation is working properly.
- */
-void LinkedListTestCase::testGet() {
-
-	const char* messages[] = { "CS3841", "Operating", "Systems", "Fall",
-			"Quarter" };
-	int index;
-
-	setupBasicList();
-	char *data;
-
-	// Verify basic parameter checks operate properly.
-	CPPUNIT_ASSERT_MESSAGE("NULL parameter improperly allowed.",
-			ll_get(NULL, 1)==NULL);
-	CPPUNIT_ASSERT_MESSAGE("OUT of range parameter not ignored.",
-			ll_get(&myList, 1000)==false);
-
-	for (index = 0; index < 5; index++) {
-		data = (char*) ll_get(&myList, index);
-		CPPUNIT_ASSERT_MESSAGE("Improper message on get",
-				strcmp(messages[index], data)==0);
-	}
-}
-
-/**
- * This method will ensure that the clear operation clears properly.
- */
-void LinkedListTestCase::testClear() {
-	setupBasicList();
-	CPPUNIT_ASSERT_MESSAGE("Starting size incorrect.", ll_size(&myList)==5);
-	ll_clear(&myList);
-
-	CPPUNIT_ASSERT_MESSAGE("Head not set properly.", myList.head==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Tail not set properly.", myList.tail==NULL);
-	CPPUNIT_ASSERT_MESSAGE("Size not set properly.", myList.size==0);
-}
-
-/**
- * This method will verify that the size operator is working properly.
- */
-void LinkedListTestCase::testSize() {
-	CPPUNIT_ASSERT_MESSAGE("Empty list does not have 0 size.",
-			ll_size(&myList)==0);
-	CPPUNIT_ASSERT_MESSAGE("Size does not match structure.",
-			ll_size(&myList)==myList.size);
-
-	// Add something and make certain the size goes up.
-	ll_add(&myList, "Hello", 6);
-
-	CPPUNIT_ASSERT_MESSAGE("1 element list does not have 1 size.",
-			ll_size(&myList)==1);
-	CPPUNIT_ASSERT_MESSAGE("Size does not match structure.",
-			ll_size(&myList)==myList.size);
-}
-
-/**
- * This method ensures that the iterator being null does not impact the system.
- */
-void LinkedListTestCase::testIteratorNull() {
-	setupBasicList();
-
-	// Start by testing the obtaining of the iterator.
-	struct linkedListIterator *iter;
-
-	iter = ll_getIterator(NULL);
-	CPPUNIT_ASSERT_MESSAGE("Iterator should be NULL.", iter==NULL);
-}
-
-/**
- * This method ensures that doing a free on the iterator does not damage the list.
- */
-void LinkedListTestCase::testIteratorFreeDoesNotDamageList() {
-	const char* messages[] = { "CS3841", "Operating", "Systems", "Fall",
-			"Quarter" };
-
-	setupBasicList();
-	char* data;
-
-	// Start by testing the obtaining of the iterator.
-	struct linkedListIterator *iter;
-
-	// Now test obtaining a valid iterator.
-	iter = ll_getIterator(&myList);
-
-	data = (char*) ll_next(iter);
-
-	free(iter);
-
-	CPPUNIT_ASSERT_MESSAGE("Data damaged when free operation occurred.",
-			strcmp(messages[0], data)==0);
-}
-
-/**
- * This method ensures that the iterator walks through the code properly.
- */
-void LinkedListTestCase::testIterator() {
-	const char* messages[] = { "CS3841", "Operating", "Systems", "Fall",
-			"Quarter" };
-	int index;
-
-	setupBasicList();
-	char* data;
-
-	// Start by testing the obtaining of the iterator.
-	struct linkedListIterator *iter;
-
-	// Now test obtaining a valid iterator.
-	iter = ll_getIterator(&myList);
-	CPPUNIT_ASSERT_MESSAGE("Iterator should not be NULL.", iter!=NULL);
-	CPPUNIT_ASSERT_MESSAGE("Iterator's current should be the head of the list.",
-			iter->current==myList.head);
-
-	for (index = 0; index < 5; index++) {
-		CPPUNIT_ASSERT_MESSAGE(
-				"An invalid iterator should result in a false value.",
-				ll_hasNext(NULL)==false);
-		CPPUNIT_ASSERT_MESSAGE("Iterator should have a next right now.",
-				ll_hasNext(iter)==true);
-
-		CPPUNIT_ASSERT_MESSAGE(
-				"Invalid parameter to next should result in NULL being returned,",
-				ll_next(NULL)==NULL);
-		data = (char*) ll_next(iter);
-		CPPUNIT_ASSERT_MESSAGE("Expected true for correct next operation.",
-				data!=NULL);
-		CPPUNIT_ASSERT_MESSAGE("Data returned does not match expected data.",
-				strcmp(messages[index], data)==0);
-	}
-
-	// Now we have stepped through everything.  There should be nothing left for the next.
-	CPPUNIT_ASSERT_MESSAGE("Extra next operation.", ll_hasNext(iter)==false);
-	CPPUNIT_ASSERT_MESSAGE(
-			"Invalid return value when attempting to retrieve beyond the end of the list.",
-			ll_next(iter)==NULL);
-
-	free(iter);
-
-}
+/**
+ * This file contains the test suite for the linked list library.
+ * @file testLinkedList.cpp
+ * @author Walter Schilling
+ * @date September 1, 2017
+ *
+ */
+#include "testLinkedList.h"
+#include <malloc.h>
+#include <TestAssert.h>
+#include <cstring>
+#include <pthread.h>
+#include <unistd.h>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(LinkedListTestCase);
+
+#include <CompilerOutputter.h>
+#include <extensions/TestFactoryRegistry.h>
+#include <TestResult.h>
+#include <TestResultCollector.h>
+#include <TestRunner.h>
+#include <BriefTestProgressListener.h>
+#include <iostream>
+
+/**
+ * This is the main method for the test program.  It will invoke the cppunit test harness.
+ * @param argc This is the count of arguments.  Not used in this program.
+ * @param argv This is the arguments passed in.  Not used for the execution of this program.
+ * @return The return will be 0 if successful or non zero if an error occurs.
+ */
+int main (int argc, char* argv[])
+{
+	// informs test-listener about testresults
+	CPPUNIT_NS :: TestResult testresult;
+
+	// register listener for collecting the test-results
+	CPPUNIT_NS :: TestResultCollector collectedresults;
+	testresult.addListener (&collectedresults);
+
+	// register listener for per-test progress output
+	CPPUNIT_NS :: BriefTestProgressListener progress;
+	testresult.addListener (&progress);
+
+	// insert test-suite at test-runner by registry
+	CPPUNIT_NS :: TestRunner testrunner;
+	testrunner.addTest (CPPUNIT_NS :: TestFactoryRegistry :: getRegistry ().makeTest ());
+	testrunner.run (testresult);
+
+	// output results in compiler-format
+	CPPUNIT_NS :: CompilerOutputter compileroutputter (&collectedresults, std::cerr);
+	compileroutputter.write ();
+
+	// return 0 if tests were successful
+	return collectedresults.wasSuccessful () ? 0 : 1;
+}
+
+/**
+ * This method will setup a basic linked list that can be used for further testing.
+ * In essence, it will add a set of items to the linked list and verify that the data
+ * has been setup properly before allowing the other tests to run.
+ */
+void LinkedListTestCase::setupBasicList() {
+	ll_add(&myList, "CS3841", 7);
+	ll_add(&myList, "Operating", 11);
+	ll_add(&myList, "Systems", 8);
+	ll_add(&myList, "Fall", 5);
+	ll_add(&myList, "Quarter", 8);
+
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->data, "CS3841")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->data, "Operating")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->nextNode->data, "Systems")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->nextNode->nextNode->data, "Fall")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->nextNode->nextNode->nextNode->data, "Quarter")==0);
+}
+
+/**
+ * This method will be called to setup the tests.  It will perform an initialization
+ * on the given linked list.
+ */
+void LinkedListTestCase::setUp() {
+	printf("Setup being called.");
+	// Initialize the linked list to be an empty list.
+	ll_init(&myList);
+}
+
+/**
+ * This method will clear the given linked list, freeing any and all allocated memory
+ * and allowing the system to operate.
+ */
+void LinkedListTestCase::tearDown() {
+	printf("Teardown being called.");
+	// Clear the linked list, making certain everything is empty.
+	ll_clear(&myList);
+}
+
+/**
+ * This method will verify that the init method is functioning properly.
+ */
+void LinkedListTestCase::testInit() {
+	ll_init(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Size not zero.", ll_size(&myList)==0);
+	CPPUNIT_ASSERT_MESSAGE("Head not null.", myList.head==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Tail not null.", myList.tail==NULL);
+}
+
+/**
+ * This method will ensure that trying to add to a NULL list is handled properly.
+ */
+void LinkedListTestCase::testAddNullList() {
+	// Check that null is handled properly.
+	CPPUNIT_ASSERT_MESSAGE("Improper handling of null list",
+			ll_add(NULL, "Hello", 6)==false);
+}
+
+/**
+ * This method will verify that trying to add NULL items to the list results in an
+ * appropriate failure.
+ */
+void LinkedListTestCase::testAddNullObject() {
+	// Check that null is handled properly.
+	CPPUNIT_ASSERT_MESSAGE("Improper handling of NULL object.",
+			ll_add(&myList, NULL, 0)==false);
+}
+
+/**
+ * This method ensures that trying to add an item of length zero fails appropriately.
+ */
+void LinkedListTestCase::testAddZeroSize() {
+	CPPUNIT_ASSERT_MESSAGE("Improper handling of 0 size.",
+			ll_add(&myList, "Hello", 0)==false);
+}
+
+/**
+ * This method will test adding a single item onto the list.  It will verify that
+ * the item is added appropriately from a location standpoint and that the size
+ * is correct.
+ */
+void LinkedListTestCase::testSingleElementAdd() {
+	// Add a single valid element.
+	CPPUNIT_ASSERT_MESSAGE("Inappropriate return value from simple add.",
+			ll_add(&myList, "Hello", 6)==true);
+	CPPUNIT_ASSERT_MESSAGE("Head and tail of list match.",
+			myList.head==myList.tail);
+	CPPUNIT_ASSERT_MESSAGE("Size is incorrect.", myList.size==1);
+}
+
+struct testStructure
+{
+	char name[10];
+	int number;
+	char name2[10];
+	int number2;
+	char name3[10];
+};
+
+
+/**
+ * This method will test adding a single item onto the list.  It will verify that
+ * the item is added appropriately from a location standpoint and that the size
+ * is correct.
+ */
+void LinkedListTestCase::testSingleElementAddOfStructure() {
+	struct testStructure testInstance;
+	strcpy(&testInstance.name[0],  "ABCDEFGHI");
+	strcpy(&testInstance.name2[0], "JKLMNOPQR");
+	strcpy(&testInstance.name3[0], "012345678");
+	testInstance.number=0;
+	testInstance.number2=0;
+
+
+	// Add a single valid element.
+	CPPUNIT_ASSERT_MESSAGE("Inappropriate return value from simple add.",
+			ll_add(&myList, &testInstance, sizeof(struct testStructure))==true);
+	CPPUNIT_ASSERT_MESSAGE("Head and tail of list match.",
+			myList.head==myList.tail);
+	CPPUNIT_ASSERT_MESSAGE("Size is incorrect.", myList.size==1);
+	CPPUNIT_ASSERT_MESSAGE("Structures do not properly match.", memcmp(&testInstance, (struct testStructure*)ll_get(&myList, 0), sizeof(struct testStructure))==0);
+}
+
+
+
+/**
+ * This test will ensure that the add method creates a separate memory block appropriately
+ * and does not simply add a pointer to the passed in data, potentially causing memory
+ * issues in the future.
+ */
+void LinkedListTestCase::testAddCreatesSeparateMemoryBlock() {
+	char const *messages[] = { "Hello", "World" };
+	char *dataToAdd = new char[6];
+
+	strcpy(dataToAdd, (char*) &messages[0][0]);
+
+	// Add the first message.
+	ll_add(&myList, dataToAdd, 6);
+
+	// Add a single valid element.
+	CPPUNIT_ASSERT_MESSAGE("Memory not properly allocated for block",
+			myList.head->data!=dataToAdd);
+	CPPUNIT_ASSERT_MESSAGE("Memory not properly allocated for block",
+			myList.head->data!=&dataToAdd);
+	CPPUNIT_ASSERT_MESSAGE("Memory not properly allocated for block",
+			myList.head->data!=&messages[0][0]);
+
+	delete [] dataToAdd;
+	dataToAdd = new char[6];
+
+	// Add the second message.
+	strcpy(dataToAdd, (char*) &messages[1][0]);
+
+	ll_add(&myList, dataToAdd, 6);
+	delete [] dataToAdd;
+
+	CPPUNIT_ASSERT_MESSAGE("Memory not properly allocated for block",
+			myList.tail->data!=dataToAdd);
+	CPPUNIT_ASSERT_MESSAGE("Memory not properly allocated for block",
+			myList.tail->data!=&dataToAdd);
+	CPPUNIT_ASSERT_MESSAGE("Memory not properly allocated for block",
+			myList.tail->data!=&messages[0][0]);
+}
+
+/**
+ * This method will test adding two items onto the list.  It will verify that
+ * the item is added appropriately from a location standpoint and that the size
+ * is correct.
+ */
+void LinkedListTestCase::testTwoElementAdd() {
+	// Add a single valid element.
+	CPPUNIT_ASSERT_MESSAGE("Inappropriate return value from simple add.",
+			ll_add(&myList, "Hello", 6)==true);
+
+	// Add a second valid element.
+	CPPUNIT_ASSERT_MESSAGE("Inappropriate return value from simple add.",
+			ll_add(&myList, "World", 6)==true);
+	CPPUNIT_ASSERT_MESSAGE("Head and tail of list match.",
+			myList.head!=myList.tail);
+	CPPUNIT_ASSERT_MESSAGE("Size is incorrect.", myList.size==2);
+	CPPUNIT_ASSERT_MESSAGE(
+			"List data does not match properly for head element.",
+			strcmp((const char *)myList.head->data,"Hello")==0);
+	CPPUNIT_ASSERT_MESSAGE(
+			"List data does not match properly for tail element.",
+			strcmp((const char *)myList.tail->data, "World")==0);
+	CPPUNIT_ASSERT_MESSAGE("List does not walk properly in forward direction.",
+			strcmp((const char *)myList.head->nextNode->data, "World")==0);
+	CPPUNIT_ASSERT_MESSAGE(
+			"List does not walk properly in a backward direction.",
+			strcmp((const char *)myList.tail->prevNode->data, "Hello")==0);
+}
+
+/**
+ * This method will test adding three items onto the list.  It will verify that
+ * the item is added appropriately from a location standpoint and that the size
+ * is correct.
+ */
+
+void LinkedListTestCase::testThreeElementAdd() {
+	// Add a single valid element.
+	CPPUNIT_ASSERT_MESSAGE("Inappropriate return value from simple add.",
+			ll_add(&myList, "Hello", 6)==true);
+
+	// Add a second valid element.
+	CPPUNIT_ASSERT_MESSAGE("Inappropriate return value from simple add.",
+			ll_add(&myList, "World", 6)==true);
+
+	// Add a third valid element
+	CPPUNIT_ASSERT_MESSAGE("Inappropriate return value from simple add.",
+			ll_add(&myList, "This is London.", 16)==true);
+	CPPUNIT_ASSERT_MESSAGE("Head and tail of list match.",
+			myList.head!=myList.tail);
+	CPPUNIT_ASSERT_MESSAGE("Size is incorrect.", myList.size==3);
+	CPPUNIT_ASSERT_MESSAGE(
+			"List data does not match properly for head element.",
+			strcmp((const char *)myList.head->data,"Hello")==0);
+	CPPUNIT_ASSERT_MESSAGE(
+			"List data does not match properly for tail element.",
+			strcmp((const char *)myList.tail->data, "This is London.")==0);
+	CPPUNIT_ASSERT_MESSAGE("List does not walk properly in forward direction.",
+			strcmp((const char *)myList.head->nextNode->data, "World")==0);
+	CPPUNIT_ASSERT_MESSAGE("List does not walk properly in forward direction.",
+			strcmp((const char *)myList.head->nextNode->nextNode->data, "This is London.")==0);
+	CPPUNIT_ASSERT_MESSAGE(
+			"List does not walk properly in a backward direction.",
+			strcmp((const char *)myList.tail->prevNode->data, "World")==0);
+	CPPUNIT_ASSERT_MESSAGE(
+			"List does not walk properly in a backward direction.",
+			strcmp((const char *)myList.tail->prevNode->prevNode->data, "Hello")==0);
+}
+
+/**
+ * This method will that trying to remove from a null list fails.
+ */
+
+void LinkedListTestCase::testRemoveNullListFails() {
+	setupBasicList();
+
+	CPPUNIT_ASSERT_MESSAGE("Checking that a NULL list is ignored.",
+			ll_remove(NULL, 5)==false);
+}
+
+/**
+ * This method will test adding a single item onto the list.  It will verify that
+ * the item is added appropriately from a location standpoint and that the size
+ * is correct.
+ */
+
+void LinkedListTestCase::testRemoveOutOfRangeElementFails() {
+	setupBasicList();
+	CPPUNIT_ASSERT_MESSAGE("Checking that an out of range element is ignored.",
+			ll_remove(&myList, 5)==false);
+}
+
+/**
+ * This method will verify that we can properly remove the tail of the given list.
+ */
+void LinkedListTestCase::testRemoveTail() {
+	setupBasicList();
+
+	// Try removing the tail as a first attempt.
+	CPPUNIT_ASSERT_MESSAGE("Tail removal failed.", ll_remove(&myList, 4)==true);
+	CPPUNIT_ASSERT_MESSAGE("Tail message incorrect after removal.",
+			strcmp("Fall", (const char*)myList.tail->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Tail has a next element.",
+			myList.tail->nextNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==4);
+
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->data, "CS3841")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->data, "Operating")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->nextNode->data, "Systems")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->nextNode->nextNode->data, "Fall")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			myList.head->nextNode->nextNode->nextNode->nextNode==NULL);
+}
+
+/**
+ * This test verifies that the remove head function operates properly.
+ */
+void LinkedListTestCase::testRemoveHead() {
+	setupBasicList();
+
+	// Now try removing the head.
+	CPPUNIT_ASSERT_MESSAGE("Head removal failed.", ll_remove(&myList, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Head message incorrect after removal.",
+			strcmp("Operating", (const char*)myList.head->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Head has previous element.",
+			myList.head->prevNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==4);
+
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->data, "Operating")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->data, "Systems")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->nextNode->data, "Fall")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->nextNode->nextNode->data, "Quarter")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			myList.head->nextNode->nextNode->nextNode->nextNode==NULL);
+}
+
+/**
+ * This method will verify that removing from the middle of the list functions properly.
+ */
+void LinkedListTestCase::testRemoveMiddle() {
+	setupBasicList();
+
+	// Now try removing the head.
+	CPPUNIT_ASSERT_MESSAGE("Middle removal failed.",
+			ll_remove(&myList, 2)==true);
+	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==4);
+
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->data, "CS3841")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->data, "Operating")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->nextNode->data, "Fall")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->nextNode->nextNode->data, "Quarter")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			myList.head->nextNode->nextNode->nextNode->nextNode==NULL);
+}
+
+/**
+ * This method will test the remove operation extensivly.
+ */
+void LinkedListTestCase::testRemove() {
+	setupBasicList();
+
+	// Try removing the tail as a first attempt.
+	CPPUNIT_ASSERT_MESSAGE("Tail removal failed.", ll_remove(&myList, 4)==true);
+	CPPUNIT_ASSERT_MESSAGE("Tail message incorrect after removal.",
+			strcmp("Fall", (const char*)myList.tail->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Tail has a next element.",
+			myList.tail->nextNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==4);
+
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->data, "CS3841")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->data, "Operating")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->nextNode->data, "Systems")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->nextNode->nextNode->data, "Fall")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			myList.head->nextNode->nextNode->nextNode->nextNode==NULL);
+
+	// Now remove the head.
+	CPPUNIT_ASSERT_MESSAGE("Head removal failed.", ll_remove(&myList, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Tail message incorrect after removal.",
+			strcmp("Fall", (const char*)myList.tail->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Tail has a next element.",
+			myList.tail->nextNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Head has a previous element.",
+			myList.head->prevNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==3);
+
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->data, "Operating")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->data, "Systems")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->nextNode->data, "Fall")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			myList.head->nextNode->nextNode->nextNode==NULL);
+
+	// Now try removing from the middle
+	CPPUNIT_ASSERT_MESSAGE("Middle removal failed.",
+			ll_remove(&myList, 1)==true);
+	CPPUNIT_ASSERT_MESSAGE("Tail message incorrect after removal.",
+			strcmp("Fall", (const char*)myList.tail->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Tail has a next element.",
+			myList.tail->nextNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Head has a previous element.",
+			myList.head->prevNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==2);
+
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->data, "Operating")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->data, "Fall")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			myList.head->nextNode->nextNode==NULL);
+
+	// Remove from the end of the list again.
+	CPPUNIT_ASSERT_MESSAGE("Tail removal failed.", ll_remove(&myList, 1)==true);
+	CPPUNIT_ASSERT_MESSAGE("Tail message incorrect after removal.",
+			strcmp("Operating", (const char*)myList.tail->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Tail has a next element.",
+			myList.tail->nextNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Head has a previous element.",
+			myList.head->prevNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==1);
+
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->data, "Operating")==0);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			myList.head->nextNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Head and tail should match at this point.",
+			myList.head==myList.tail);
+
+	// Now try removing the head.
+	CPPUNIT_ASSERT_MESSAGE("Head removal failed.", ll_remove(&myList, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Head and tail should be NULL.", myList.head==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Head and tail should be NULL.", myList.tail==NULL);
+
+	// We we should have an empty list.  Check all of the status.
+	CPPUNIT_ASSERT_MESSAGE("Head not set properly.", myList.head==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Tail not set properly.", myList.tail==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Size not set properly.", myList.size==0);
+}
+
+/**
+ * This method ensures that the addIndex method is functioning properly.
+ */
+void LinkedListTestCase::testAddIndex() {
+	// Start by setting up a basic list.
+	ll_add(&myList, "Hello", 6);
+	ll_add(&myList, "This is London.", 16);
+
+	// Check to make sure the list is in the right shape.  This should never fail unless one of the test above is also failing.
+	CPPUNIT_ASSERT_MESSAGE("Size is incorrect.", myList.size==2);
+
+	// Check to make ceratin all of the invalid parameters fail properly.
+	CPPUNIT_ASSERT_MESSAGE("Invalid list parameter",
+			ll_addIndex(NULL, "World", 6, 1)==false);
+	CPPUNIT_ASSERT_MESSAGE("Invalid object to add.",
+			ll_addIndex(&myList, NULL, 6, 1)==false);
+	CPPUNIT_ASSERT_MESSAGE("Invalid size of object to add.",
+			ll_addIndex(&myList, "World", 0, 1)==false);
+	CPPUNIT_ASSERT_MESSAGE("Invalid index for add.",
+			ll_addIndex(&myList, "World", 6, 3)==false);
+
+	// Check to make certain adding to the tail effectivly works.
+	CPPUNIT_ASSERT_MESSAGE("Improper tail element with addIndex function.",
+			ll_addIndex(&myList, "Here is the news.", 18, 2)==true);
+	CPPUNIT_ASSERT_MESSAGE("Size improper after add.", myList.size==3);
+	CPPUNIT_ASSERT_MESSAGE("Tail set up properly.",
+			strcmp("Here is the news.", (const char*)myList.tail->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Tail not given null as next element.",
+			myList.tail->nextNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Previous not set up properly from tail add.",
+			strcmp("This is London.", (const char*)myList.tail->prevNode->data)==0);
+
+	// Now try adding to the head of the list.
+	CPPUNIT_ASSERT_MESSAGE("Improper behavior of addindex function.",
+			ll_addIndex(&myList, "CS3841", 7, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Size improper after add.", myList.size==4);
+	CPPUNIT_ASSERT_MESSAGE("Head set up properly.",
+			strcmp("CS3841", (const char*)myList.head->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Head not given null as previous element.",
+			myList.head->prevNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Next not set up properly from tail add.",
+			strcmp("Hello", (const char*)myList.head->nextNode->data)==0);
+
+	// Now try adding in the middle of the list.
+	CPPUNIT_ASSERT_MESSAGE("Improper tail element with addIndex function.",
+			ll_addIndex(&myList, "World", 6, 2)==true);
+	CPPUNIT_ASSERT_MESSAGE("Size improper after add.", myList.size==5);
+
+	// Now walk ther list and check everything.
+	// List list should be the following.
+
+	CPPUNIT_ASSERT_MESSAGE("Head set up properly.",
+			strcmp("CS3841", (const char*)(myList.head->data))==0);
+	CPPUNIT_ASSERT_MESSAGE("Head not given null as previous element.",
+			myList.head->prevNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Next not set up properly from tail add.",
+			strcmp("Hello", (const char*)myList.head->nextNode->data)==0);
+
+	struct listNode* n = myList.head;
+	CPPUNIT_ASSERT_MESSAGE("Head is incorrect.",
+			strcmp("CS3841", (const char*)n->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Improper next link.", n->nextNode!=NULL);
+	CPPUNIT_ASSERT_MESSAGE("Improper previous link.", n->prevNode==NULL);
+
+	// Walk to the next node.
+	n = n->nextNode;
+	CPPUNIT_ASSERT_MESSAGE("Node data is incorrect.",
+			strcmp("Hello", (const char*)n->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Improper next link.", n->nextNode!=NULL);
+	CPPUNIT_ASSERT_MESSAGE("Improper previous link.", n->prevNode!=NULL);
+
+	// Walk to the next node.
+	n = n->nextNode;
+	CPPUNIT_ASSERT_MESSAGE("Node data is incorrect.",
+			strcmp("World", (const char*)n->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Improper next link.", n->nextNode!=NULL);
+	CPPUNIT_ASSERT_MESSAGE("Improper previous link.", n->prevNode!=NULL);
+
+	// Walk to the next node.
+	n = n->nextNode;
+	CPPUNIT_ASSERT_MESSAGE("Node data is incorrect.",
+			strcmp("This is London.", (const char*)n->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Improper next link.", n->nextNode!=NULL);
+	CPPUNIT_ASSERT_MESSAGE("Improper previous link.", n->prevNode!=NULL);
+
+	// Walk to the next node.
+	n = n->nextNode;
+	CPPUNIT_ASSERT_MESSAGE("Node data is incorrect.",
+			strcmp("Here is the news.", (const char*)n->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Improper next link.", n->nextNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Improper previous link.", n->prevNode!=NULL);
+}
+
+/**
+ * This method ensures that the get operation is working properly.
+ */
+void LinkedListTestCase::testGet() {
+
+	const char* messages[] = { "CS3841", "Operating", "Systems", "Fall",
+			"Quarter" };
+	int index;
+
+	setupBasicList();
+	char *data;
+
+	// Verify basic parameter checks operate properly.
+	CPPUNIT_ASSERT_MESSAGE("NULL parameter improperly allowed.",
+			ll_get(NULL, 1)==NULL);
+	CPPUNIT_ASSERT_MESSAGE("OUT of range parameter not ignored.",
+			ll_get(&myList, 1000)==false);
+
+	for (index = 0; index < 5; index++) {
+		data = (char*) ll_get(&myList, index);
+		CPPUNIT_ASSERT_MESSAGE("Improper message on get",
+				strcmp(messages[index], data)==0);
+	}
+}
+
+/**
+ * This method will ensure that the clear operation clears properly.
+ */
+void LinkedListTestCase::testClear() {
+	setupBasicList();
+	CPPUNIT_ASSERT_MESSAGE("Starting size incorrect.", ll_size(&myList)==5);
+	ll_clear(&myList);
+
+	CPPUNIT_ASSERT_MESSAGE("Head not set properly.", myList.head==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Tail not set properly.", myList.tail==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Size not set properly.", myList.size==0);
+}
+
+/**
+ * This method will verify that the size operator is working properly.
+ */
+void LinkedListTestCase::testSize() {
+	CPPUNIT_ASSERT_MESSAGE("Empty list does not have 0 size.",
+			ll_size(&myList)==0);
+	CPPUNIT_ASSERT_MESSAGE("Size does not match structure.",
+			ll_size(&myList)==myList.size);
+
+	// Add something and make certain the size goes up.
+	ll_add(&myList, "Hello", 6);
+
+	CPPUNIT_ASSERT_MESSAGE("1 element list does not have 1 size.",
+			ll_size(&myList)==1);
+	CPPUNIT_ASSERT_MESSAGE("Size does not match structure.",
+			ll_size(&myList)==myList.size);
+}
+
+/**
+ * This method ensures that the iterator being null does not impact the system.
+ */
+void LinkedListTestCase::testIteratorNull() {
+	setupBasicList();
+
+	// Start by testing the obtaining of the iterator.
+	struct linkedListIterator *iter;
+
+	iter = ll_getIterator(NULL);
+	CPPUNIT_ASSERT_MESSAGE("Iterator should be NULL.", iter==NULL);
+}
+
+/**
+ * This method ensures that doing a free on the iterator does not damage the list.
+ */
+void LinkedListTestCase::testIteratorFreeDoesNotDamageList() {
+	const char* messages[] = { "CS3841", "Operating", "Systems", "Fall",
+			"Quarter" };
+
+	setupBasicList();
+	char* data;
+
+	// Start by testing the obtaining of the iterator.
+	struct linkedListIterator *iter;
+
+	// Now test obtaining a valid iterator.
+	iter = ll_getIterator(&myList);
+
+	data = (char*) ll_next(iter);
+
+	free(iter);
+
+	CPPUNIT_ASSERT_MESSAGE("Data damaged when free operation occurred.",
+			strcmp(messages[0], data)==0);
+}
+
+/**
+ * This method ensures that the iterator walks through the code properly.
+ */
+void LinkedListTestCase::testIterator() {
+	const char* messages[] = { "CS3841", "Operating", "Systems", "Fall",
+			"Quarter" };
+	int index;
+
+	setupBasicList();
+	char* data;
+
+	// Start by testing the obtaining of the iterator.
+	struct linkedListIterator *iter;
+
+	// Now test obtaining a valid iterator.
+	iter = ll_getIterator(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Iterator should not be NULL.", iter!=NULL);
+	CPPUNIT_ASSERT_MESSAGE("Iterator's current should be the head of the list.",
+			iter->current==myList.head);
+
+	for (index = 0; index < 5; index++) {
+		CPPUNIT_ASSERT_MESSAGE(
+				"An invalid iterator should result in a false value.",
+				ll_hasNext(NULL)==false);
+		CPPUNIT_ASSERT_MESSAGE("Iterator should have a next right now.",
+				ll_hasNext(iter)==true);
+
+		CPPUNIT_ASSERT_MESSAGE(
+				"Invalid parameter to next should result in NULL being returned,",
+				ll_next(NULL)==NULL);
+		data = (char*) ll_next(iter);
+		CPPUNIT_ASSERT_MESSAGE("Expected true for correct next operation.",
+				data!=NULL);
+		CPPUNIT_ASSERT_MESSAGE("Data returned does not match expected data.",
+				strcmp(messages[index], data)==0);
+	}
+
+	// Now we have stepped through everything.  There should be nothing left for the next.
+	CPPUNIT_ASSERT_MESSAGE("Extra next operation.", ll_hasNext(iter)==false);
+	CPPUNIT_ASSERT_MESSAGE(
+			"Invalid return value when attempting to retrieve beyond the end of the list.",
+			ll_next(iter)==NULL);
+
+	free(iter);
+
+}
+
+/**
+ * This method verifies that nodes removed in concurrent reader mode are kept until they are
+ * reclaimed and that the list still behaves normally.
+ */
+void LinkedListTestCase::testConcurrentReadersRetireRemovedNodes() {
+	CPPUNIT_ASSERT_MESSAGE("Invalid list parameter",
+			ll_setConcurrentReaders(NULL, true)==false);
+	CPPUNIT_ASSERT_MESSAGE("Enabling concurrent readers failed.",
+			ll_setConcurrentReaders(&myList, true)==true);
+	setupBasicList();
+
+	CPPUNIT_ASSERT_MESSAGE("Head removal failed.", ll_remove(&myList, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Tail removal failed.", ll_remove(&myList, 3)==true);
+	CPPUNIT_ASSERT_MESSAGE("Incorrect size after removal.", myList.size==3);
+	CPPUNIT_ASSERT_MESSAGE("Removed nodes not retired.", myList.retiredCount==2);
+	CPPUNIT_ASSERT_MESSAGE("Head message incorrect after removal.",
+			strcmp("Operating", (const char*)myList.head->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Tail message incorrect after removal.",
+			strcmp("Fall", (const char*)myList.tail->data)==0);
+
+	// A reader may keep reading inside a critical section.
+	CPPUNIT_ASSERT_MESSAGE("Read lock failed.", ll_rcuReadLock()==true);
+	CPPUNIT_ASSERT_MESSAGE("Nested read lock failed.", ll_rcuReadLock()==true);
+	ll_rcuReadUnlock();
+	ll_rcuReadUnlock();
+
+	ll_rcuReclaim(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Retired nodes not freed.", myList.retired==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Retired count not reset.", myList.retiredCount==0);
+
+	ll_clear(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Mode lost on clear.", myList.concurrentReaders==true);
+	CPPUNIT_ASSERT_MESSAGE("Size not set properly.", myList.size==0);
+	ll_rcuUnregisterThread();
+}
+
+/**
+ * This structure is shared by the threads of the concurrent reader stress test.
+ */
+struct concurrentReaderState
+{
+	linkedList* list;
+	bool done;
+	bool failed;
+};
+
+/**
+ * This function repeatedly walks the list inside read-side critical sections and checks that
+ * every element it reaches still holds a valid payload.
+ * @param arg This is a pointer to the shared concurrentReaderState.
+ * @return This always returns NULL.
+ */
+static void* concurrentReader(void* arg) {
+	struct concurrentReaderState* state = (struct concurrentReaderState*)arg;
+
+	while (!__atomic_load_n(&state->done, __ATOMIC_ACQUIRE)) {
+		struct linkedListIterator* iter;
+
+		ll_rcuReadLock();
+		iter = ll_getIterator(state->list);
+		while (ll_hasNext(iter)) {
+			int* value = (int*) ll_next(iter);
+			// Writers store each value next to its negation.
+			if (value[0] != -value[1]) {
+				__atomic_store_n(&state->failed, true, __ATOMIC_RELAXED);
+			}
+		}
+		ll_rcuReadUnlock();
+		free(iter);
+	}
+
+	ll_rcuUnregisterThread();
+	return NULL;
+}
+
+/**
+ * This method runs several readers against a writer that keeps adding and removing elements.
+ * It is meant to be run under ThreadSanitizer and AddressSanitizer as well.
+ */
+void LinkedListTestCase::testConcurrentReadersStress() {
+	const int readerCount = 4;
+	pthread_t threads[readerCount];
+	struct concurrentReaderState state = { &myList, false, false };
+	int index;
+
+	ll_setConcurrentReaders(&myList, true);
+
+	for (index = 0; index < readerCount; index++) {
+		pthread_create(&threads[index], NULL, concurrentReader, &state);
+	}
+
+	for (index = 0; index < 20000; index++) {
+		int value[2] = { index, -index };
+
+		if ((ll_size(&myList) < 64) || (index % 3 == 0)) {
+			ll_addIndex(&myList, value, sizeof(value), index % (ll_size(&myList) + 1));
+		} else {
+			ll_remove(&myList, index % ll_size(&myList));
+		}
+	}
+
+	__atomic_store_n(&state.done, true, __ATOMIC_RELEASE);
+	for (index = 0; index < readerCount; index++) {
+		pthread_join(threads[index], NULL);
+	}
+
+	CPPUNIT_ASSERT_MESSAGE("Reader saw a damaged element.", state.failed==false);
+	ll_setConcurrentReaders(&myList, false);
+	CPPUNIT_ASSERT_MESSAGE("Retired nodes not freed when leaving the mode.",
+			myList.retired==NULL);
+}
+
+/**
+ * This method verifies that changing a persistent list does not change snapshots taken of it.
+ */
+void LinkedListTestCase::testPersistentSnapshotIsUnchanged() {
+	const char* messages[] = { "CS3841", "Operating", "Systems", "Fall",
+			"Quarter" };
+	struct persistentList version;
+	struct persistentList snapshot;
+	int index;
+
+	setupBasicList();
+	pl_init(&version);
+	pl_init(&snapshot);
+
+	CPPUNIT_ASSERT_MESSAGE("Building from a list failed.",
+			pl_fromList(&version, &myList)==true);
+	CPPUNIT_ASSERT_MESSAGE("Snapshot failed.",
+			pl_snapshot(&version, &snapshot)==true);
+	CPPUNIT_ASSERT_MESSAGE("Snapshot does not share the head.",
+			snapshot.head==version.head);
+
+	CPPUNIT_ASSERT_MESSAGE("Remove failed.", pl_remove(&version, 2)==true);
+	CPPUNIT_ASSERT_MESSAGE("Add failed.", pl_add(&version, "Spring", 7)==true);
+	CPPUNIT_ASSERT_MESSAGE("Add index failed.",
+			pl_addIndex(&version, "MSOE", 5, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Invalid index for add.",
+			pl_addIndex(&version, "MSOE", 5, 7)==false);
+
+	// The snapshot still holds the original elements.
+	CPPUNIT_ASSERT_MESSAGE("Snapshot size changed.", pl_size(&snapshot)==5);
+	for (index = 0; index < 5; index++) {
+		CPPUNIT_ASSERT_MESSAGE("Snapshot changed.",
+				strcmp(messages[index], (const char*)pl_get(&snapshot, index))==0);
+	}
+
+	// The new version holds the changes.
+	CPPUNIT_ASSERT_MESSAGE("Version size incorrect.", pl_size(&version)==6);
+	CPPUNIT_ASSERT_MESSAGE("Version head incorrect.",
+			strcmp("MSOE", (const char*)pl_get(&version, 0))==0);
+	CPPUNIT_ASSERT_MESSAGE("Version middle incorrect.",
+			strcmp("Fall", (const char*)pl_get(&version, 3))==0);
+	CPPUNIT_ASSERT_MESSAGE("Version tail incorrect.",
+			strcmp("Spring", (const char*)pl_get(&version, 5))==0);
+
+	pl_clear(&version);
+	CPPUNIT_ASSERT_MESSAGE("Snapshot damaged by clearing the version.",
+			strcmp("Quarter", (const char*)pl_get(&snapshot, 4))==0);
+	pl_clear(&snapshot);
+	CPPUNIT_ASSERT_MESSAGE("Size not set properly.", pl_size(&snapshot)==0);
+}
+
+/**
+ * This method verifies that a change only copies the nodes in front of it and that data is
+ * shared between versions instead of being copied.
+ */
+void LinkedListTestCase::testPersistentSharesUntouchedNodes() {
+	struct persistentList version;
+	struct persistentList snapshot;
+	struct persistentListIterator* iter;
+
+	setupBasicList();
+	pl_init(&version);
+	pl_init(&snapshot);
+	pl_fromList(&version, &myList);
+	pl_snapshot(&version, &snapshot);
+
+	// Removing index 1 copies only the head.
+	pl_remove(&version, 1);
+	CPPUNIT_ASSERT_MESSAGE("Head was not copied.", version.head!=snapshot.head);
+	CPPUNIT_ASSERT_MESSAGE("Data was copied.",
+			version.head->data==snapshot.head->data);
+	CPPUNIT_ASSERT_MESSAGE("Untouched nodes were copied.",
+			version.head->nextNode==snapshot.head->nextNode->nextNode);
+
+	// A node owned by one version only is changed in place.
+	struct persistentNode* head = version.head;
+	pl_remove(&version, 1);
+	CPPUNIT_ASSERT_MESSAGE("Unshared head was copied.", version.head==head);
+
+	iter = pl_getIterator(&version);
+	CPPUNIT_ASSERT_MESSAGE("Iterator head incorrect.",
+			strcmp("CS3841", (const char*)pl_next(iter))==0);
+	CPPUNIT_ASSERT_MESSAGE("Iterator order incorrect.",
+			strcmp("Fall", (const char*)pl_next(iter))==0);
+	CPPUNIT_ASSERT_MESSAGE("Iterator order incorrect.",
+			strcmp("Quarter", (const char*)pl_next(iter))==0);
+	CPPUNIT_ASSERT_MESSAGE("Extra next operation.", pl_hasNext(iter)==false);
+	free(iter);
+
+	pl_clear(&snapshot);
+	pl_clear(&version);
+}
+
+/**
+ * This method verifies that pushing to the front and peeking at both ends work properly.
+ */
+void LinkedListTestCase::testPushAndPeek() {
+	ll_size_t size = 0;
+
+	CPPUNIT_ASSERT_MESSAGE("Improper handling of null list",
+			ll_pushFront(NULL, "Hello", 6)==false);
+	CPPUNIT_ASSERT_MESSAGE("Improper handling of NULL object.",
+			ll_pushFront(&myList, NULL, 6)==false);
+	CPPUNIT_ASSERT_MESSAGE("Empty list has a front.",
+			ll_peekFront(&myList, &size)==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Empty list has a back.",
+			ll_peekBack(&myList, &size)==NULL);
+
+	CPPUNIT_ASSERT_MESSAGE("Push to empty list failed.",
+			ll_pushFront(&myList, "World", 6)==true);
+	CPPUNIT_ASSERT_MESSAGE("Head and tail of list match.",
+			myList.head==myList.tail);
+	CPPUNIT_ASSERT_MESSAGE("Push to front failed.",
+			ll_pushFront(&myList, "Hello", 6)==true);
+	CPPUNIT_ASSERT_MESSAGE("Size is incorrect.", myList.size==2);
+	CPPUNIT_ASSERT_MESSAGE("Head has previous element.",
+			myList.head->prevNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("List does not walk properly in a backward direction.",
+			strcmp((const char *)myList.tail->prevNode->data, "Hello")==0);
+
+	CPPUNIT_ASSERT_MESSAGE("Front incorrect.",
+			strcmp((const char*)ll_peekFront(&myList, &size), "Hello")==0);
+	CPPUNIT_ASSERT_MESSAGE("Front size incorrect.", size==6);
+	CPPUNIT_ASSERT_MESSAGE("Back incorrect.",
+			strcmp((const char*)ll_peekBack(&myList, NULL), "World")==0);
+	CPPUNIT_ASSERT_MESSAGE("Peek changed the size.", myList.size==2);
+}
+
+/**
+ * This method verifies that popping from both ends hands the original data to the caller.
+ */
+void LinkedListTestCase::testPopHandsOverData() {
+	ll_size_t size = 0;
+	void* stored;
+	char* data;
+
+	CPPUNIT_ASSERT_MESSAGE("Improper handling of null list",
+			ll_popFront(NULL, &size)==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Empty list popped an element.",
+			ll_popBack(&myList, &size)==NULL);
+
+	setupBasicList();
+
+	stored = myList.tail->data;
+	data = (char*) ll_popBack(&myList, &size);
+	CPPUNIT_ASSERT_MESSAGE("Data was copied instead of handed over.", data==stored);
+	CPPUNIT_ASSERT_MESSAGE("Back data incorrect.", strcmp(data, "Quarter")==0);
+	CPPUNIT_ASSERT_MESSAGE("Back size incorrect.", size==8);
+	CPPUNIT_ASSERT_MESSAGE("Tail has a next element.", myList.tail->nextNode==NULL);
+	free(data);
+
+	stored = myList.head->data;
+	data = (char*) ll_popFront(&myList, NULL);
+	CPPUNIT_ASSERT_MESSAGE("Data was copied instead of handed over.", data==stored);
+	CPPUNIT_ASSERT_MESSAGE("Front data incorrect.", strcmp(data, "CS3841")==0);
+	CPPUNIT_ASSERT_MESSAGE("Head has a previous element.", myList.head->prevNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Incorrect size after pops.", myList.size==3);
+	free(data);
+
+	// Drain the rest of the list from both ends.
+	free(ll_popFront(&myList, NULL));
+	free(ll_popBack(&myList, NULL));
+	data = (char*) ll_popBack(&myList, NULL);
+	CPPUNIT_ASSERT_MESSAGE("Last element incorrect.", strcmp(data, "Systems")==0);
+	free(data);
+
+	CPPUNIT_ASSERT_MESSAGE("Head not set properly.", myList.head==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Tail not set properly.", myList.tail==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Size not set properly.", myList.size==0);
+}
+
+/**
+ * This method verifies that the owner pops newest first, thieves steal oldest first and
+ * the deque grows past its initial capacity.
+ */
+void LinkedListTestCase::testWorkStealingDequeOrder() {
+	struct workStealingDeque deque;
+	long index;
+
+	CPPUNIT_ASSERT_MESSAGE("Initialization failed.", wsd_init(&deque, 4)==true);
+	CPPUNIT_ASSERT_MESSAGE("Empty deque popped an item.", wsd_pop(&deque)==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Empty deque had an item stolen.", wsd_steal(&deque)==NULL);
+	CPPUNIT_ASSERT_MESSAGE("NULL item accepted.", wsd_push(&deque, NULL)==false);
+
+	for (index = 1; index <= 100; index++) {
+		CPPUNIT_ASSERT_MESSAGE("Push failed.", wsd_push(&deque, (void*)index)==true);
+	}
+	CPPUNIT_ASSERT_MESSAGE("Size incorrect.", wsd_size(&deque)==100);
+
+	CPPUNIT_ASSERT_MESSAGE("Owner did not pop the newest item.", wsd_pop(&deque)==(void*)100);
+	CPPUNIT_ASSERT_MESSAGE("Thief did not steal the oldest item.", wsd_steal(&deque)==(void*)1);
+	CPPUNIT_ASSERT_MESSAGE("Thief did not steal the oldest item.", wsd_steal(&deque)==(void*)2);
+	CPPUNIT_ASSERT_MESSAGE("Size incorrect.", wsd_size(&deque)==97);
+
+	for (index = 99; index >= 3; index--) {
+		CPPUNIT_ASSERT_MESSAGE("Owner pop order incorrect.", wsd_pop(&deque)==(void*)index);
+	}
+	CPPUNIT_ASSERT_MESSAGE("Drained deque popped an item.", wsd_pop(&deque)==NULL);
+
+	wsd_destroy(&deque);
+}
+
+/**
+ * This structure is shared by the threads of the work-stealing test.
+ */
+struct stealState
+{
+	struct workStealingDeque* deque;
+	bool done;
+	long sum;
+};
+
+/**
+ * This function steals items until the owner is done and the deque is empty.
+ * @param arg This is a pointer to the shared stealState.
+ * @return This always returns NULL.
+ */
+static void* stealer(void* arg) {
+	struct stealState* state = (struct stealState*)arg;
+	long sum = 0;
+
+	while (!__atomic_load_n(&state->done, __ATOMIC_ACQUIRE) || (wsd_size(state->deque) > 0)) {
+		long item = (long) wsd_steal(state->deque);
+		sum += item;
+	}
+
+	__atomic_add_fetch(&state->sum, sum, __ATOMIC_RELAXED);
+	return NULL;
+}
+
+/**
+ * This method verifies that every item is taken exactly once while thieves steal from an
+ * owner that keeps pushing and popping.
+ */
+void LinkedListTestCase::testWorkStealingDequeSteal() {
+	const int thiefCount = 3;
+	const long itemCount = 50000;
+	pthread_t threads[thiefCount];
+	struct workStealingDeque deque;
+	struct stealState state = { &deque, false, 0 };
+	long sum = 0;
+	long index;
+
+	wsd_init(&deque, 8);
+	for (index = 0; index < thiefCount; index++) {
+		pthread_create(&threads[index], NULL, stealer, &state);
+	}
+
+	for (index = 1; index <= itemCount; index++) {
+		wsd_push(&deque, (void*)index);
+		if (index % 4 == 0) {
+			sum += (long) wsd_pop(&deque);
+		}
+	}
+
+	__atomic_store_n(&state.done, true, __ATOMIC_RELEASE);
+	for (index = 0; index < thiefCount; index++) {
+		pthread_join(threads[index], NULL);
+	}
+
+	sum += state.sum;
+	CPPUNIT_ASSERT_MESSAGE("Items were lost or taken twice.",
+			sum==(itemCount * (itemCount + 1)) / 2);
+	wsd_destroy(&deque);
+}
+
+/**
+ * This method verifies that elements are moved between lists without being copied.
+ */
+void LinkedListTestCase::testTransfer() {
+	linkedList other;
+	void* stored;
+
+	setupBasicList();
+	ll_init(&other);
+	ll_add(&other, "Hello", 6);
+
+	CPPUNIT_ASSERT_MESSAGE("Invalid list parameter",
+			ll_transfer(NULL, &myList, 2)==0);
+	CPPUNIT_ASSERT_MESSAGE("Transfer to the same list allowed.",
+			ll_transfer(&myList, &myList, 2)==0);
+
+	stored = myList.head->data;
+	CPPUNIT_ASSERT_MESSAGE("Partial transfer failed.",
+			ll_transfer(&other, &myList, 2)==2);
+	CPPUNIT_ASSERT_MESSAGE("Source size incorrect.", myList.size==3);
+	CPPUNIT_ASSERT_MESSAGE("Destination size incorrect.", other.size==3);
+	CPPUNIT_ASSERT_MESSAGE("Data was copied.", other.head->nextNode->data==stored);
+	CPPUNIT_ASSERT_MESSAGE("Source head incorrect.",
+			strcmp("Systems", (const char*)myList.head->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Source head has a previous element.",
+			myList.head->prevNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Destination tail incorrect.",
+			strcmp("Operating", (const char*)other.tail->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Destination tail has a next element.",
+			other.tail->nextNode==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Destination does not walk backwards.",
+			strcmp("Hello", (const char*)other.tail->prevNode->prevNode->data)==0);
+
+	CPPUNIT_ASSERT_MESSAGE("Full transfer failed.",
+			ll_transfer(&other, &myList, 100)==3);
+	CPPUNIT_ASSERT_MESSAGE("Source not empty.",
+			(myList.head==NULL) && (myList.tail==NULL) && (myList.size==0));
+	CPPUNIT_ASSERT_MESSAGE("Destination tail incorrect.",
+			strcmp("Quarter", (const char*)other.tail->data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Destination size incorrect.", other.size==6);
+
+	ll_clear(&other);
+}
+
+/**
+ * This method verifies that a full or empty queue gives up after its timeout and that closing
+ * the queue lets consumers drain it.
+ */
+void LinkedListTestCase::testBoundedQueueTimeouts() {
+	struct boundedQueue queue;
+	ll_size_t size = 0;
+	char* data;
+
+	CPPUNIT_ASSERT_MESSAGE("Zero capacity accepted.", bq_init(&queue, 0)==false);
+	CPPUNIT_ASSERT_MESSAGE("Initialization failed.", bq_init(&queue, 2)==true);
+
+	CPPUNIT_ASSERT_MESSAGE("Empty queue returned an element.",
+			bq_timedDequeue(&queue, &size, 0)==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Empty queue returned an element after waiting.",
+			bq_timedDequeue(&queue, &size, 10)==NULL);
+
+	CPPUNIT_ASSERT_MESSAGE("Enqueue failed.", bq_enqueue(&queue, "Hello", 6)==true);
+	CPPUNIT_ASSERT_MESSAGE("Enqueue failed.", bq_timedEnqueue(&queue, "World", 6, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Full queue accepted an element.",
+			bq_timedEnqueue(&queue, "Full", 5, 0)==false);
+	CPPUNIT_ASSERT_MESSAGE("Full queue accepted an element after waiting.",
+			bq_timedEnqueue(&queue, "Full", 5, 10)==false);
+	CPPUNIT_ASSERT_MESSAGE("Size incorrect.", bq_size(&queue)==2);
+
+	data = (char*) bq_dequeue(&queue, &size);
+	CPPUNIT_ASSERT_MESSAGE("Queue order incorrect.", strcmp("Hello", data)==0);
+	CPPUNIT_ASSERT_MESSAGE("Size of data incorrect.", size==6);
+	free(data);
+
+	bq_close(&queue);
+	CPPUNIT_ASSERT_MESSAGE("Closed queue accepted an element.",
+			bq_enqueue(&queue, "Closed", 7)==false);
+	data = (char*) bq_dequeue(&queue, NULL);
+	CPPUNIT_ASSERT_MESSAGE("Closed queue was not drained.", strcmp("World", data)==0);
+	free(data);
+	CPPUNIT_ASSERT_MESSAGE("Closed and empty queue blocked or returned data.",
+			bq_dequeue(&queue, NULL)==NULL);
+
+	bq_destroy(&queue);
+}
+
+/**
+ * This function enqueues a range of numbers into the shared queue.
+ * @param arg This is a pointer to the boundedQueue.
+ * @return This always returns NULL.
+ */
+static void* queueProducer(void* arg) {
+	struct boundedQueue* queue = (struct boundedQueue*)arg;
+
+	for (long value = 1; value <= 10000; value++) {
+		bq_enqueue(queue, &value, sizeof(value));
+	}
+
+	return NULL;
+}
+
+/**
+ * This structure is used by a consumer thread of the queue test.
+ */
+struct queueConsumerState
+{
+	struct boundedQueue* queue;
+	long sum;
+	long count;
+};
+
+/**
+ * This function drains the shared queue in batches until it is closed and empty.
+ * @param arg This is a pointer to the queueConsumerState of the thread.
+ * @return This always returns NULL.
+ */
+static void* queueConsumer(void* arg) {
+	struct queueConsumerState* state = (struct queueConsumerState*)arg;
+	linkedList batch;
+
+	ll_init(&batch);
+	while (bq_dequeueBatch(state->queue, &batch, 16) != 0) {
+		while (ll_size(&batch) != 0) {
+			long* value = (long*) ll_popFront(&batch, NULL);
+			state->sum += *value;
+			state->count++;
+			free(value);
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * This method runs several producers and consumers against a small queue and checks that
+ * every element arrives exactly once.
+ */
+void LinkedListTestCase::testBoundedQueueProducersConsumers() {
+	const int threadCount = 3;
+	pthread_t producers[threadCount];
+	pthread_t consumers[threadCount];
+	struct queueConsumerState states[threadCount];
+	struct boundedQueue queue;
+	long sum = 0;
+	long count = 0;
+	int index;
+
+	bq_init(&queue, 8);
+	for (index = 0; index < threadCount; index++) {
+		states[index].queue = &queue;
+		states[index].sum = 0;
+		states[index].count = 0;
+		pthread_create(&consumers[index], NULL, queueConsumer, &states[index]);
+		pthread_create(&producers[index], NULL, queueProducer, &queue);
+	}
+
+	for (index = 0; index < threadCount; index++) {
+		pthread_join(producers[index], NULL);
+	}
+	bq_close(&queue);
+	for (index = 0; index < threadCount; index++) {
+		pthread_join(consumers[index], NULL);
+		sum += states[index].sum;
+		count += states[index].count;
+	}
+
+	CPPUNIT_ASSERT_MESSAGE("Elements were lost or duplicated.", count==threadCount * 10000);
+	CPPUNIT_ASSERT_MESSAGE("Element values damaged.", sum==threadCount * 50005000L);
+	bq_destroy(&queue);
+}
+
+/**
+ * This structure is used by a thread of the sharded builder tests.
+ */
+struct builderThreadState
+{
+	struct shardedBuilder* builder;
+	uint32_t shard;
+	uint32_t shardCount;
+};
+
+/**
+ * This function adds every shardCount-th number to its own shard, using the number as the
+ * sequence number.
+ * @param arg This is a pointer to the builderThreadState of the thread.
+ * @return This always returns NULL.
+ */
+static void* builderThread(void* arg) {
+	struct builderThreadState* state = (struct builderThreadState*)arg;
+
+	for (long value = state->shard; value < 4000; value += state->shardCount) {
+		sb_addSequenced(state->builder, state->shard, value, &value, sizeof(value));
+	}
+
+	return NULL;
+}
+
+/**
+ * This method builds a list from several threads and merges the shards in any order.
+ */
+void LinkedListTestCase::testShardedBuilderArbitraryMerge() {
+	const uint32_t shardCount = 4;
+	pthread_t threads[shardCount];
+	struct builderThreadState states[shardCount];
+	struct shardedBuilder builder;
+	struct linkedListIterator* iter;
+	long sum = 0;
+	uint32_t index;
+
+	CPPUNIT_ASSERT_MESSAGE("Zero shards accepted.", sb_init(&builder, 0)==false);
+	CPPUNIT_ASSERT_MESSAGE("Initialization failed.", sb_init(&builder, shardCount)==true);
+	CPPUNIT_ASSERT_MESSAGE("Shards share cache lines.",
+			((uintptr_t)&builder.shards[1] - (uintptr_t)&builder.shards[0]) % 64==0);
+	CPPUNIT_ASSERT_MESSAGE("Invalid shard accepted.",
+			sb_add(&builder, shardCount, "Hello", 6)==false);
+
+	for (index = 0; index < shardCount; index++) {
+		states[index].builder = &builder;
+		states[index].shard = index;
+		states[index].shardCount = shardCount;
+		pthread_create(&threads[index], NULL, builderThread, &states[index]);
+	}
+	for (index = 0; index < shardCount; index++) {
+		pthread_join(threads[index], NULL);
+	}
+
+	ll_add(&myList, "Hello", 6);
+	CPPUNIT_ASSERT_MESSAGE("Merge moved the wrong number of elements.",
+			sb_merge(&builder, &myList, SB_ORDER_ARBITRARY)==4000);
+	CPPUNIT_ASSERT_MESSAGE("Size incorrect.", myList.size==4001);
+	CPPUNIT_ASSERT_MESSAGE("Existing elements lost.",
+			strcmp("Hello", (const char*)myList.head->data)==0);
+
+	iter = ll_getIterator(&myList);
+	ll_next(iter);
+	while (ll_hasNext(iter)) {
+		sum += *(long*) ll_next(iter);
+	}
+	free(iter);
+	CPPUNIT_ASSERT_MESSAGE("Elements lost or duplicated.", sum==(3999L * 4000L) / 2);
+	CPPUNIT_ASSERT_MESSAGE("Shards not emptied.", builder.shards[0].list.size==0);
+
+	sb_destroy(&builder);
+}
+
+/**
+ * This method builds a list from several threads and merges the shards by sequence number.
+ */
+void LinkedListTestCase::testShardedBuilderSequenceMerge() {
+	const uint32_t shardCount = 3;
+	pthread_t threads[shardCount];
+	struct builderThreadState states[shardCount];
+	struct shardedBuilder builder;
+	struct linkedListIterator* iter;
+	long expected = 0;
+	bool ordered = true;
+	uint32_t index;
+
+	sb_init(&builder, shardCount);
+	for (index = 0; index < shardCount; index++) {
+		states[index].builder = &builder;
+		states[index].shard = index;
+		states[index].shardCount = shardCount;
+		pthread_create(&threads[index], NULL, builderThread, &states[index]);
+	}
+	for (index = 0; index < shardCount; index++) {
+		pthread_join(threads[index], NULL);
+	}
+
+	CPPUNIT_ASSERT_MESSAGE("Decreasing sequence accepted.",
+			sb_addSequenced(&builder, 0, 1, "Hello", 6)==false);
+	CPPUNIT_ASSERT_MESSAGE("Merge moved the wrong number of elements.",
+			sb_merge(&builder, &myList, SB_ORDER_SEQUENCE)==4000);
+
+	iter = ll_getIterator(&myList);
+	while (ll_hasNext(iter)) {
+		ordered = ordered && (*(long*) ll_next(iter) == expected);
+		expected++;
+	}
+	free(iter);
+	CPPUNIT_ASSERT_MESSAGE("Elements not in sequence order.", ordered==true);
+	CPPUNIT_ASSERT_MESSAGE("Tail incorrect.", *(long*)myList.tail->data==3999);
+
+	// The builder can be used again after a merge.
+	CPPUNIT_ASSERT_MESSAGE("Add after merge failed.", sb_add(&builder, 1, "Hello", 6)==true);
+	sb_destroy(&builder);
+}
+
+/**
+ * This counts the calls to countingDestructor.
+ */
+static int destructorCalls = 0;
+
+/**
+ * This function frees owned data and counts how often it was called.
+ * @param data This is the data to free.
+ */
+static void countingDestructor(void* data) {
+	destructorCalls++;
+	free(data);
+}
+
+/**
+ * This method verifies that owned data is stored without copying and freed with the
+ * configured destructor.
+ */
+void LinkedListTestCase::testAddOwned() {
+	char* buffer = (char*) malloc(6);
+	strcpy(buffer, "Hello");
+	destructorCalls = 0;
+
+	CPPUNIT_ASSERT_MESSAGE("Invalid list parameter",
+			ll_setPayloadDestructor(NULL, countingDestructor)==false);
+	CPPUNIT_ASSERT_MESSAGE("Setting the destructor failed.",
+			ll_setPayloadDestructor(&myList, countingDestructor)==true);
+	CPPUNIT_ASSERT_MESSAGE("Improper handling of NULL object.",
+			ll_addOwned(&myList, NULL, 6)==false);
+	CPPUNIT_ASSERT_MESSAGE("Improper handling of 0 size.",
+			ll_addOwned(&myList, buffer, 0)==false);
+
+	CPPUNIT_ASSERT_MESSAGE("Owned add failed.", ll_addOwned(&myList, buffer, 6)==true);
+	CPPUNIT_ASSERT_MESSAGE("Owned data was copied.", myList.head->data==buffer);
+	CPPUNIT_ASSERT_MESSAGE("Size of data incorrect.", myList.head->dataSize==6);
+	ll_add(&myList, "World", 6);
+
+	buffer = (char*) malloc(8);
+	strcpy(buffer, "Systems");
+	ll_addOwned(&myList, buffer, 8);
+
+	CPPUNIT_ASSERT_MESSAGE("Remove failed.", ll_remove(&myList, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Destructor not called on remove.", destructorCalls==1);
+	CPPUNIT_ASSERT_MESSAGE("Remove failed.", ll_remove(&myList, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Destructor called for a copy.", destructorCalls==1);
+	ll_clear(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Destructor not called on clear.", destructorCalls==2);
+}
+
+/**
+ * This method verifies that borrowed data is stored without copying and never freed.
+ */
+void LinkedListTestCase::testAddBorrowed() {
+	char buffer[] = "Borrowed";
+
+	CPPUNIT_ASSERT_MESSAGE("Invalid list parameter",
+			ll_addBorrowed(NULL, buffer, 9)==false);
+	CPPUNIT_ASSERT_MESSAGE("Borrowed add failed.", ll_addBorrowed(&myList, buffer, 9)==true);
+	CPPUNIT_ASSERT_MESSAGE("Borrowed add failed.", ll_addBorrowed(&myList, buffer, 9)==true);
+	CPPUNIT_ASSERT_MESSAGE("Borrowed data was copied.", ll_get(&myList, 1)==buffer);
+
+	// Freeing the stack buffer would crash, so these only pass if the list leaves it alone.
+	CPPUNIT_ASSERT_MESSAGE("Remove failed.", ll_remove(&myList, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Borrowed pop returned a copy.",
+			ll_popFront(&myList, NULL)==buffer);
+	ll_addBorrowed(&myList, buffer, 9);
+	ll_clear(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Borrowed data damaged.", strcmp(buffer, "Borrowed")==0);
+}
+
+/**
+ * This method verifies that taking and detaching hand data over without copying it.
+ */
+void LinkedListTestCase::testTakeAndDetach() {
+	ll_size_t size = 0;
+	void* stored;
+	char* data;
+
+	setupBasicList();
+	CPPUNIT_ASSERT_MESSAGE("Invalid list parameter", ll_take(NULL, 0, &size)==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Out of range take allowed.", ll_take(&myList, 5, &size)==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Out of range detach allowed.", ll_detach(&myList, 5, &size)==NULL);
+
+	stored = ll_get(&myList, 2);
+	data = (char*) ll_take(&myList, 2, &size);
+	CPPUNIT_ASSERT_MESSAGE("Data was copied instead of handed over.", data==stored);
+	CPPUNIT_ASSERT_MESSAGE("Data incorrect.", strcmp(data, "Systems")==0);
+	CPPUNIT_ASSERT_MESSAGE("Size of data incorrect.", size==8);
+	CPPUNIT_ASSERT_MESSAGE("Incorrect size after take.", myList.size==4);
+	CPPUNIT_ASSERT_MESSAGE("List Improperly Structured",
+			strcmp((char*)myList.head->nextNode->nextNode->data, "Fall")==0);
+	free(data);
+
+	stored = ll_get(&myList, 0);
+	data = (char*) ll_detach(&myList, 0, &size);
+	CPPUNIT_ASSERT_MESSAGE("Data was copied instead of handed over.", data==stored);
+	CPPUNIT_ASSERT_MESSAGE("Detach removed the element.", myList.size==4);
+	CPPUNIT_ASSERT_MESSAGE("Detached element no longer readable.", ll_get(&myList, 0)==data);
+
+	// The list must not free detached data, so clear before freeing it here.
+	ll_clear(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Detached data damaged.", strcmp(data, "CS3841")==0);
+	free(data);
+}
+
+/**
+ * This function adds one to the counter it is given.
+ * @param argument This is a pointer to the long counter.
+ */
+static void incrementTask(void* argument) {
+	__atomic_add_fetch((long*)argument, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * This method verifies that a pool runs every task once per run and can be used repeatedly.
+ */
+void LinkedListTestCase::testThreadPoolRunsEveryTask() {
+	struct threadPool pool;
+	struct threadPoolTask tasks[100];
+	long counter = 0;
+	int index;
+
+	CPPUNIT_ASSERT_MESSAGE("Zero workers accepted.", tp_init(&pool, 0)==false);
+	CPPUNIT_ASSERT_MESSAGE("Initialization failed.", tp_init(&pool, 3)==true);
+	for (index = 0; index < 100; index++) {
+		tasks[index].function = incrementTask;
+		tasks[index].argument = &counter;
+	}
+
+	for (index = 0; index < 10; index++) {
+		CPPUNIT_ASSERT_MESSAGE("Run failed.", tp_run(&pool, tasks, 100)==true);
+	}
+	CPPUNIT_ASSERT_MESSAGE("Tasks lost or repeated.", counter==1000);
+	CPPUNIT_ASSERT_MESSAGE("Empty run failed.", tp_run(&pool, NULL, 0)==true);
+
+	tp_destroy(&pool);
+}
+
+/**
+ * This function records the thread it runs on and sleeps a little so other workers try to steal.
+ * @param argument This is a pointer to the pthread_t to record the thread in.
+ */
+static void recordThreadTask(void* argument) {
+	*(pthread_t*)argument = pthread_self();
+	usleep(1000);
+}
+
+/**
+ * This method verifies that a run limited to some workers only runs its tasks on that many threads.
+ */
+void LinkedListTestCase::testThreadPoolLimitsWorkers() {
+	struct threadPool pool;
+	struct threadPoolTask tasks[32];
+	pthread_t ran[32];
+	pthread_t seen[32];
+	int distinct = 0;
+	int index;
+
+	CPPUNIT_ASSERT_MESSAGE("Initialization failed.", tp_init(&pool, 4)==true);
+	for (index = 0; index < 32; index++) {
+		tasks[index].function = recordThreadTask;
+		tasks[index].argument = &ran[index];
+	}
+
+	CPPUNIT_ASSERT_MESSAGE("Limited run failed.", tp_runWorkers(&pool, tasks, 32, 2)==true);
+	for (index = 0; index < 32; index++) {
+		int known = 0;
+
+		while ((known < distinct) && !pthread_equal(seen[known], ran[index])) {
+			known++;
+		}
+		if (known == distinct) {
+			seen[distinct] = ran[index];
+			distinct++;
+		}
+	}
+	CPPUNIT_ASSERT_MESSAGE("Run used more workers than allowed.", distinct<=2);
+
+	// The run after a limited one uses every worker again.
+	CPPUNIT_ASSERT_MESSAGE("Full run failed.", tp_runWorkers(&pool, tasks, 32, 0)==true);
+
+	tp_destroy(&pool);
+}
+
+/**
+ * This structure is the argument of a task that starts a run of its own.
+ */
+struct nestedRun {
+	struct threadPool* pool; // The pool to start the inner run on
+	long* counter; // The counter the inner tasks increment
+};
+
+/**
+ * This function starts a run of eight counting tasks on the pool it is given and waits for it.
+ * @param argument This is a pointer to the nestedRun.
+ */
+static void nestedRunTask(void* argument) {
+	struct nestedRun* nested = (struct nestedRun*)argument;
+	struct threadPoolTask tasks[8];
+
+	for (int index = 0; index < 8; index++) {
+		tasks[index].function = incrementTask;
+		tasks[index].argument = nested->counter;
+	}
+	tp_run(nested->pool, tasks, 8);
+}
+
+/**
+ * This function adds the long stored in an element to a counter.
+ * @param data This is a pointer to the long.
+ * @param size This is the size of the element.
+ * @param context This is a pointer to the long counter.
+ */
+static void addToCounter(void* data, ll_size_t size, void* context) {
+	(void)size;
+	__atomic_add_fetch((long*)context, *(long*)data, __ATOMIC_RELAXED);
+}
+
+/**
+ * This function walks a list of longs in parallel and adds them to the counter in the context.
+ * @param data This is a pointer to the element of the outer list, unused.
+ * @param size This is the size of the element.
+ * @param context This is a pointer to the inner list, followed by the counter.
+ */
+static void nestedForEach(void* data, ll_size_t size, void* context) {
+	void** arguments = (void**)context;
+
+	(void)data;
+	(void)size;
+	ll_parallelForEach((struct linkedList*)arguments[0], addToCounter, arguments[1], 0);
+}
+
+/**
+ * This method verifies that tasks can start runs on the pool they run on without deadlocking,
+ * both through the pool and through nested parallel walks of lists.
+ */
+void LinkedListTestCase::testThreadPoolNestedRuns() {
+	struct threadPool pool;
+	struct threadPoolTask tasks[6];
+	struct nestedRun nested;
+	struct linkedList inner;
+	void* arguments[2];
+	long counter = 0;
+	long value;
+	int index;
+
+	CPPUNIT_ASSERT_MESSAGE("Initialization failed.", tp_init(&pool, 2)==true);
+	nested.pool = &pool;
+	nested.counter = &counter;
+	for (index = 0; index < 6; index++) {
+		tasks[index].function = nestedRunTask;
+		tasks[index].argument = &nested;
+	}
+	CPPUNIT_ASSERT_MESSAGE("Nested run failed.", tp_run(&pool, tasks, 6)==true);
+	CPPUNIT_ASSERT_MESSAGE("Nested tasks lost or repeated.", counter==48);
+	tp_destroy(&pool);
+
+	// Every element of the outer list walks the inner list on the shared pool again.
+	ll_init(&inner);
+	for (value = 1; value <= 100; value++) {
+		ll_add(&inner, &value, sizeof(value));
+		ll_add(&myList, &value, sizeof(value));
+	}
+	counter = 0;
+	arguments[0] = &inner;
+	arguments[1] = &counter;
+	CPPUNIT_ASSERT_MESSAGE("Nested walk failed.", ll_parallelForEach(&myList, nestedForEach, arguments, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Nested walk lost elements.", counter==(100 * 5050));
+	ll_clear(&inner);
+}
+
+/**
+ * This function doubles the long stored in an element.
+ * @param data This is a pointer to the long.
+ * @param size This is the size of the element.
+ * @param context This is unused.
+ */
+static void doubleElement(void* data, ll_size_t size, void* context) {
+	*(long*)data *= 2;
+}
+
+/**
+ * This method verifies that the parallel for each visits every element exactly once.
+ */
+void LinkedListTestCase::testParallelForEach() {
+	struct linkedListIterator* iter;
+	long expected = 0;
+	bool correct = true;
+	long value;
+
+	CPPUNIT_ASSERT_MESSAGE("Invalid list parameter",
+			ll_parallelForEach(NULL, doubleElement, NULL, 4)==false);
+	CPPUNIT_ASSERT_MESSAGE("Empty list failed.",
+			ll_parallelForEach(&myList, doubleElement, NULL, 4)==true);
+
+	for (value = 0; value < 1001; value++) {
+		ll_add(&myList, &value, sizeof(value));
+	}
+	CPPUNIT_ASSERT_MESSAGE("For each failed.",
+			ll_parallelForEach(&myList, doubleElement, NULL, 4)==true);
+	CPPUNIT_ASSERT_MESSAGE("For each with one thread failed.",
+			ll_parallelForEach(&myList, doubleElement, NULL, 1)==true);
+
+	iter = ll_getIterator(&myList);
+	while (ll_hasNext(iter)) {
+		correct = correct && (*(long*) ll_next(iter) == expected * 4);
+		expected++;
+	}
+	free(iter);
+	CPPUNIT_ASSERT_MESSAGE("Elements skipped or visited twice.", correct==true);
+}
+
+/**
+ * This function adds the long stored in an element to an accumulator.
+ * @param accumulator This is a pointer to the long accumulator.
+ * @param data This is a pointer to the long.
+ * @param size This is the size of the element.
+ * @param context This is unused.
+ */
+static void sumElement(void* accumulator, const void* data, ll_size_t size, void* context) {
+	*(long*)accumulator += *(const long*)data;
+}
+
+/**
+ * This function adds a partial sum to an accumulator.
+ * @param accumulator This is a pointer to the long accumulator.
+ * @param partial This is a pointer to the long partial sum.
+ * @param context This is unused.
+ */
+static void sumPartial(void* accumulator, const void* partial, void* context) {
+	*(long*)accumulator += *(const long*)partial;
+}
+
+/**
+ * This function appends the digit string of a partial result to an accumulator. The order of
+ * the calls matters, which shows that partial results are combined in list order.
+ * @param accumulator This is a pointer to the accumulated string.
+ * @param partial This is a pointer to the partial string.
+ * @param context This is unused.
+ */
+static void appendPartial(void* accumulator, const void* partial, void* context) {
+	strcat((char*)accumulator, (const char*)partial);
+}
+
+/**
+ * This function appends the character stored in an element to an accumulated string.
+ * @param accumulator This is a pointer to the accumulated string.
+ * @param data This is a pointer to the character.
+ * @param size This is the size of the element.
+ * @param context This is unused.
+ */
+static void appendElement(void* accumulator, const void* data, ll_size_t size, void* context) {
+	strncat((char*)accumulator, (const char*)data, 1);
+}
+
+/**
+ * This method verifies that the parallel reduce folds every element and combines the partial
+ * results in list order.
+ */
+void LinkedListTestCase::testParallelReduce() {
+	const char* digits = "0123456789abcdefghijklmnopqrstuvwxyz";
+	char text[64] = "";
+	long sum = 0;
+	long value;
+
+	for (value = 1; value <= 1000; value++) {
+		ll_add(&myList, &value, sizeof(value));
+	}
+	CPPUNIT_ASSERT_MESSAGE("Missing result accepted.",
+			ll_parallelReduce(&myList, sumElement, appendPartial, NULL, sizeof(sum), NULL, 4)==false);
+	CPPUNIT_ASSERT_MESSAGE("Reduce failed.",
+			ll_parallelReduce(&myList, sumElement, sumPartial, &sum, sizeof(sum), NULL, 4)==true);
+	CPPUNIT_ASSERT_MESSAGE("Sum incorrect.", sum==500500);
+
+	ll_clear(&myList);
+	for (value = 0; value < 36; value++) {
+		ll_add(&myList, &digits[value], 1);
+	}
+	CPPUNIT_ASSERT_MESSAGE("Reduce failed.",
+			ll_parallelReduce(&myList, appendElement, appendPartial, text, sizeof(text), NULL, 3)==true);
+	CPPUNIT_ASSERT_MESSAGE("Partial results combined out of order.", strcmp(text, digits)==0);
+}
+
+/**
+ * This method verifies that the vectorized search finds the first equal element across block
+ * boundaries and skips elements of a different size.
+ */
+void LinkedListTestCase::testFindEq() {
+	ll_size_t index = 0;
+	int32_t small;
+	int64_t large;
+
+	for (small = 0; small < 200; small++) {
+		ll_add(&myList, &small, sizeof(small));
+	}
+	large = 150;
+	ll_addIndex(&myList, &large, sizeof(large), 10);
+
+	small = 150;
+	CPPUNIT_ASSERT_MESSAGE("Element not found.", ll_findEq(&myList, &small, sizeof(small), &index)==true);
+	CPPUNIT_ASSERT_MESSAGE("Index incorrect.", index==151);
+	CPPUNIT_ASSERT_MESSAGE("Element of another size matched.",
+			ll_findEq(&myList, &large, sizeof(large), &index)==true && index==10);
+	small = 199;
+	CPPUNIT_ASSERT_MESSAGE("Last element not found.",
+			ll_findEq(&myList, &small, sizeof(small), &index)==true && index==200);
+	small = -1;
+	CPPUNIT_ASSERT_MESSAGE("Missing element found.", ll_findEq(&myList, &small, sizeof(small), NULL)==false);
+	CPPUNIT_ASSERT_MESSAGE("Unsupported key size accepted.", ll_findEq(&myList, &small, 2, NULL)==false);
+}
+
+/**
+ * This method verifies counting equal elements and finding the first greater element with
+ * signed keys of both sizes.
+ */
+void LinkedListTestCase::testCountAndFindFirstGreater() {
+	ll_size_t index = 0;
+	int64_t value;
+	int64_t key;
+
+	for (value = -100; value < 100; value++) {
+		int64_t element = value % 7;
+		ll_add(&myList, &element, sizeof(element));
+	}
+
+	key = 3;
+	CPPUNIT_ASSERT_MESSAGE("Count incorrect.", ll_count(&myList, &key, sizeof(key))==14);
+	key = -6;
+	CPPUNIT_ASSERT_MESSAGE("Count of negative key incorrect.", ll_count(&myList, &key, sizeof(key))==14);
+	key = 5;
+	CPPUNIT_ASSERT_MESSAGE("Greater element not found.",
+			ll_findFirstGreater(&myList, &key, sizeof(key), &index)==true);
+	CPPUNIT_ASSERT_MESSAGE("Greater index incorrect.", index==106);
+	key = 6;
+	CPPUNIT_ASSERT_MESSAGE("Greater than the maximum found.",
+			ll_findFirstGreater(&myList, &key, sizeof(key), NULL)==false);
+
+	ll_clear(&myList);
+	for (value = 0; value < 70; value++) {
+		int32_t element = (int32_t)(-value);
+		ll_add(&myList, &element, sizeof(element));
+	}
+	int32_t narrow = -65;
+	CPPUNIT_ASSERT_MESSAGE("Count of 4 byte key incorrect.", ll_count(&myList, &narrow, sizeof(narrow))==1);
+	CPPUNIT_ASSERT_MESSAGE("Greater 4 byte element not found.",
+			ll_findFirstGreater(&myList, &narrow, sizeof(narrow), &index)==true && index==0);
+}
+
+/**
+ * This method verifies that exporting packs the data of every element back to back and
+ * reports the offsets and the size needed.
+ */
+void LinkedListTestCase::testToArray() {
+	ll_size_t offsets[4];
+	ll_size_t total = 0;
+	char small[4];
+	char* packed;
+
+	CPPUNIT_ASSERT_MESSAGE("Empty list exported.", ll_toArray(&myList, NULL, 0, NULL, &total)==NULL);
+
+	ll_add(&myList, "ab", 2);
+	ll_add(&myList, "cde", 3);
+	ll_add(&myList, "f", 1);
+
+	CPPUNIT_ASSERT_MESSAGE("Export into a small buffer succeeded.",
+			ll_toArray(&myList, small, sizeof(small), NULL, &total)==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Needed size incorrect.", total==6);
+
+	packed = (char*)ll_toArray(&myList, NULL, 0, offsets, &total);
+	CPPUNIT_ASSERT_MESSAGE("Export failed.", packed!=NULL);
+	CPPUNIT_ASSERT_MESSAGE("Data incorrect.", memcmp(packed, "abcdef", 6)==0);
+	CPPUNIT_ASSERT_MESSAGE("Offsets incorrect.",
+			offsets[0]==0 && offsets[1]==2 && offsets[2]==5 && offsets[3]==6);
+	free(packed);
+}
+
+/**
+ * This method verifies that importing builds the same list that exporting came from, and that
+ * elements built from an array can be removed, taken, detached and moved like any other.
+ */
+void LinkedListTestCase::testFromArray() {
+	const ll_size_t offsets[4] = {0, 2, 5, 6};
+	const ll_size_t empty[3] = {0, 2, 2};
+	struct linkedList other;
+	int values[100];
+	int exported[100];
+	ll_size_t size = 0;
+	void* data;
+
+	for (int i = 0; i < 100; i++) {
+		values[i] = i * 3;
+	}
+
+	CPPUNIT_ASSERT_MESSAGE("Import failed.", ll_fromArray(&myList, values, NULL, 100, sizeof(int))==true);
+	CPPUNIT_ASSERT_MESSAGE("Size incorrect.", ll_size(&myList)==100);
+	CPPUNIT_ASSERT_MESSAGE("Element incorrect.", *(int*)ll_get(&myList, 57)==171);
+	CPPUNIT_ASSERT_MESSAGE("Neighbouring elements not stored back to back.",
+			(char*)ll_get(&myList, 1)==((char*)ll_get(&myList, 0) + sizeof(int)));
+	CPPUNIT_ASSERT_MESSAGE("Round trip changed the data.",
+			ll_toArray(&myList, exported, sizeof(exported), NULL, NULL)==exported &&
+			memcmp(values, exported, sizeof(values))==0);
+
+	CPPUNIT_ASSERT_MESSAGE("Remove failed.", ll_remove(&myList, 0)==true);
+	data = ll_take(&myList, 0, &size);
+	CPPUNIT_ASSERT_MESSAGE("Take incorrect.", data!=NULL && *(int*)data==3 && size==sizeof(int));
+	free(data);
+	data = ll_detach(&myList, 0, NULL);
+	CPPUNIT_ASSERT_MESSAGE("Detach incorrect.", data!=NULL && *(int*)data==6 && ll_get(&myList, 0)==data);
+
+	// Elements moved to another list keep their blocks alive after the first list is cleared.
+	ll_init(&other);
+	CPPUNIT_ASSERT_MESSAGE("Transfer failed.", ll_transfer(&other, &myList, 40)==40);
+	ll_clear(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Moved element damaged.", *(int*)ll_get(&other, 39)==123);
+	ll_clear(&other);
+	free(data);
+
+	CPPUNIT_ASSERT_MESSAGE("Empty element accepted.", ll_fromArray(&myList, "ab", empty, 2, 0)==false);
+	CPPUNIT_ASSERT_MESSAGE("List changed by a failed import.", ll_size(&myList)==0);
+	CPPUNIT_ASSERT_MESSAGE("Variable size import failed.", ll_fromArray(&myList, "abcdef", offsets, 3, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Variable size element incorrect.", memcmp(ll_get(&myList, 1), "cde", 3)==0);
+}
+
+/**
+ * This method verifies that small lists take their nodes from one contiguous block, fall back
+ * to separate nodes once the block is full, and that block nodes survive moving to another list.
+ */
+void LinkedListTestCase::testSmallListNodes() {
+	struct linkedList other;
+	int value;
+
+	ll_init(&other);
+	for (value = 0; value < 3; value++) {
+		ll_add(&myList, &value, sizeof(value));
+	}
+	CPPUNIT_ASSERT_MESSAGE("Single element list took a block.", (myList.head->flags & LL_NODE_SMALL)==0);
+	CPPUNIT_ASSERT_MESSAGE("Second node not taken from the block.", (myList.head->nextNode->flags & LL_NODE_SMALL)!=0);
+	CPPUNIT_ASSERT_MESSAGE("Block nodes not contiguous.", myList.head->nextNode + 1==myList.tail);
+
+	for (value = 3; value < 40; value++) {
+		ll_add(&myList, &value, sizeof(value));
+	}
+	CPPUNIT_ASSERT_MESSAGE("Node taken from a full block.", (myList.tail->flags & LL_NODE_SMALL)==0);
+
+	// Freed slots are handed out again as the list shrinks and grows
+	ll_remove(&myList, 1);
+	value = 40;
+	ll_add(&myList, &value, sizeof(value));
+	CPPUNIT_ASSERT_MESSAGE("Freed slot not reused.", (myList.tail->flags & LL_NODE_SMALL)!=0);
+	CPPUNIT_ASSERT_MESSAGE("Element incorrect.", *(int*)ll_get(&myList, 39)==40 && *(int*)ll_get(&myList, 1)==2);
+
+	// Nodes moved to another list keep the block alive after the first list is cleared
+	ll_transfer(&other, &myList, 10);
+	ll_clear(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Moved element incorrect.", *(int*)ll_get(&other, 9)==10);
+	CPPUNIT_ASSERT_MESSAGE("Cleared list kept its block.", myList.smallNodes==NULL);
+	ll_clear(&other);
+}
+
+/**
+ * This structure is an element type for the typed list test.
+ */
+struct point {
+	int x; // The horizontal coordinate
+	int y; // The vertical coordinate
+};
+
+LL_DEFINE_TYPED(ints, int)
+LL_DEFINE_TYPED(points, struct point)
+
+/**
+ * This method verifies that generated typed lists store elements by value and support the
+ * same operations as the generic list.
+ */
+void LinkedListTestCase::testTypedList() {
+	struct ints_list numbers;
+	struct points_list shapes;
+	struct ints_iterator iter;
+	struct point corner = {3, 4};
+	int expected = 0;
+
+	ints_init(&numbers);
+	for (int i = 1; i <= 5; i++) {
+		CPPUNIT_ASSERT_MESSAGE("Add failed.", ints_add(&numbers, i * 10)==true);
+	}
+	CPPUNIT_ASSERT_MESSAGE("Add at index failed.", ints_addIndex(&numbers, 5, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Out of range add allowed.", ints_addIndex(&numbers, 5, 7)==false);
+	CPPUNIT_ASSERT_MESSAGE("Size incorrect.", ints_size(&numbers)==6);
+	CPPUNIT_ASSERT_MESSAGE("Element incorrect.", *ints_get(&numbers, 0)==5 && *ints_get(&numbers, 4)==40);
+	CPPUNIT_ASSERT_MESSAGE("Remove failed.", ints_remove(&numbers, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Out of range get allowed.", ints_get(&numbers, 5)==NULL);
+
+	iter = ints_iter(&numbers);
+	while (ints_hasNext(&iter)) {
+		expected = expected + 10;
+		CPPUNIT_ASSERT_MESSAGE("Iteration order incorrect.", *ints_next(&iter)==expected);
+	}
+	CPPUNIT_ASSERT_MESSAGE("Iteration incomplete.", expected==50);
+	ints_clear(&numbers);
+	CPPUNIT_ASSERT_MESSAGE("Clear failed.", ints_size(&numbers)==0 && numbers.head==NULL);
+
+	points_init(&shapes);
+	points_add(&shapes, corner);
+	corner.x = 0;
+	CPPUNIT_ASSERT_MESSAGE("Element not stored by value.", points_get(&shapes, 0)->x==3);
+	points_get(&shapes, 0)->y = 9;
+	CPPUNIT_ASSERT_MESSAGE("Element not writable in place.", points_get(&shapes, 0)->y==9);
+	points_clear(&shapes);
+}
+
+/**
+ * This function orders two int elements.
+ * @param a This is a pointer to the first element.
+ * @param b This is a pointer to the second element.
+ * @return This returns less than, equal to or greater than 0 as a is less than, equal to or
+ *         greater than b.
+ */
+static int compareInts(const void* a, const void* b) {
+	int first = *(const int*)a;
+	int second = *(const int*)b;
+
+	return (first > second) - (first < second);
+}
+
+/**
+ * This method verifies that a sorted list keeps its elements in order, finds range starts and
+ * refuses positional inserts.
+ */
+void LinkedListTestCase::testSortedInsertAndLowerBound() {
+	struct linkedListIterator iter;
+	int previous = -1;
+	int value = 5;
+
+	CPPUNIT_ASSERT_MESSAGE("Insert into unsorted list allowed.", ll_insertSorted(&myList, &value, sizeof(value))==false);
+	CPPUNIT_ASSERT_MESSAGE("Sorted mode failed.", ll_setSorted(&myList, compareInts)==true);
+
+	// Insert a shuffled permutation of the even numbers below 4000, each twice
+	for (int i = 0; i < 4000; i++) {
+		value = ((i * 7919) % 2000) * 2;
+		CPPUNIT_ASSERT_MESSAGE("Sorted insert failed.", ll_insertSorted(&myList, &value, sizeof(value))==true);
+	}
+	CPPUNIT_ASSERT_MESSAGE("Size incorrect.", ll_size(&myList)==4000);
+	CPPUNIT_ASSERT_MESSAGE("Sorting mode changed on a full list.", ll_setSorted(&myList, NULL)==false);
+	CPPUNIT_ASSERT_MESSAGE("Positional add allowed.", ll_add(&myList, &value, sizeof(value))==false);
+	CPPUNIT_ASSERT_MESSAGE("Positional add allowed.", ll_addIndex(&myList, &value, sizeof(value), 0)==false);
+	CPPUNIT_ASSERT_MESSAGE("Push allowed.", ll_pushFront(&myList, &value, sizeof(value))==false);
+
+	iter.current = myList.head;
+	while (ll_hasNext(&iter)) {
+		value = *(int*)ll_next(&iter);
+		CPPUNIT_ASSERT_MESSAGE("Elements out of order.", value>=previous);
+		previous = value;
+	}
+
+	value = 1001;
+	CPPUNIT_ASSERT_MESSAGE("Lower bound not found.", ll_lowerBound(&myList, &value, &iter)==true);
+	CPPUNIT_ASSERT_MESSAGE("Lower bound incorrect.", *(int*)ll_next(&iter)==1002 && *(int*)ll_next(&iter)==1002);
+	CPPUNIT_ASSERT_MESSAGE("Range continues incorrectly.", *(int*)ll_next(&iter)==1004);
+	value = 0;
+	CPPUNIT_ASSERT_MESSAGE("First element not found.",
+			ll_lowerBound(&myList, &value, &iter)==true && iter.current==myList.head);
+	value = 3999;
+	CPPUNIT_ASSERT_MESSAGE("Bound past the end found.", ll_lowerBound(&myList, &value, &iter)==false);
+
+	ll_clear(&myList);
+	value = 3;
+	CPPUNIT_ASSERT_MESSAGE("Cleared list lost sorted mode.", ll_insertSorted(&myList, &value, sizeof(value))==true);
+	ll_clear(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Sorted mode not switched off.", ll_setSorted(&myList, NULL)==true && myList.sorted==NULL);
+}
+
+/**
+ * This method verifies that removing by value and by index keeps the skip index consistent.
+ */
+void LinkedListTestCase::testSortedRemove() {
+	struct linkedListIterator iter;
+	void* data;
+	int value;
+
+	ll_setSorted(&myList, compareInts);
+	for (int i = 0; i < 1000; i++) {
+		value = (i * 389) % 500;
+		ll_insertSorted(&myList, &value, sizeof(value));
+	}
+
+	value = 250;
+	CPPUNIT_ASSERT_MESSAGE("Remove by value failed.", ll_removeValue(&myList, &value)==true);
+	CPPUNIT_ASSERT_MESSAGE("Duplicate removed as well.", ll_lowerBound(&myList, &value, &iter)==true &&
+			*(int*)ll_next(&iter)==250 && *(int*)ll_next(&iter)==251);
+	CPPUNIT_ASSERT_MESSAGE("Remove by value failed.", ll_removeValue(&myList, &value)==true);
+	CPPUNIT_ASSERT_MESSAGE("Missing value removed.", ll_removeValue(&myList, &value)==false);
+
+	// Remove every element below 100 by index and take the largest elements from the back
+	for (int i = 0; i < 200; i++) {
+		CPPUNIT_ASSERT_MESSAGE("Remove by index failed.", ll_remove(&myList, 0)==true);
+	}
+	for (int i = 0; i < 10; i++) {
+		data = ll_popBack(&myList, NULL);
+		free(data);
+	}
+	CPPUNIT_ASSERT_MESSAGE("Size incorrect.", ll_size(&myList)==788);
+
+	for (value = 0; value < 500; value++) {
+		bool found = ll_lowerBound(&myList, &value, &iter);
+		int expected = (value < 100) ? 100 : ((value == 250) ? 251 : value);
+
+		if (value < 495) {
+			CPPUNIT_ASSERT_MESSAGE("Lower bound incorrect after removals.", found && *(int*)ll_next(&iter)==expected);
+		}
+		else {
+			CPPUNIT_ASSERT_MESSAGE("Removed element still indexed.", found==false);
+		}
+	}
+
+	ll_clear(&myList);
+	ll_setSorted(&myList, NULL);
+}
+
+/**
+ * This method verifies that merging a builder into a list that cannot receive its elements
+ * moves nothing and keeps every element in the shards.
+ */
+void LinkedListTestCase::testShardedBuilderRejectsSortedList() {
+	struct shardedBuilder builder;
+	int value;
+
+	sb_init(&builder, 2);
+	for (value = 0; value < 10; value++) {
+		sb_addSequenced(&builder, value % 2, value, &value, sizeof(value));
+	}
+
+	ll_setSorted(&myList, compareInts);
+	CPPUNIT_ASSERT_MESSAGE("Sequence merge into a sorted list moved elements.",
+			sb_merge(&builder, &myList, SB_ORDER_SEQUENCE)==0);
+	CPPUNIT_ASSERT_MESSAGE("Merge into a sorted list moved elements.",
+			sb_merge(&builder, &myList, SB_ORDER_ARBITRARY)==0);
+	CPPUNIT_ASSERT_MESSAGE("Merge into a shard moved elements.",
+			sb_merge(&builder, &builder.shards[0].list, SB_ORDER_ARBITRARY)==0);
+	CPPUNIT_ASSERT_MESSAGE("Sorted list changed.", ll_size(&myList)==0);
+	ll_setSorted(&myList, NULL);
+
+	// The shards still hold every element in sequence order.
+	CPPUNIT_ASSERT_MESSAGE("Elements lost by the rejected merges.",
+			sb_merge(&builder, &myList, SB_ORDER_SEQUENCE)==10);
+	for (value = 0; value < 10; value++) {
+		CPPUNIT_ASSERT_MESSAGE("Elements out of order.", *(int*)ll_get(&myList, value)==value);
+	}
+	sb_destroy(&builder);
+}
+
+/**
+ * This method verifies that a reverse iterator walks the list from the tail to the head and
+ * can change direction.
+ */
+void LinkedListTestCase::testReverseIterator() {
+	const char* expected[] = {"Quarter", "Fall", "Systems", "Operating", "CS3841"};
+	struct linkedListIterator* iter;
+	int i = 0;
+
+	CPPUNIT_ASSERT_MESSAGE("Invalid list parameter", ll_getReverseIterator(NULL)==NULL);
+	iter = ll_getReverseIterator(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Empty list has a previous element.", ll_hasPrev(iter)==false && ll_prev(iter)==NULL);
+	free(iter);
+
+	setupBasicList();
+	iter = ll_getReverseIterator(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Reverse iterator has a next element.", ll_hasNext(iter)==false);
+	while (ll_hasPrev(iter)) {
+		CPPUNIT_ASSERT_MESSAGE("Reverse order incorrect.", strcmp((char*)ll_prev(iter), expected[i])==0);
+		i++;
+	}
+	CPPUNIT_ASSERT_MESSAGE("Reverse walk incomplete.", i==5);
+
+	// Turn around at the front and walk forwards again
+	CPPUNIT_ASSERT_MESSAGE("Turn around incorrect.", strcmp((char*)ll_next(iter), "CS3841")==0);
+	CPPUNIT_ASSERT_MESSAGE("Turn around incorrect.", strcmp((char*)ll_prev(iter), "CS3841")==0);
+	free(iter);
+}
+
+/**
+ * This method verifies that iterators can start at an index and move by several elements.
+ */
+void LinkedListTestCase::testIteratorAtAndAdvance() {
+	struct linkedListIterator* iter;
+	int value;
+
+	for (value = 0; value < 100; value++) {
+		ll_add(&myList, &value, sizeof(value));
+	}
+
+	CPPUNIT_ASSERT_MESSAGE("Out of range iterator created.", ll_getIteratorAt(&myList, 101)==NULL);
+
+	iter = ll_getIteratorAt(&myList, 80);
+	CPPUNIT_ASSERT_MESSAGE("Seek from the tail incorrect.", *(int*)ll_next(iter)==80);
+	CPPUNIT_ASSERT_MESSAGE("Previous after seek incorrect.", *(int*)ll_prev(iter)==80 && *(int*)ll_prev(iter)==79);
+	free(iter);
+
+	iter = ll_getIteratorAt(&myList, 10);
+	CPPUNIT_ASSERT_MESSAGE("Seek from the head incorrect.", *(int*)ll_prev(iter)==9);
+	CPPUNIT_ASSERT_MESSAGE("Advance incorrect.", ll_advance(iter, 25)==25 && *(int*)ll_next(iter)==34);
+	CPPUNIT_ASSERT_MESSAGE("Retreat incorrect.", ll_retreat(iter, 5)==5 && *(int*)ll_prev(iter)==29);
+	CPPUNIT_ASSERT_MESSAGE("Advance past the end incorrect.", ll_advance(iter, 500)==71 && ll_hasNext(iter)==false);
+	CPPUNIT_ASSERT_MESSAGE("Retreat past the front incorrect.", ll_retreat(iter, 500)==100 && ll_hasPrev(iter)==false);
+	CPPUNIT_ASSERT_MESSAGE("Front element incorrect.", *(int*)ll_next(iter)==0);
+	free(iter);
+
+	iter = ll_getIteratorAt(&myList, 100);
+	CPPUNIT_ASSERT_MESSAGE("End iterator incorrect.", ll_hasNext(iter)==false && *(int*)ll_prev(iter)==99);
+	free(iter);
+}
+
+/**
+ * This method verifies that nodes freed to the pool are reused and that trimming gives them
+ * back to the system.
+ */
+void LinkedListTestCase::testNodePoolReuse() {
+	struct nodePoolStats before;
+	struct nodePoolStats after;
+	int value = 7;
+
+	np_trim();
+	for (int i = 0; i < 1000; i++) {
+		ll_add(&myList, &value, sizeof(value));
+	}
+	ll_clear(&myList);
+
+	np_stats(&before);
+	for (int i = 0; i < 1000; i++) {
+		ll_add(&myList, &value, sizeof(value));
+	}
+	np_stats(&after);
+	CPPUNIT_ASSERT_MESSAGE("Freed nodes not reused.", after.systemAllocations==before.systemAllocations);
+	CPPUNIT_ASSERT_MESSAGE("Pooled node not flagged.", (myList.tail->flags & LL_NODE_POOLED)!=0);
+
+	ll_clear(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Trim gave nothing back.", np_trim()>=984);
+	np_stats(&after);
+	CPPUNIT_ASSERT_MESSAGE("Depot not empty after trim.", after.depotNodes==0);
+	CPPUNIT_ASSERT_MESSAGE("Invalid stats parameter", np_stats(NULL)==false);
+}
+
+/**
+ * This function clears the list it is given, freeing the nodes on the calling thread.
+ * @param argument This is a pointer to the list.
+ * @return This always returns NULL.
+ */
+static void* clearList(void* argument) {
+	ll_clear((struct linkedList*)argument);
+	return NULL;
+}
+
+/**
+ * This method verifies that nodes freed on another thread reach the depot when that thread
+ * exits and are then reused by the allocating thread.
+ */
+void LinkedListTestCase::testNodePoolAcrossThreads() {
+	struct nodePoolStats before;
+	struct nodePoolStats after;
+	pthread_t thread;
+	int value = 7;
+
+	np_trim();
+	for (int i = 0; i < 1000; i++) {
+		ll_add(&myList, &value, sizeof(value));
+	}
+	pthread_create(&thread, NULL, clearList, &myList);
+	pthread_join(thread, NULL);
+
+	np_stats(&before);
+	CPPUNIT_ASSERT_MESSAGE("Exiting thread kept its nodes.", before.depotNodes>=984);
+	for (int i = 0; i < 1000; i++) {
+		ll_add(&myList, &value, sizeof(value));
+	}
+	np_stats(&after);
+	CPPUNIT_ASSERT_MESSAGE("Nodes from the depot not reused.", after.systemAllocations==before.systemAllocations);
+	ll_clear(&myList);
+	np_trim();
+}
+
+/**
+ * This method verifies that an interning list stores equal payloads once and frees a shared
+ * payload when the last element using it is removed.
+ */
+void LinkedListTestCase::testInterningSharesPayloads() {
+	struct internStats stats;
+	struct linkedList other;
+	int values[] = {4, 9, 4, 4, 9, 1};
+	ll_size_t size = 0;
+
+	CPPUNIT_ASSERT_MESSAGE("Interning enabled without being asked.", ll_internStats(&myList, &stats)==false);
+	CPPUNIT_ASSERT_MESSAGE("Interning not enabled.", ll_setInterning(&myList, true)==true);
+	CPPUNIT_ASSERT_MESSAGE("Concurrent readers allowed with interning.", ll_setConcurrentReaders(&myList, true)==false);
+	for (int i = 0; i < 6; i++) {
+		ll_add(&myList, &values[i], sizeof(int));
+	}
+	CPPUNIT_ASSERT_MESSAGE("Equal payloads not shared.", ll_get(&myList, 0)==ll_get(&myList, 3));
+	CPPUNIT_ASSERT_MESSAGE("Different payloads shared.", ll_get(&myList, 0)!=ll_get(&myList, 1));
+	CPPUNIT_ASSERT_MESSAGE("Interning changed the order.", *(int*)ll_get(&myList, 4)==9);
+
+	ll_internStats(&myList, &stats);
+	CPPUNIT_ASSERT_MESSAGE("Wrong number of unique payloads.", stats.uniquePayloads==3);
+	CPPUNIT_ASSERT_MESSAGE("Wrong number of references.", stats.references==6);
+	CPPUNIT_ASSERT_MESSAGE("Wrong logical bytes.", stats.logicalBytes==6*sizeof(int));
+	CPPUNIT_ASSERT_MESSAGE("Wrong stored bytes.", stats.storedBytes==3*sizeof(int));
+
+	int* taken = (int*)ll_take(&myList, 5, &size);
+	CPPUNIT_ASSERT_MESSAGE("Taken data wrong.", (*taken==1) && (size==sizeof(int)));
+	free(taken);
+	ll_remove(&myList, 1);
+	ll_internStats(&myList, &stats);
+	CPPUNIT_ASSERT_MESSAGE("Unused payloads not freed.", (stats.uniquePayloads==2) && (stats.references==4));
+
+	ll_init(&other);
+	CPPUNIT_ASSERT_MESSAGE("Transfer out of an interning list allowed.", ll_transfer(&other, &myList, 1)==0);
+	CPPUNIT_ASSERT_MESSAGE("Mode changed on a non-empty list.", ll_setInterning(&myList, false)==false);
+	ll_clear(&myList);
+	ll_internStats(&myList, &stats);
+	CPPUNIT_ASSERT_MESSAGE("Clear left payloads behind.", (stats.uniquePayloads==0) && (stats.storedBytes==0));
+	CPPUNIT_ASSERT_MESSAGE("Interning not disabled.", ll_setInterning(&myList, false)==true);
+}
+
+/**
+ * This method verifies that elements added with ll_fromArray or moved in with ll_transfer are
+ * interned like elements added with ll_add.
+ */
+void LinkedListTestCase::testInterningImportsAndTransfers() {
+	struct internStats stats;
+	struct linkedList other;
+	int values[1000];
+	int value = 7;
+
+	ll_setInterning(&myList, true);
+	for (int i = 0; i < 1000; i++) {
+		values[i] = value;
+	}
+	CPPUNIT_ASSERT_MESSAGE("Import failed.", ll_fromArray(&myList, values, NULL, 1000, sizeof(int))==true);
+	for (int i = 0; i < 1000; i++) {
+		ll_add(&myList, &value, sizeof(value));
+	}
+	ll_internStats(&myList, &stats);
+	CPPUNIT_ASSERT_MESSAGE("Imported payloads not shared.", (stats.uniquePayloads==1) && (stats.references==2000));
+	CPPUNIT_ASSERT_MESSAGE("Wrong logical bytes after import.", stats.logicalBytes==2000*sizeof(int));
+	CPPUNIT_ASSERT_MESSAGE("Imported payload not the shared one.", ll_get(&myList, 0)==ll_get(&myList, 1999));
+
+	// Copies moved in from a plain list join the table, owned data keeps its own copy.
+	ll_init(&other);
+	ll_add(&other, &value, sizeof(value));
+	value = 8;
+	ll_add(&other, &value, sizeof(value));
+	ll_addOwned(&other, malloc(sizeof(int)), sizeof(int));
+	CPPUNIT_ASSERT_MESSAGE("Transfer into an interning list failed.", ll_transfer(&myList, &other, 3)==3);
+	ll_internStats(&myList, &stats);
+	CPPUNIT_ASSERT_MESSAGE("Moved payloads not shared.", (stats.uniquePayloads==2) && (stats.references==2002));
+	CPPUNIT_ASSERT_MESSAGE("Moved payload not the shared one.", ll_get(&myList, 0)==ll_get(&myList, 2000));
+	CPPUNIT_ASSERT_MESSAGE("Moved data changed.", *(int*)ll_get(&myList, 2001)==8);
+
+	ll_clear(&myList);
+	ll_internStats(&myList, &stats);
+	CPPUNIT_ASSERT_MESSAGE("Clear left payloads behind.", (stats.uniquePayloads==0) && (stats.references==0));
+	ll_setInterning(&myList, false);
+}
+
+/**
+ * This method verifies that writing through ll_getMutable and detaching an element leave the
+ * other elements sharing the payload unchanged.
+ */
+void LinkedListTestCase::testInterningCopyOnWrite() {
+	struct internStats stats;
+	int value = 12;
+
+	ll_setInterning(&myList, true);
+	for (int i = 0; i < 4; i++) {
+		ll_add(&myList, &value, sizeof(value));
+	}
+
+	int* mutableValue = (int*)ll_getMutable(&myList, 1);
+	*mutableValue = 13;
+	CPPUNIT_ASSERT_MESSAGE("Write did not reach the element.", *(int*)ll_get(&myList, 1)==13);
+	CPPUNIT_ASSERT_MESSAGE("Write reached a sharing element.", *(int*)ll_get(&myList, 0)==12);
+	CPPUNIT_ASSERT_MESSAGE("Private data returned twice differently.", ll_getMutable(&myList, 1)==mutableValue);
+
+	int* detached = (int*)ll_detach(&myList, 2, NULL);
+	*detached = 14;
+	CPPUNIT_ASSERT_MESSAGE("Detached data still shared.", *(int*)ll_get(&myList, 3)==12);
+	ll_internStats(&myList, &stats);
+	CPPUNIT_ASSERT_MESSAGE("Unshared elements still counted.", (stats.references==2) && (stats.uniquePayloads==1));
+	CPPUNIT_ASSERT_MESSAGE("Invalid index.", ll_getMutable(&myList, 4)==NULL);
+
+	ll_clear(&myList);
+	free(detached);
+	ll_setInterning(&myList, false);
+}
+
+/**
+ * This method verifies that a deferred clear and range removal leave the list usable at once
+ * and free the removed data only when the reclaim queue is stepped.
+ */
+void LinkedListTestCase::testDeferredReclaim() {
+	int value;
+
+	destructorCalls = 0;
+	ll_setPayloadDestructor(&myList, countingDestructor);
+	CPPUNIT_ASSERT_MESSAGE("Invalid list parameter.", ll_setDeferredReclaim(NULL, true)==false);
+	CPPUNIT_ASSERT_MESSAGE("Deferred reclamation not enabled.", ll_setDeferredReclaim(&myList, true)==true);
+	for (int i = 0; i < 100; i++) {
+		int* owned = (int*)malloc(sizeof(int));
+		*owned = i;
+		ll_addOwned(&myList, owned, sizeof(int));
+	}
+
+	CPPUNIT_ASSERT_MESSAGE("Range not removed.", ll_removeRange(&myList, 10, 20)==20);
+	CPPUNIT_ASSERT_MESSAGE("Wrong size after range removal.", ll_size(&myList)==80);
+	CPPUNIT_ASSERT_MESSAGE("Wrong element after the range.", *(int*)ll_get(&myList, 10)==30);
+	CPPUNIT_ASSERT_MESSAGE("Range clamped wrongly.", ll_removeRange(&myList, 70, 50)==10);
+	CPPUNIT_ASSERT_MESSAGE("Wrong tail after range removal.", *(int*)ll_peekBack(&myList, NULL)==89);
+	CPPUNIT_ASSERT_MESSAGE("Out of range removal.", ll_removeRange(&myList, 70, 1)==0);
+
+	ll_clear(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Clear did not empty the list.", (ll_size(&myList)==0) && (myList.head==NULL));
+	CPPUNIT_ASSERT_MESSAGE("Data freed before the queue was stepped.", destructorCalls==0);
+
+	value = 5;
+	ll_add(&myList, &value, sizeof(value));
+	CPPUNIT_ASSERT_MESSAGE("List not usable after clear.", *(int*)ll_get(&myList, 0)==5);
+
+	CPPUNIT_ASSERT_MESSAGE("Budget not respected.", ll_reclaimStep(15)==15);
+	CPPUNIT_ASSERT_MESSAGE("Data freed past the budget.", destructorCalls==15);
+	CPPUNIT_ASSERT_MESSAGE("Queue not drained.", ll_reclaimStep(1000)==85);
+	CPPUNIT_ASSERT_MESSAGE("Owned data not freed.", destructorCalls==100);
+	CPPUNIT_ASSERT_MESSAGE("Queue not empty.", ll_reclaimStep(1000)==0);
+
+	ll_setDeferredReclaim(&myList, false);
+	ll_setPayloadDestructor(&myList, NULL);
+}
+
+/**
+ * This method verifies that the background reclaimer frees deferred clears of sorted and
+ * interning lists, and that stopping it drains the queue.
+ */
+void LinkedListTestCase::testBackgroundReclaimer() {
+	struct internStats stats;
+	struct linkedList sorted;
+
+	ll_init(&sorted);
+	ll_setSorted(&sorted, compareInts);
+	ll_setDeferredReclaim(&sorted, true);
+	ll_setInterning(&myList, true);
+	ll_setDeferredReclaim(&myList, true);
+	for (int i = 0; i < 1000; i++) {
+		int value = i % 10;
+		ll_insertSorted(&sorted, &i, sizeof(i));
+		ll_add(&myList, &value, sizeof(value));
+	}
+
+	CPPUNIT_ASSERT_MESSAGE("Reclaimer not started.", ll_startReclaimer()==true);
+	CPPUNIT_ASSERT_MESSAGE("Second start failed.", ll_startReclaimer()==true);
+	ll_clear(&sorted);
+	ll_clear(&myList);
+	ll_internStats(&myList, &stats);
+	CPPUNIT_ASSERT_MESSAGE("Cleared list kept shared payloads.", (stats.uniquePayloads==0) && (stats.references==0));
+
+	int key = 3;
+	ll_insertSorted(&sorted, &key, sizeof(key));
+	ll_add(&myList, &key, sizeof(key));
+	struct linkedListIterator iter;
+	CPPUNIT_ASSERT_MESSAGE("Sorted list not usable after clear.", ll_lowerBound(&sorted, &key, &iter)==true);
+	CPPUNIT_ASSERT_MESSAGE("Interning list not usable after clear.", *(int*)ll_get(&myList, 0)==3);
+
+	ll_stopReclaimer();
+	CPPUNIT_ASSERT_MESSAGE("Queue not drained by the reclaimer.", ll_reclaimStep(1000)==0);
+
+	ll_setDeferredReclaim(&sorted, false);
+	ll_setDeferredReclaim(&myList, false);
+	ll_clear(&sorted);
+	ll_setSorted(&sorted, NULL);
+	ll_clear(&myList);
+	ll_setInterning(&myList, false);
+}
+
+/**
+ * This method verifies that a committed batch leaves the list exactly as the same operations
+ * applied one by one with ll_addIndex and ll_remove.
+ */
+void LinkedListTestCase::testBatchMatchesSequentialOperations() {
+	struct linkedList expected;
+	unsigned int seed = 11;
+
+	ll_init(&expected);
+	for (int i = 0; i < 200; i++) {
+		ll_add(&myList, &i, sizeof(i));
+		ll_add(&expected, &i, sizeof(i));
+	}
+
+	struct listBatch* batch = ll_batchBegin(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Invalid list parameter.", ll_batchBegin(NULL)==NULL);
+	for (int op = 0; op < 500; op++) {
+		uint32_t size = ll_size(&expected);
+		int value = 1000 + op;
+
+		seed = seed * 1103515245u + 12345u;
+		if (((seed >> 16) % 3) == 0) {
+			uint32_t index = (seed >> 4) % (size + 1);
+			CPPUNIT_ASSERT_MESSAGE("Insertion not queued.", ll_batchAddIndex(batch, &value, sizeof(value), index)==true);
+			ll_addIndex(&expected, &value, sizeof(value), index);
+		}
+		else if (size != 0) {
+			uint32_t index = (seed >> 4) % size;
+			CPPUNIT_ASSERT_MESSAGE("Removal not queued.", ll_batchRemove(batch, index)==true);
+			ll_remove(&expected, index);
+		}
+	}
+	CPPUNIT_ASSERT_MESSAGE("Out of range insertion queued.",
+			ll_batchAddIndex(batch, &seed, sizeof(seed), ll_size(&expected) + 1)==false);
+	CPPUNIT_ASSERT_MESSAGE("Out of range removal queued.", ll_batchRemove(batch, ll_size(&expected))==false);
+	CPPUNIT_ASSERT_MESSAGE("List changed before commit.", ll_size(&myList)==200);
+	CPPUNIT_ASSERT_MESSAGE("Commit failed.", ll_batchCommit(batch)==true);
+
+	CPPUNIT_ASSERT_MESSAGE("Wrong size after commit.", ll_size(&myList)==ll_size(&expected));
+	struct linkedListIterator* iter = ll_getReverseIterator(&myList);
+	for (uint32_t i = ll_size(&expected); i > 0; i--) {
+		CPPUNIT_ASSERT_MESSAGE("Wrong element after commit.", *(int*)ll_prev(iter)==*(int*)ll_get(&expected, i - 1));
+	}
+	free(iter);
+	ll_clear(&expected);
+}
+
+/**
+ * This method verifies that a batch can empty a list and build it again, and that cancelling
+ * a batch leaves the list untouched.
+ */
+void LinkedListTestCase::testBatchEmptyAndCancel() {
+	int values[] = {1, 2, 3};
+
+	ll_add(&myList, &values[0], sizeof(int));
+	ll_add(&myList, &values[1], sizeof(int));
+
+	struct listBatch* batch = ll_batchBegin(&myList);
+	ll_batchRemove(batch, 0);
+	ll_batchRemove(batch, 0);
+	ll_batchAddIndex(batch, &values[2], sizeof(int), 0);
+	ll_batchAddIndex(batch, &values[0], sizeof(int), 1);
+	ll_batchRemove(batch, 1);
+	ll_batchAddIndex(batch, &values[1], sizeof(int), 0);
+	ll_batchCommit(batch);
+	CPPUNIT_ASSERT_MESSAGE("Wrong size after rebuild.", ll_size(&myList)==2);
+	CPPUNIT_ASSERT_MESSAGE("Wrong head after rebuild.", *(int*)ll_get(&myList, 0)==2);
+	CPPUNIT_ASSERT_MESSAGE("Wrong tail after rebuild.", *(int*)myList.tail->data==3);
+
+	batch = ll_batchBegin(&myList);
+	ll_batchRemove(batch, 1);
+	ll_batchAddIndex(batch, &values[0], sizeof(int), 0);
+	ll_batchCancel(batch);
+	CPPUNIT_ASSERT_MESSAGE("Cancel changed the list.", (ll_size(&myList)==2) && (*(int*)ll_get(&myList, 1)==3));
+	CPPUNIT_ASSERT_MESSAGE("Invalid batch parameter.", ll_batchCommit(NULL)==false);
+}
+
+/**
+ * This method verifies that views of a list work with the standard range adaptors, see the
+ * elements in list order in both directions and give write access to the elements.
+ */
+void LinkedListTestCase::testRangePipeline() {
+	for (int i = 0; i < 20; i++) {
+		ll_add(&myList, &i, sizeof(int));
+	}
+
+	int expected[] = {0, 4, 16, 36};
+	int count = 0;
+	for (int value : ll::view<int>(myList) | std::views::filter([](int v) { return (v % 2) == 0; })
+			| std::views::transform([](int v) { return v * v; }) | std::views::take(4)) {
+		CPPUNIT_ASSERT_MESSAGE("Wrong element from pipeline.", value==expected[count]);
+		count++;
+	}
+	CPPUNIT_ASSERT_MESSAGE("Wrong element count from pipeline.", count==4);
+
+	auto reversed = ll::view<int>(myList) | std::views::reverse;
+	CPPUNIT_ASSERT_MESSAGE("Wrong element from reverse view.", *reversed.begin()==19);
+	CPPUNIT_ASSERT_MESSAGE("Wrong view size.", ll::view<int>(myList).size()==20);
+
+	for (int& value : myList | ll::as<int>) {
+		value += 100;
+	}
+	CPPUNIT_ASSERT_MESSAGE("Element not written through view.", *(int*)ll_get(&myList, 5)==105);
+
+	size_t bytes = 0;
+	for (ll::element element : ll::elements(myList)) {
+		bytes += element.size;
+	}
+	CPPUNIT_ASSERT_MESSAGE("Wrong element sizes from view.", bytes==20 * sizeof(int));
+	CPPUNIT_ASSERT_MESSAGE("Filled list empty as view.", ll::view<int>(myList).empty()==false);
+}
+
+/**
+ * This method verifies that a pipeline only reads the elements it needs to produce the
+ * elements taken from it.
+ */
+void LinkedListTestCase::testRangeStopsEarly() {
+	for (int i = 0; i < 1000; i++) {
+		ll_add(&myList, &i, sizeof(int));
+	}
+
+	int calls = 0;
+	int sum = 0;
+	for (int value : ll::view<int>(myList) | std::views::filter([&calls](int v) { calls++; return (v % 2) == 0; })
+			| std::views::take(3)) {
+		sum += value;
+	}
+	CPPUNIT_ASSERT_MESSAGE("Wrong sum from pipeline.", sum==6);
+	CPPUNIT_ASSERT_MESSAGE("Pipeline read past the elements it needed.", calls <= 7);
+
+	linkedList empty;
+	ll_init(&empty);
+	CPPUNIT_ASSERT_MESSAGE("Empty list has elements as view.", ll::view<int>(empty).begin()==ll::view<int>(empty).end());
+}
+
+/**
+ * This method verifies that the memory counters of a list follow adds, removals and transfers,
+ * that the process counters move with them and that clearing a list brings them back to zero.
+ */
+void LinkedListTestCase::testMemoryUsageFollowsOperations() {
+	struct memoryUsage usage;
+	struct memoryUsage otherUsage;
+	struct memoryUsage before;
+	struct memoryUsage after;
+	linkedList other;
+	int borrowed = 7;
+
+	CPPUNIT_ASSERT_MESSAGE("Invalid list parameter.", ll_memoryUsage(NULL, &usage)==false);
+	CPPUNIT_ASSERT_MESSAGE("Invalid usage parameter.", ll_processMemoryUsage(NULL)==false);
+	ll_processMemoryUsage(&before);
+
+	for (int i = 0; i < 100; i++) {
+		ll_add(&myList, &i, sizeof(int));
+	}
+	ll_addBorrowed(&myList, &borrowed, sizeof(borrowed));
+	ll_memoryUsage(&myList, &usage);
+	CPPUNIT_ASSERT_MESSAGE("Wrong payload bytes.", usage.payloadBytes==100 * sizeof(int));
+	CPPUNIT_ASSERT_MESSAGE("Wrong node bytes.", usage.nodeBytes==101 * sizeof(struct listNode));
+	CPPUNIT_ASSERT_MESSAGE("Wrong borrowed bytes.", usage.borrowedBytes==sizeof(int));
+	CPPUNIT_ASSERT_MESSAGE("Allocated less than used.",
+			usage.allocatedBytes==(usage.payloadBytes + usage.nodeBytes + usage.indexBytes + usage.slackBytes));
+	CPPUNIT_ASSERT_MESSAGE("Wrong fragmentation.", (usage.fragmentation >= 0.0) && (usage.fragmentation < 1.0));
+
+	ll_processMemoryUsage(&after);
+	CPPUNIT_ASSERT_MESSAGE("Process payload bytes not updated.", after.payloadBytes - before.payloadBytes==usage.payloadBytes);
+	CPPUNIT_ASSERT_MESSAGE("Process allocated bytes not updated.", after.allocatedBytes - before.allocatedBytes==usage.allocatedBytes);
+
+	ll_remove(&myList, 0);
+	ll_removeRange(&myList, 10, 10);
+	ll_memoryUsage(&myList, &usage);
+	CPPUNIT_ASSERT_MESSAGE("Removals not counted.", (usage.payloadBytes==89 * sizeof(int)) && (usage.nodeBytes==90 * sizeof(struct listNode)));
+
+	ll_init(&other);
+	ll_transfer(&other, &myList, 60);
+	ll_transfer(&other, &myList, 10);
+	ll_memoryUsage(&myList, &usage);
+	ll_memoryUsage(&other, &otherUsage);
+	CPPUNIT_ASSERT_MESSAGE("Transfers not counted.", (usage.payloadBytes==19 * sizeof(int)) && (usage.borrowedBytes==sizeof(int)) &&
+			(otherUsage.payloadBytes==70 * sizeof(int)) && (otherUsage.nodeBytes==70 * sizeof(struct listNode)));
+	ll_transfer(&other, &myList, 100);
+	ll_memoryUsage(&myList, &usage);
+	CPPUNIT_ASSERT_MESSAGE("Emptied list still charged.", (usage.nodeBytes==0) && (usage.allocatedBytes==0));
+
+	ll_detach(&other, 0, NULL);
+	ll_memoryUsage(&other, &otherUsage);
+	CPPUNIT_ASSERT_MESSAGE("Detached data still owned.", (otherUsage.payloadBytes==88 * sizeof(int)) && (otherUsage.borrowedBytes==2 * sizeof(int)));
+	free(ll_get(&other, 0));
+
+	ll_clear(&other);
+	ll_memoryUsage(&other, &otherUsage);
+	CPPUNIT_ASSERT_MESSAGE("Cleared list still charged.", (otherUsage.allocatedBytes==0) && (otherUsage.borrowedBytes==0));
+	ll_processMemoryUsage(&after);
+	CPPUNIT_ASSERT_MESSAGE("Process counters not back.", (after.allocatedBytes==before.allocatedBytes) && (after.nodeBytes==before.nodeBytes));
+}
+
+/**
+ * This method verifies that sorted, interning and deferred reclaim lists charge their
+ * bookkeeping and shared payloads, and give the charges back when cleared.
+ */
+void LinkedListTestCase::testMemoryUsageOfModes() {
+	struct memoryUsage usage;
+	int value = 3;
+
+	ll_setInterning(&myList, true);
+	ll_memoryUsage(&myList, &usage);
+	CPPUNIT_ASSERT_MESSAGE("Interning table not charged.", (usage.indexBytes > 0) && (usage.payloadBytes==0));
+	for (int i = 0; i < 50; i++) {
+		ll_add(&myList, &value, sizeof(value));
+	}
+	ll_memoryUsage(&myList, &usage);
+	CPPUNIT_ASSERT_MESSAGE("Shared payload not counted once.", usage.payloadBytes==sizeof(int));
+	ll_getMutable(&myList, 5);
+	ll_memoryUsage(&myList, &usage);
+	CPPUNIT_ASSERT_MESSAGE("Private copy not counted.", usage.payloadBytes==2 * sizeof(int));
+	ll_clear(&myList);
+	ll_setInterning(&myList, false);
+	ll_memoryUsage(&myList, &usage);
+	CPPUNIT_ASSERT_MESSAGE("Interning list still charged.", (usage.allocatedBytes==0) && (usage.indexBytes==0));
+
+	ll_setSorted(&myList, compareInts);
+	ll_setDeferredReclaim(&myList, true);
+	for (int i = 0; i < 200; i++) {
+		value = (i * 37) % 200;
+		ll_insertSorted(&myList, &value, sizeof(value));
+	}
+	ll_memoryUsage(&myList, &usage);
+	uint64_t indexed = usage.indexBytes;
+	value = 100;
+	ll_removeValue(&myList, &value);
+	ll_removeRange(&myList, 0, 50);
+	ll_memoryUsage(&myList, &usage);
+	CPPUNIT_ASSERT_MESSAGE("Removed towers still charged.", (usage.indexBytes < indexed) && (usage.payloadBytes==149 * sizeof(int)));
+	ll_clear(&myList);
+	ll_reclaimStep(10000);
+	ll_setSorted(&myList, NULL);
+	ll_setDeferredReclaim(&myList, false);
+	ll_memoryUsage(&myList, &usage);
+	CPPUNIT_ASSERT_MESSAGE("Sorted list still charged.", (usage.allocatedBytes==0) && (usage.indexBytes==0) && (usage.nodeBytes==0));
+}
+
+/**
+ * This method verifies that cold compression packs the interior of a list and leaves the hot
+ * window alone, that reading a packed element expands its segment, that touched elements skip
+ * one pass, and that removing packed elements frees their segments.
+ */
+void LinkedListTestCase::testColdCompressionRoundTrip() {
+	struct coldStats stats;
+	struct memoryUsage expanded;
+	struct memoryUsage usage;
+	ll_size_t size = 0;
+
+	CPPUNIT_ASSERT_MESSAGE("Invalid list parameter.", ll_setColdCompression(NULL, true, 0)==false);
+	CPPUNIT_ASSERT_MESSAGE("Stats read with compression off.", ll_coldStats(&myList, &stats)==false);
+	CPPUNIT_ASSERT_MESSAGE("Compression failed.", ll_setColdCompression(&myList, true, 10)==true);
+
+	// Small longs leave runs of zero bytes for the codec to find
+	for (long i = 0; i < 300; i++) {
+		ll_add(&myList, &i, sizeof(long));
+	}
+	ll_memoryUsage(&myList, &expanded);
+
+	CPPUNIT_ASSERT_MESSAGE("Wrong number packed.", ll_compressCold(&myList)==280);
+	ll_coldStats(&myList, &stats);
+	CPPUNIT_ASSERT_MESSAGE("Wrong stats after packing.", (stats.compressions==2) && (stats.packedElements==280) &&
+			(stats.rawBytes==280 * sizeof(long)) && (stats.compressedBytes < stats.rawBytes));
+	CPPUNIT_ASSERT_MESSAGE("Hot window packed.",
+			((myList.head->flags & LL_PAYLOAD_MASK)==LL_PAYLOAD_COPY) && ((myList.tail->flags & LL_PAYLOAD_MASK)==LL_PAYLOAD_COPY));
+	ll_memoryUsage(&myList, &usage);
+	CPPUNIT_ASSERT_MESSAGE("Packing saved no memory.", usage.payloadBytes < expanded.payloadBytes);
+	CPPUNIT_ASSERT_MESSAGE("Packed memory not accounted.",
+			usage.allocatedBytes==(usage.payloadBytes + usage.nodeBytes + usage.indexBytes + usage.slackBytes));
+
+	CPPUNIT_ASSERT_MESSAGE("Wrong packed element.", *(long*)ll_get(&myList, 150)==150);
+	ll_coldStats(&myList, &stats);
+	CPPUNIT_ASSERT_MESSAGE("Segment not expanded.", (stats.decompressions==1) && (stats.packedElements==24));
+
+	struct linkedListIterator* iter = ll_getIterator(&myList);
+	bool ordered = true;
+	for (int i = 0; ll_hasNext(iter); i++) {
+		ordered = ordered && (*(long*)ll_next(iter)==i);
+	}
+	free(iter);
+	ll_coldStats(&myList, &stats);
+	CPPUNIT_ASSERT_MESSAGE("Iteration read wrong data.", ordered && (stats.decompressions==2) && (stats.packedElements==0));
+
+	CPPUNIT_ASSERT_MESSAGE("Touched elements packed.", ll_compressCold(&myList)==0);
+	CPPUNIT_ASSERT_MESSAGE("Elements not packed on the next pass.", ll_compressCold(&myList)==280);
+
+	long* taken = (long*)ll_take(&myList, 100, &size);
+	ll_coldStats(&myList, &stats);
+	CPPUNIT_ASSERT_MESSAGE("Wrong data taken.", (*taken==100) && (size==sizeof(long)) && (stats.decompressions==2));
+	free(taken);
+
+	ll_removeRange(&myList, 10, 279);
+	ll_coldStats(&myList, &stats);
+	CPPUNIT_ASSERT_MESSAGE("Segments not freed.", (stats.packedElements==0) && (stats.compressedBytes==0) &&
+			(stats.decompressions==2) && (*(long*)ll_get(&myList, 10)==290));
+
+	ll_clear(&myList);
+	ll_setColdCompression(&myList, false, 0);
+	ll_memoryUsage(&myList, &usage);
+	CPPUNIT_ASSERT_MESSAGE("Cold list still charged.", (usage.allocatedBytes==0) && (usage.indexBytes==0));
+}
+
+/**
+ * This function walks a list and checks that element i holds the value i.
+ * @param argument This is a pointer to the list.
+ * @return This returns a non-NULL pointer if every element held the expected value.
+ */
+static void* coldReaderThread(void* argument) {
+	struct linkedListIterator* iter = ll_getIterator((struct linkedList*)argument);
+	bool ordered = true;
+
+	for (long i = 0; ll_hasNext(iter); i++) {
+		ordered = ordered && (*(long*)ll_next(iter)==i);
+	}
+	free(iter);
+
+	return ordered ? argument : NULL;
+}
+
+/**
+ * This method verifies that several threads can read a compressed list at once while the
+ * segments they touch are expanded.
+ */
+void LinkedListTestCase::testColdCompressionConcurrentReads() {
+	pthread_t threads[4];
+	struct coldStats stats;
+	bool ordered = true;
+
+	ll_setColdCompression(&myList, true, 10);
+	for (long i = 0; i < 2000; i++) {
+		ll_add(&myList, &i, sizeof(long));
+	}
+	ll_compressCold(&myList);
+
+	for (int i = 0; i < 4; i++) {
+		pthread_create(&threads[i], NULL, coldReaderThread, &myList);
+	}
+	for (int i = 0; i < 4; i++) {
+		void* result;
+		pthread_join(threads[i], &result);
+		ordered = ordered && (result != NULL);
+	}
+
+	ll_coldStats(&myList, &stats);
+	CPPUNIT_ASSERT_MESSAGE("Concurrent readers read wrong data.", ordered==true);
+	CPPUNIT_ASSERT_MESSAGE("Segments left packed or expanded twice.",
+			(stats.packedElements==0) && (stats.decompressions==stats.compressions));
+
+	ll_clear(&myList);
+	ll_setColdCompression(&myList, false, 0);
+}
+
+/**
+ * This method verifies that an element read through the list before its first compression pass
+ * stays expanded, while walking the list with an iterator leaves every element cold.
+ */
+void LinkedListTestCase::testColdCompressionSkipsReadElements() {
+	struct linkedListIterator* iter;
+
+	ll_setColdCompression(&myList, true, 0);
+	for (long i = 0; i < 100; i++) {
+		ll_add(&myList, &i, sizeof(long));
+	}
+
+	iter = ll_getIterator(&myList);
+	while (ll_hasNext(iter)) {
+		ll_next(iter);
+	}
+	free(iter);
+	CPPUNIT_ASSERT_MESSAGE("Read element not found.", *(long*)ll_get(&myList, 50)==50);
+
+	CPPUNIT_ASSERT_MESSAGE("Read element packed.", ll_compressCold(&myList)==99);
+	iter = ll_getIteratorAt(&myList, 50);
+	CPPUNIT_ASSERT_MESSAGE("Read element not kept expanded.", (iter->current->flags & LL_PAYLOAD_MASK)==LL_PAYLOAD_COPY);
+	free(iter);
+
+	ll_clear(&myList);
+	ll_setColdCompression(&myList, false, 0);
+}
+
+/**
+ * This method verifies that cold compression refuses modes that read nodes behind its back,
+ * that exporting and detaching packed elements sees their data, and that switching it off
+ * expands everything.
+ */
+void LinkedListTestCase::testColdCompressionModes() {
+	struct memoryUsage expanded;
+	struct memoryUsage usage;
+	struct coldStats stats;
+	ll_size_t offsets[101];
+	linkedList other;
+	ll_size_t size = 0;
+
+	ll_setConcurrentReaders(&myList, true);
+	CPPUNIT_ASSERT_MESSAGE("Compression allowed with readers.", ll_setColdCompression(&myList, true, 0)==false);
+	ll_setConcurrentReaders(&myList, false);
+
+	CPPUNIT_ASSERT_MESSAGE("Compression failed.", ll_setColdCompression(&myList, true, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Readers allowed with compression.", ll_setConcurrentReaders(&myList, true)==false);
+	CPPUNIT_ASSERT_MESSAGE("Sorting allowed with compression.", ll_setSorted(&myList, compareInts)==false);
+	CPPUNIT_ASSERT_MESSAGE("Deferred reclaim allowed with compression.", ll_setDeferredReclaim(&myList, true)==false);
+
+	for (int i = 0; i < 100; i++) {
+		ll_add(&myList, &i, sizeof(int));
+	}
+	ll_memoryUsage(&myList, &expanded);
+	ll_compressCold(&myList);
+
+	ll_init(&other);
+	CPPUNIT_ASSERT_MESSAGE("Packed elements transferred.", ll_transfer(&other, &myList, 10)==0);
+
+	int* exported = (int*)ll_toArray(&myList, NULL, 0, offsets, NULL);
+	CPPUNIT_ASSERT_MESSAGE("Wrong export.", (exported[0]==0) && (exported[99]==99) && (offsets[100]==100 * sizeof(int)));
+	free(exported);
+
+	ll_compressCold(&myList);
+	ll_compressCold(&myList);
+	int* detached = (int*)ll_detach(&myList, 42, &size);
+	CPPUNIT_ASSERT_MESSAGE("Wrong data detached.", (*detached==42) && (size==sizeof(int)));
+	free(detached);
+	ll_remove(&myList, 42);
+
+	ll_compressCold(&myList);
+	CPPUNIT_ASSERT_MESSAGE("Switching off failed.", ll_setColdCompression(&myList, false, 0)==true);
+	CPPUNIT_ASSERT_MESSAGE("Packed element left.", ((myList.head->nextNode->flags & LL_PAYLOAD_MASK)==LL_PAYLOAD_COPY) &&
+			(*(int*)ll_get(&myList, 50)==51));
+	ll_memoryUsage(&myList, &usage);
+	CPPUNIT_ASSERT_MESSAGE("Segments still charged.", (usage.indexBytes < expanded.indexBytes) &&
+			(usage.payloadBytes==99 * sizeof(int)) && (ll_coldStats(&myList, &stats)==false));
+}
+
+/**
+ * This function checks that two lists of ints hold the same elements in the same order.
+ * @param a This is a pointer to the first list.
+ * @param b This is a pointer to the second list.
+ * @return This returns true if the lists are equal.
+ */
+static bool sameInts(linkedList* a, linkedList* b) {
+	bool same = (ll_size(a)==ll_size(b));
+	struct linkedListIterator* first = ll_getIterator(a);
+	struct linkedListIterator* second = ll_getIterator(b);
+
+	while (same && ll_hasNext(first)) {
+		same = (*(int*)ll_next(first)==*(int*)ll_next(second));
+	}
+	free(first);
+	free(second);
+
+	return same;
+}
+
+/**
+ * This method verifies that deltas exported after each round of changes bring a replica to the
+ * state of the list, that a delta only holds the changes after the given sequence number, and
+ * that a clear stands in for every change before it.
+ */
+void LinkedListTestCase::testChangeDeltaReplicates() {
+	linkedList replica;
+	linkedList source;
+	uint64_t since = 0;
+	uint64_t applied = 0;
+	ll_size_t size = 0;
+	int value;
+
+	CPPUNIT_ASSERT_MESSAGE("Tracking failed.", ll_setChangeTracking(&myList, true)==true);
+	CPPUNIT_ASSERT_MESSAGE("Wrong sequence before any change.", ll_changeSequence(&myList)==0);
+	ll_init(&replica);
+
+	for (int i = 0; i < 20; i++) {
+		ll_add(&myList, &i, sizeof(int));
+	}
+	value = 100;
+	ll_addIndex(&myList, &value, sizeof(int), 5);
+	ll_pushFront(&myList, &value, sizeof(int));
+	ll_remove(&myList, 3);
+	free(ll_popBack(&myList, NULL));
+	free(ll_take(&myList, 7, NULL));
+	ll_removeRange(&myList, 2, 4);
+
+	void* delta = ll_exportDelta(&myList, since, NULL, 0, &size);
+	CPPUNIT_ASSERT_MESSAGE("Delta not exported.", (delta != NULL) && (ll_changeSequence(&myList)==26));
+	CPPUNIT_ASSERT_MESSAGE("Delta not applied.", ll_applyDelta(&replica, delta, size, &applied)==true);
+	CPPUNIT_ASSERT_MESSAGE("Replica differs.", (applied==26) && sameInts(&myList, &replica));
+	free(delta);
+	since = applied;
+
+	// Only the changes after the replica's sequence number are sent again
+	ll_init(&source);
+	for (int i = 0; i < 3; i++) {
+		ll_add(&source, &i, sizeof(int));
+	}
+	ll_transfer(&myList, &source, 3);
+	free(ll_popFront(&myList, NULL));
+	delta = ll_exportDelta(&myList, since, NULL, 0, &size);
+	ll_applyDelta(&replica, delta, size, &applied);
+	CPPUNIT_ASSERT_MESSAGE("Incremental delta wrong.", (applied==30) && sameInts(&myList, &replica));
+	free(delta);
+
+	// A replica that fell behind before a clear only needs the clear and what follows
+	ll_clear(&myList);
+	value = 7;
+	ll_add(&myList, &value, sizeof(int));
+	delta = ll_exportDelta(&myList, 10, NULL, 0, &size);
+	CPPUNIT_ASSERT_MESSAGE("Clear did not drop older changes.", (delta != NULL) && (size < 64));
+	ll_applyDelta(&replica, delta, size, &applied);
+	CPPUNIT_ASSERT_MESSAGE("Replica not cleared.", (applied==32) && sameInts(&myList, &replica));
+	CPPUNIT_ASSERT_MESSAGE("Clear applied twice.", ll_applyDelta(&replica, delta, size, &applied)==false);
+	free(delta);
+
+	ll_clear(&replica);
+	ll_setChangeTracking(&myList, false);
+	CPPUNIT_ASSERT_MESSAGE("Log kept after tracking was switched off.", ll_changeSequence(&myList)==0);
+}
+
+/**
+ * This method verifies that trimmed changes can no longer be exported, that damaged deltas are
+ * refused and report where the replica stands, that deltas applied twice or with a gap are
+ * refused, and that modes the log cannot follow are refused.
+ */
+void LinkedListTestCase::testChangeDeltaLimits() {
+	linkedList replica;
+	char buffer[16];
+	uint64_t applied = 0;
+	ll_size_t size = 0;
+
+	ll_setChangeTracking(&myList, true);
+	CPPUNIT_ASSERT_MESSAGE("Batch allowed while tracking.", ll_batchBegin(&myList)==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Sorting allowed while tracking.", ll_setSorted(&myList, compareInts)==false);
+
+	for (int i = 0; i < 10; i++) {
+		ll_add(&myList, &i, sizeof(int));
+	}
+	CPPUNIT_ASSERT_MESSAGE("Delta exported from the future.", ll_exportDelta(&myList, 11, NULL, 0, NULL)==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Small buffer filled.", ll_exportDelta(&myList, 0, buffer, sizeof(buffer), &size)==NULL);
+
+	CPPUNIT_ASSERT_MESSAGE("Trim failed.", ll_trimChanges(&myList, 4)==true);
+	CPPUNIT_ASSERT_MESSAGE("Trimmed changes exported.", ll_exportDelta(&myList, 3, NULL, 0, NULL)==NULL);
+	CPPUNIT_ASSERT_MESSAGE("Future changes trimmed.", ll_trimChanges(&myList, 11)==false);
+
+	// The replica starts as a copy of the list at sequence number 4 and catches up from there
+	ll_init(&replica);
+	for (int i = 0; i < 4; i++) {
+		ll_add(&replica, &i, sizeof(int));
+	}
+	applied = 4;
+	char* delta = (char*)ll_exportDelta(&myList, 4, NULL, 0, &size);
+	CPPUNIT_ASSERT_MESSAGE("Truncated delta applied.", ll_applyDelta(&replica, delta, size - 3, &applied)==false);
+	CPPUNIT_ASSERT_MESSAGE("Wrong progress reported.", (applied==9) && (ll_size(&replica)==9));
+	free(delta);
+
+	delta = (char*)ll_exportDelta(&myList, applied, NULL, 0, &size);
+	delta[0] = 0;
+	CPPUNIT_ASSERT_MESSAGE("Damaged delta applied.", ll_applyDelta(&replica, delta, size, &applied)==false);
+	delta[0] = 'L';
+	CPPUNIT_ASSERT_MESSAGE("Delta not applied.", ll_applyDelta(&replica, delta, size, &applied)==true);
+	CPPUNIT_ASSERT_MESSAGE("Replica differs.", (applied==10) && sameInts(&myList, &replica));
+
+	// Replaying a delta, or one that skips changes, would leave the replica wrong
+	CPPUNIT_ASSERT_MESSAGE("Delta applied twice.", ll_applyDelta(&replica, delta, size, &applied)==false);
+	CPPUNIT_ASSERT_MESSAGE("Replayed delta changed the replica.", (applied==10) && sameInts(&myList, &replica));
+	free(delta);
+	for (int i = 10; i < 12; i++) {
+		ll_add(&myList, &i, sizeof(int));
+	}
+	delta = (char*)ll_exportDelta(&myList, 11, NULL, 0, &size);
+	CPPUNIT_ASSERT_MESSAGE("Delta with a gap applied.", ll_applyDelta(&replica, delta, size, &applied)==false);
+	CPPUNIT_ASSERT_MESSAGE("Delta with a gap changed the replica.", (applied==10) && (ll_size(&replica)==10));
+	free(delta);
+
+	ll_clear(&replica);
+	ll_setChangeTracking(&myList, false);
+}
@@ -1,80 +1,190 @@
-#ifndef TESTLINKEDLIST_H
-#define TESTLINKEDLIST_H
-
-      
-#include <iostream>
-#include <string>
-
-// Note 1
-#include <TestFixture.h>
-#include <extensions/HelperMacros.h>
-
-extern "C" {
-  #include "linkedlist.h"   
-}
-
-
-
-using namespace std;
-
-class LinkedListTestCase : public CppUnit::TestFixture { // Note 2 
-  CPPUNIT_TEST_SUITE(LinkedListTestCase);
-  CPPUNIT_TEST(testInit);
-
-  CPPUNIT_TEST(testAddNullList);
-  CPPUNIT_TEST(testAddNullObject);
-  CPPUNIT_TEST(testAddZeroSize);
-  CPPUNIT_TEST(testSingleElementAdd);
-  CPPUNIT_TEST(testSingleElementAddOfStructure);
-  CPPUNIT_TEST(testTwoElementAdd);
-  CPPUNIT_TEST(testThreeElementAdd);
-  CPPUNIT_TEST(testSize);
-  CPPUNIT_TEST(testAddIndex);
-  CPPUNIT_TEST(testAddCreatesSeparateMemoryBlock);
-  CPPUNIT_TEST(testClear);
-  CPPUNIT_TEST(testGet);
-  CPPUNIT_TEST(testRemoveNullListFails);
-  CPPUNIT_TEST(testRemoveOutOfRangeElementFails);
-  CPPUNIT_TEST(testRemoveTail);
-  CPPUNIT_TEST(testRemoveMiddle);
-  CPPUNIT_TEST(testRemoveHead);
-  CPPUNIT_TEST(testRemove);
-  CPPUNIT_TEST(testIterator);
-  CPPUNIT_TEST(testIteratorNull);
-  CPPUNIT_TEST(testIteratorFreeDoesNotDamageList);
-  CPPUNIT_TEST_SUITE_END();
-
- private:
-  linkedList myList;
-  void setupBasicList();
-
-public:
-    void setUp();
-    void tearDown();
-
- protected:
-  void testInit();
-  void testAddIndex();
-  void testAddNullList();
-  void testAddNullObject();
-  void testAddZeroSize();
-  void testSingleElementAdd();
-  void testSingleElementAddOfStructure();
-  void testAddCreatesSeparateMemoryBlock();
-  void testTwoElementAdd();
-  void testThreeElementAdd();
-  void testRemoveNullListFails();
-  void testRemoveOutOfRangeElementFails();
-  void testRemoveTail();
-  void testRemoveHead();
-  void testRemoveMiddle();
-  void testRemove();
-  void testGet();
-  void testClear();
-  void testSize();
-  void testIterator();
-  void testIteratorNull();
-  void testIteratorFreeDoesNotDamageList();
-};
-#endif
-          
+#ifndef TESTLINKEDLIST_H
+#define TESTLINKEDLIST_H
+
+      
+#include <iostream>
+#include <string>
+
+// Note 1
+#include <TestFixture.h>
+#include <extensions/HelperMacros.h>
+
+extern "C" {
+  #include "linkedlist.h"   
+  #include "persistentlist.h"
+  #include "workstealingdeque.h"
+  #include "boundedqueue.h"
+  #include "shardedbuilder.h"
+  #include "threadpool.h"
+  #include "typedlist.h"
+  #include "nodepool.h"
+}
+#include "llranges.h"
+
+
+
+using namespace std;
+
+class LinkedListTestCase : public CppUnit::TestFixture { // Note 2 
+  CPPUNIT_TEST_SUITE(LinkedListTestCase);
+  CPPUNIT_TEST(testInit);
+
+  CPPUNIT_TEST(testAddNullList);
+  CPPUNIT_TEST(testAddNullObject);
+  CPPUNIT_TEST(testAddZeroSize);
+  CPPUNIT_TEST(testSingleElementAdd);
+  CPPUNIT_TEST(testSingleElementAddOfStructure);
+  CPPUNIT_TEST(testTwoElementAdd);
+  CPPUNIT_TEST(testThreeElementAdd);
+  CPPUNIT_TEST(testSize);
+  CPPUNIT_TEST(testAddIndex);
+  CPPUNIT_TEST(testAddCreatesSeparateMemoryBlock);
+  CPPUNIT_TEST(testClear);
+  CPPUNIT_TEST(testGet);
+  CPPUNIT_TEST(testRemoveNullListFails);
+  CPPUNIT_TEST(testRemoveOutOfRangeElementFails);
+  CPPUNIT_TEST(testRemoveTail);
+  CPPUNIT_TEST(testRemoveMiddle);
+  CPPUNIT_TEST(testRemoveHead);
+  CPPUNIT_TEST(testRemove);
+  CPPUNIT_TEST(testIterator);
+  CPPUNIT_TEST(testIteratorNull);
+  CPPUNIT_TEST(testIteratorFreeDoesNotDamageList);
+  CPPUNIT_TEST(testConcurrentReadersRetireRemovedNodes);
+  CPPUNIT_TEST(testConcurrentReadersStress);
+  CPPUNIT_TEST(testPersistentSnapshotIsUnchanged);
+  CPPUNIT_TEST(testPersistentSharesUntouchedNodes);
+  CPPUNIT_TEST(testPushAndPeek);
+  CPPUNIT_TEST(testPopHandsOverData);
+  CPPUNIT_TEST(testWorkStealingDequeOrder);
+  CPPUNIT_TEST(testWorkStealingDequeSteal);
+  CPPUNIT_TEST(testTransfer);
+  CPPUNIT_TEST(testBoundedQueueTimeouts);
+  CPPUNIT_TEST(testBoundedQueueProducersConsumers);
+  CPPUNIT_TEST(testShardedBuilderArbitraryMerge);
+  CPPUNIT_TEST(testShardedBuilderSequenceMerge);
+  CPPUNIT_TEST(testShardedBuilderRejectsSortedList);
+  CPPUNIT_TEST(testAddOwned);
+  CPPUNIT_TEST(testAddBorrowed);
+  CPPUNIT_TEST(testTakeAndDetach);
+  CPPUNIT_TEST(testThreadPoolRunsEveryTask);
+  CPPUNIT_TEST(testThreadPoolLimitsWorkers);
+  CPPUNIT_TEST(testThreadPoolNestedRuns);
+  CPPUNIT_TEST(testParallelForEach);
+  CPPUNIT_TEST(testParallelReduce);
+  CPPUNIT_TEST(testFindEq);
+  CPPUNIT_TEST(testCountAndFindFirstGreater);
+  CPPUNIT_TEST(testToArray);
+  CPPUNIT_TEST(testFromArray);
+  CPPUNIT_TEST(testSmallListNodes);
+  CPPUNIT_TEST(testTypedList);
+  CPPUNIT_TEST(testSortedInsertAndLowerBound);
+  CPPUNIT_TEST(testSortedRemove);
+  CPPUNIT_TEST(testReverseIterator);
+  CPPUNIT_TEST(testIteratorAtAndAdvance);
+  CPPUNIT_TEST(testNodePoolReuse);
+  CPPUNIT_TEST(testNodePoolAcrossThreads);
+  CPPUNIT_TEST(testInterningSharesPayloads);
+  CPPUNIT_TEST(testInterningCopyOnWrite);
+  CPPUNIT_TEST(testInterningImportsAndTransfers);
+  CPPUNIT_TEST(testDeferredReclaim);
+  CPPUNIT_TEST(testBackgroundReclaimer);
+  CPPUNIT_TEST(testBatchMatchesSequentialOperations);
+  CPPUNIT_TEST(testBatchEmptyAndCancel);
+  CPPUNIT_TEST(testRangePipeline);
+  CPPUNIT_TEST(testRangeStopsEarly);
+  CPPUNIT_TEST(testMemoryUsageFollowsOperations);
+  CPPUNIT_TEST(testMemoryUsageOfModes);
+  CPPUNIT_TEST(testColdCompressionRoundTrip);
+  CPPUNIT_TEST(testColdCompressionModes);
+  CPPUNIT_TEST(testColdCompressionConcurrentReads);
+  CPPUNIT_TEST(testColdCompressionSkipsReadElements);
+  CPPUNIT_TEST(testChangeDeltaReplicates);
+  CPPUNIT_TEST(testChangeDeltaLimits);
+  CPPUNIT_TEST_SUITE_END();
+
+ private:
+  linkedList myList;
+  void setupBasicList();
+
+public:
+    void setUp();
+    void tearDown();
+
+ protected:
+  void testInit();
+  void testAddIndex();
+  void testAddNullList();
+  void testAddNullObject();
+  void testAddZeroSize();
+  void testSingleElementAdd();
+  void testSingleElementAddOfStructure();
+  void testAddCreatesSeparateMemoryBlock();
+  void testTwoElementAdd();
+  void testThreeElementAdd();
+  void testRemoveNullListFails();
+  void testRemoveOutOfRangeElementFails();
+  void testRemoveTail();
+  void testRemoveHead();
+  void testRemoveMiddle();
+  void testRemove();
+  void testGet();
+  void testClear();
+  void testSize();
+  void testIterator();
+  void testIteratorNull();
+  void testIteratorFreeDoesNotDamageList();
+  void testConcurrentReadersRetireRemovedNodes();
+  void testConcurrentReadersStress();
+  void testPersistentSnapshotIsUnchanged();
+  void testPersistentSharesUntouchedNodes();
+  void testPushAndPeek();
+  void testPopHandsOverData();
+  void testWorkStealingDequeOrder();
+  void testWorkStealingDequeSteal();
+  void testTransfer();
+  void testBoundedQueueTimeouts();
+  void testBoundedQueueProducersConsumers();
+  void testShardedBuilderArbitraryMerge();
+  void testShardedBuilderSequenceMerge();
+  void testShardedBuilderRejectsSortedList();
+  void testAddOwned();
+  void testAddBorrowed();
+  void testTakeAndDetach();
+  void testThreadPoolRunsEveryTask();
+  void testThreadPoolLimitsWorkers();
+  void testThreadPoolNestedRuns();
+  void testParallelForEach();
+  void testParallelReduce();
+  void testFindEq();
+  void testCountAndFindFirstGreater();
+  void testToArray();
+  void testFromArray();
+  void testSmallListNodes();
+  void testTypedList();
+  void testSortedInsertAndLowerBound();
+  void testSortedRemove();
+  void testReverseIterator();
+  void testIteratorAtAndAdvance();
+  void testNodePoolReuse();
+  void testNodePoolAcrossThreads();
+  void testInterningSharesPayloads();
+  void testInterningCopyOnWrite();
+  void testInterningImportsAndTransfers();
+  void testDeferredReclaim();
+  void testBackgroundReclaimer();
+  void testBatchMatchesSequentialOperations();
+  void testBatchEmptyAndCancel();
+  void testRangePipeline();
+  void testRangeStopsEarly();
+  void testMemoryUsageFollowsOperations();
+  void testMemoryUsageOfModes();
+  void testColdCompressionRoundTrip();
+  void testColdCompressionModes();
+  void testColdCompressionConcurrentReads();
+  void testColdCompressionSkipsReadElements();
+  void testChangeDeltaReplicates();
+  void testChangeDeltaLimits();
+};
+#endif
+          
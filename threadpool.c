@@ -0,0 +1,364 @@
+/**
+ * This file contains the implementation of the thread pool functions using the structures
+ * defined in the header file. A run hands the pool helper entries that claim its tasks one at
+ * a time, and the calling thread claims tasks too. Workers only push entries onto their own
+ * deque and threads outside the pool queue them in a list guarded by the pool lock, so every
+ * deque keeps a single owner while several runs share the pool.
+ * @file threadpool.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "threadpool.h"
+
+#include <sched.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/**
+ * This structure holds the state of one worker. Workers are kept on separate cache lines.
+ */
+struct threadPoolWorker {
+	struct workStealingDeque deque; // The helper entries queued by this worker
+	struct threadPool* pool; // The pool the worker belongs to
+	uint32_t index; // The position of the worker in the pool
+	pthread_t thread; // The thread running the worker
+} __attribute__((aligned(64)));
+
+/**
+ * This structure holds the state of one run. It lives on the stack of the thread that started
+ * the run, which does not return before every helper entry of the run is done with it.
+ */
+struct threadPoolRun {
+	struct threadPoolTask* tasks; // The tasks of the run
+	uint32_t count; // The number of tasks
+	uint32_t next; // The index of the next task to claim
+	uint32_t helpers; // The number of helper entries that are queued or running
+	uint32_t unclaimed; // The number of helper entries still waiting in the run list of the pool
+	struct threadPoolRun* nextRun; // The next run in the run list of the pool
+};
+
+static pthread_once_t sharedPoolOnce = PTHREAD_ONCE_INIT;
+static struct threadPool sharedPool; // The pool returned by tp_shared
+static __thread struct threadPoolWorker* currentWorker = NULL; // The worker running on this thread, NULL outside pools
+
+/**
+ * This function claims the tasks of a run one at a time and runs them until none are left.
+ * @param run This is a pointer to the run.
+ */
+static void tp_claimTasks(struct threadPoolRun* run){
+	uint32_t index = __atomic_fetch_add(&run->next, 1, __ATOMIC_RELAXED);
+
+	while(index < run->count){
+		run->tasks[index].function(run->tasks[index].argument);
+		index = __atomic_fetch_add(&run->next, 1, __ATOMIC_RELAXED);
+	}
+}
+
+/**
+ * This function runs one helper entry of a run and wakes the threads waiting for runs when it
+ * was the last one. The run may be gone as soon as the count drops, so it is not touched after.
+ * @param pool This is a pointer to the pool.
+ * @param run This is a pointer to the run.
+ */
+static void tp_runHelper(struct threadPool* pool, struct threadPoolRun* run){
+	tp_claimTasks(run);
+
+	if(__atomic_sub_fetch(&run->helpers, 1, __ATOMIC_ACQ_REL) == 0){
+		pthread_mutex_lock(&pool->lock);
+		pthread_cond_broadcast(&pool->done);
+		pthread_mutex_unlock(&pool->lock);
+	}
+}
+
+/**
+ * This function tells sleeping workers that new helper entries were queued. The pool lock
+ * must not be held.
+ * @param pool This is a pointer to the pool.
+ */
+static void tp_wakeWorkers(struct threadPool* pool){
+	pthread_mutex_lock(&pool->lock);
+	__atomic_store_n(&pool->generation, pool->generation + 1, __ATOMIC_RELEASE);
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ * This function finds a helper entry for a worker, first in its own deque, then in the run
+ * list of the pool and then in the deques of the other workers.
+ * @param worker This is a pointer to the worker looking for work.
+ * @return This returns a pointer to the run of the entry, or NULL if none was found.
+ */
+static struct threadPoolRun* tp_findHelper(struct threadPoolWorker* worker){
+	struct threadPool* pool = worker->pool;
+	struct threadPoolRun* run = (struct threadPoolRun*)wsd_pop(&worker->deque);
+
+	// Runs started outside the pool cannot push onto a deque, so they wait in the run list
+	if((run == NULL) && (__atomic_load_n(&pool->runs, __ATOMIC_ACQUIRE) != NULL)){
+		pthread_mutex_lock(&pool->lock);
+		run = pool->runs;
+		if(run != NULL){
+			run->unclaimed = run->unclaimed - 1;
+			if(run->unclaimed == 0){
+				__atomic_store_n(&pool->runs, run->nextRun, __ATOMIC_RELEASE);
+			}
+		}
+		pthread_mutex_unlock(&pool->lock);
+	}
+
+	// Steal from the other workers, starting with the next one to spread the thieves out
+	for(uint32_t i = 1; (i < pool->workerCount) && (run == NULL); i++){
+		struct threadPoolWorker* victim = &pool->workers[(worker->index + i) % pool->workerCount];
+		run = (struct threadPoolRun*)wsd_steal(&victim->deque);
+	}
+
+	return run;
+}
+
+/**
+ * This function checks if any deque of the pool still holds helper entries. A worker that
+ * found nothing while entries are waiting lost a race with another thief.
+ * @param pool This is a pointer to the pool.
+ * @return This returns true if an entry is waiting in one of the deques, false if all are empty.
+ */
+static bool tp_helpersWaiting(struct threadPool* pool){
+	bool waiting = false;
+
+	for(uint32_t i = 0; (i < pool->workerCount) && !waiting; i++){
+		waiting = (wsd_size(&pool->workers[i].deque) != 0);
+	}
+
+	return waiting;
+}
+
+/**
+ * This function is the main loop of a worker thread.
+ * @param argument This is a pointer to the threadPoolWorker of the thread.
+ * @return This always returns NULL.
+ */
+static void* tp_workerMain(void* argument){
+	struct threadPoolWorker* worker = (struct threadPoolWorker*)argument;
+	struct threadPool* pool = worker->pool;
+	bool running = true;
+
+	currentWorker = worker;
+
+	while(running){
+		// Read the generation before looking, so entries queued during the search are not slept through
+		uint64_t seen = __atomic_load_n(&pool->generation, __ATOMIC_ACQUIRE);
+		struct threadPoolRun* run = tp_findHelper(worker);
+
+		if(run != NULL){
+			tp_runHelper(pool, run);
+		}
+		else if(tp_helpersWaiting(pool)){
+			// A steal lost a race with another worker, so try again
+			sched_yield();
+		}
+		else{
+			// Sleep until new entries are queued or the pool is destroyed
+			pthread_mutex_lock(&pool->lock);
+			while(!pool->stopping && (pool->generation == seen)){
+				pthread_cond_wait(&pool->wake, &pool->lock);
+			}
+			running = !pool->stopping;
+			pthread_mutex_unlock(&pool->lock);
+		}
+	}
+
+	currentWorker = NULL;
+
+	return NULL;
+}
+
+/**
+ * This function starts a thread pool.
+ * @param pool This is a pointer to the pool to start.
+ * @param workerCount This is the number of worker threads, must not be 0.
+ * @return This returns true if the pool was started, false if it failed.
+ */
+bool tp_init(struct threadPool* pool, uint32_t workerCount){
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((pool != NULL) && (workerCount != 0)){
+		pool->workers = (struct threadPoolWorker*)aligned_alloc(64, workerCount * sizeof(struct threadPoolWorker));
+		pool->workerCount = workerCount;
+		pool->generation = 0;
+		pool->runs = NULL;
+		pool->stopping = false;
+		pthread_mutex_init(&pool->lock, NULL);
+		pthread_cond_init(&pool->wake, NULL);
+		pthread_cond_init(&pool->done, NULL);
+
+		// Workers steal from every deque, so all of them are set up before the first thread starts
+		for(uint32_t i = 0; i < workerCount; i++){
+			wsd_init(&pool->workers[i].deque, 64);
+			pool->workers[i].pool = pool;
+			pool->workers[i].index = i;
+		}
+		for(uint32_t i = 0; i < workerCount; i++){
+			pthread_create(&pool->workers[i].thread, NULL, tp_workerMain, &pool->workers[i]);
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function stops the worker threads of a pool and frees its resources.
+ * @param pool This is a pointer to the pool to destroy.
+ */
+void tp_destroy(struct threadPool* pool){
+	// Checks if the pool parameter is NULL to avoid a null pointer dereference
+	if((pool != NULL) && (pool->workers != NULL)){
+		pthread_mutex_lock(&pool->lock);
+		pool->stopping = true;
+		pthread_cond_broadcast(&pool->wake);
+		pthread_mutex_unlock(&pool->lock);
+
+		// Workers steal from every deque, so none is freed before the last thread has stopped
+		for(uint32_t i = 0; i < pool->workerCount; i++){
+			pthread_join(pool->workers[i].thread, NULL);
+		}
+		for(uint32_t i = 0; i < pool->workerCount; i++){
+			wsd_destroy(&pool->workers[i].deque);
+		}
+
+		free(pool->workers);
+		pool->workers = NULL;
+		pool->workerCount = 0;
+		pthread_cond_destroy(&pool->done);
+		pthread_cond_destroy(&pool->wake);
+		pthread_mutex_destroy(&pool->lock);
+	}
+}
+
+/**
+ * This function runs a set of tasks on the pool and waits until all of them have finished.
+ * @param pool This is a pointer to the pool to run the tasks on.
+ * @param tasks This is the array of tasks, which must stay valid until the run finishes.
+ * @param count This is the number of tasks.
+ * @return This returns true if the tasks were run, false if it failed.
+ */
+bool tp_run(struct threadPool* pool, struct threadPoolTask* tasks, uint32_t count){
+	return tp_runWorkers(pool, tasks, count, 0);
+}
+
+/**
+ * This function runs a set of tasks on some of the threads of the pool and waits until all of
+ * them have finished.
+ * @param pool This is a pointer to the pool to run the tasks on.
+ * @param tasks This is the array of tasks, which must stay valid until the run finishes.
+ * @param count This is the number of tasks.
+ * @param workers This is the number of threads to run the tasks on, 0 or more than the pool has workers to use as many as it has.
+ * @return This returns true if the tasks were run, false if it failed.
+ */
+bool tp_runWorkers(struct threadPool* pool, struct threadPoolTask* tasks, uint32_t count, uint32_t workers){
+	struct threadPoolWorker* worker = currentWorker;
+	struct threadPoolRun run;
+	bool completed = false;
+
+	// Check the parameters for valid values to avoid null pointer dereferences
+	if((pool != NULL) && (pool->workers != NULL) && ((tasks != NULL) || (count == 0))){
+		uint32_t threads = ((workers == 0) || (workers > pool->workerCount)) ? pool->workerCount : workers;
+
+		// The calling thread is one of the threads, so one helper entry less is queued
+		run.tasks = tasks;
+		run.count = count;
+		run.next = 0;
+		run.helpers = (count < threads) ? ((count == 0) ? 0 : (count - 1)) : (threads - 1);
+		run.unclaimed = 0;
+		run.nextRun = NULL;
+
+		if((worker != NULL) && (worker->pool == pool)){
+			// A task of this pool started the run, so the entries go onto the deque of its worker
+			for(uint32_t i = 0; i < run.helpers; i++){
+				wsd_push(&worker->deque, &run);
+			}
+			if(run.helpers != 0){
+				tp_wakeWorkers(pool);
+			}
+
+			tp_claimTasks(&run);
+
+			// Entries nobody stole are still on top of the deque, anything below was queued earlier
+			while(__atomic_load_n(&run.helpers, __ATOMIC_ACQUIRE) != 0){
+				struct threadPoolRun* queued = (struct threadPoolRun*)wsd_pop(&worker->deque);
+
+				if(queued != NULL){
+					tp_runHelper(pool, queued);
+				}
+				else{
+					pthread_mutex_lock(&pool->lock);
+					while(__atomic_load_n(&run.helpers, __ATOMIC_ACQUIRE) != 0){
+						pthread_cond_wait(&pool->done, &pool->lock);
+					}
+					pthread_mutex_unlock(&pool->lock);
+				}
+			}
+		}
+		else{
+			if(run.helpers != 0){
+				struct threadPoolRun** tail = &pool->runs;
+
+				pthread_mutex_lock(&pool->lock);
+				while(*tail != NULL){
+					tail = &(*tail)->nextRun;
+				}
+				run.unclaimed = run.helpers;
+				__atomic_store_n(tail, &run, __ATOMIC_RELEASE);
+				__atomic_store_n(&pool->generation, pool->generation + 1, __ATOMIC_RELEASE);
+				pthread_cond_broadcast(&pool->wake);
+				pthread_mutex_unlock(&pool->lock);
+			}
+
+			tp_claimTasks(&run);
+
+			pthread_mutex_lock(&pool->lock);
+
+			// Every task is claimed by now, so entries no worker took are withdrawn instead of waited for
+			if(run.unclaimed != 0){
+				struct threadPoolRun** link = &pool->runs;
+
+				while(*link != &run){
+					link = &(*link)->nextRun;
+				}
+				__atomic_store_n(link, run.nextRun, __ATOMIC_RELEASE);
+				__atomic_sub_fetch(&run.helpers, run.unclaimed, __ATOMIC_ACQ_REL);
+				run.unclaimed = 0;
+			}
+
+			while(__atomic_load_n(&run.helpers, __ATOMIC_ACQUIRE) != 0){
+				pthread_cond_wait(&pool->done, &pool->lock);
+			}
+
+			pthread_mutex_unlock(&pool->lock);
+		}
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function starts the shared pool.
+ */
+static void tp_startShared(void){
+	long processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+	tp_init(&sharedPool, (processors > 0) ? (uint32_t)processors : 1);
+}
+
+/**
+ * This function returns a pool shared by the whole library.
+ * @return This returns a pointer to the shared pool.
+ */
+struct threadPool* tp_shared(void){
+	pthread_once(&sharedPoolOnce, tp_startShared);
+
+	return &sharedPool;
+}
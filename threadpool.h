@@ -0,0 +1,91 @@
+/**
+ * This file contains the interface for the thread pool. The pool keeps its worker threads
+ * between runs, gives every worker its own work-stealing deque and lets idle workers steal
+ * tasks from busy ones.
+ * @file threadpool.h
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include "workstealingdeque.h"
+
+#include <pthread.h>
+
+/**
+ * This structure describes one task run by the pool.
+ */
+struct threadPoolTask
+{
+  void (*function)(void*); // The function to run
+  void* argument; // The argument passed to the function
+};
+
+struct threadPoolWorker;
+struct threadPoolRun;
+
+/**
+ * This structure is a pool of worker threads.
+ */
+struct threadPool
+{
+  struct threadPoolWorker* workers; // The workers, one per thread
+  uint32_t workerCount; // The number of workers
+  uint64_t generation; // Increased whenever work is queued so sleeping workers look again
+  struct threadPoolRun* runs; // The runs started outside the pool that still have helper entries to hand out
+  bool stopping; // True once the pool is being destroyed
+  pthread_mutex_t lock; // Protects the generation, run list and stopping flag
+  pthread_cond_t wake; // Signalled when work is queued or the pool is destroyed
+  pthread_cond_t done; // Signalled when the last helper entry of a run finishes
+};
+
+/**
+ * This function starts a thread pool.
+ * @param pool This is a pointer to the pool to start.
+ * @param workerCount This is the number of worker threads, must not be 0.
+ * @return This returns true if the pool was started, false if it failed.
+ */
+bool tp_init(struct threadPool* pool, uint32_t workerCount);
+
+/**
+ * This function stops the worker threads of a pool and frees its resources.
+ * @param pool This is a pointer to the pool to destroy.
+ */
+void tp_destroy(struct threadPool* pool);
+
+/**
+ * This function runs a set of tasks on the pool and waits until all of them have finished.
+ * The calling thread and the workers claim the tasks one at a time, and workers that find
+ * nothing left go back to sleep. Runs started from several threads share the workers at the
+ * same time. A task may start a run of its own on the same pool: the worker running it queues
+ * the new run on its own deque, where idle workers steal from, and runs what is left itself
+ * instead of waiting, so nested runs cannot deadlock.
+ * @param pool This is a pointer to the pool to run the tasks on.
+ * @param tasks This is the array of tasks, which must stay valid until the run finishes.
+ * @param count This is the number of tasks.
+ * @return This returns true if the tasks were run, false if it failed.
+ */
+bool tp_run(struct threadPool* pool, struct threadPoolTask* tasks, uint32_t count);
+
+/**
+ * This function runs a set of tasks on some of the threads of the pool and waits until all of
+ * them have finished. No more than the given number of threads work on the run at once, the
+ * calling thread included, and the other workers stay free for other runs.
+ * @param pool This is a pointer to the pool to run the tasks on.
+ * @param tasks This is the array of tasks, which must stay valid until the run finishes.
+ * @param count This is the number of tasks.
+ * @param workers This is the number of threads to run the tasks on, 0 or more than the pool has workers to use as many as it has.
+ * @return This returns true if the tasks were run, false if it failed.
+ */
+bool tp_runWorkers(struct threadPool* pool, struct threadPoolTask* tasks, uint32_t count, uint32_t workers);
+
+/**
+ * This function returns a pool shared by the whole library, started on first use with one
+ * worker per online processor. It is never destroyed.
+ * @return This returns a pointer to the shared pool.
+ */
+struct threadPool* tp_shared(void);
+
+#endif /*THREADPOOL_H*/
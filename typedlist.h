@@ -0,0 +1,174 @@
+/**
+ * This file contains a macro that generates a linked list specialized for one element type.
+ * The elements are stored by value inside the nodes with no size field, so every copy has a
+ * size known at compile time and every function can be inlined into the caller.
+ * @file typedlist.h
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#ifndef TYPEDLIST_H
+#define TYPEDLIST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * This macro defines a list of elements of type T. For LL_DEFINE_TYPED(name, T) it defines
+ * struct name_list and struct name_iterator along with these functions, which behave like
+ * their ll_ counterparts:
+ *   void name_init(struct name_list* list)
+ *   bool name_add(struct name_list* list, T value)
+ *   bool name_addIndex(struct name_list* list, T value, uint32_t index)
+ *   bool name_remove(struct name_list* list, uint32_t index)
+ *   T* name_get(struct name_list* list, uint32_t index)
+ *   void name_clear(struct name_list* list)
+ *   uint32_t name_size(struct name_list* list)
+ *   struct name_iterator name_iter(struct name_list* list)
+ *   bool name_hasNext(struct name_iterator* iter)
+ *   T* name_next(struct name_iterator* iter)
+ * The iterator is returned by value, so unlike ll_getIterator nothing has to be freed.
+ * @param name This is the prefix of the generated types and functions.
+ * @param T This is the element type, which must be copyable by assignment.
+ */
+#define LL_DEFINE_TYPED(name, T) \
+	struct name##_node { \
+		T value; /* The element stored in the node */ \
+		struct name##_node* nextNode; /* A pointer to the next node in the list */ \
+		struct name##_node* prevNode; /* A pointer to the previous node in the list */ \
+	}; \
+	\
+	struct name##_list { \
+		struct name##_node* head; /* A pointer to the first node in the list */ \
+		struct name##_node* tail; /* A pointer to the last node in the list */ \
+		uint32_t size; /* The number of nodes in the list */ \
+	}; \
+	\
+	struct name##_iterator { \
+		struct name##_node* current; /* A pointer to the node the iterator is currently at */ \
+	}; \
+	\
+	static inline void name##_init(struct name##_list* list){ \
+		if(list != NULL){ \
+			list->head = NULL; \
+			list->tail = NULL; \
+			list->size = 0; \
+		} \
+	} \
+	\
+	static inline struct name##_node* name##_nodeAt(struct name##_list* list, uint32_t index){ \
+		struct name##_node* node; \
+		/* Walk from whichever end is closer to the index */ \
+		if(index < (list->size / 2)){ \
+			node = list->head; \
+			for(uint32_t i = 0; i < index; i++){ \
+				node = node->nextNode; \
+			} \
+		} \
+		else{ \
+			node = list->tail; \
+			for(uint32_t i = list->size - 1; i > index; i--){ \
+				node = node->prevNode; \
+			} \
+		} \
+		return node; \
+	} \
+	\
+	static inline bool name##_addIndex(struct name##_list* list, T value, uint32_t index){ \
+		bool completed = false; \
+		if((list != NULL) && (index <= list->size)){ \
+			struct name##_node* node = (struct name##_node*)malloc(sizeof(struct name##_node)); \
+			struct name##_node* before = (index < list->size) ? name##_nodeAt(list, index) : NULL; \
+			node->value = value; \
+			node->nextNode = before; \
+			node->prevNode = (before != NULL) ? before->prevNode : list->tail; \
+			if(node->prevNode != NULL){ \
+				node->prevNode->nextNode = node; \
+			} \
+			else{ \
+				list->head = node; \
+			} \
+			if(before != NULL){ \
+				before->prevNode = node; \
+			} \
+			else{ \
+				list->tail = node; \
+			} \
+			list->size = list->size + 1; \
+			completed = true; \
+		} \
+		return completed; \
+	} \
+	\
+	static inline bool name##_add(struct name##_list* list, T value){ \
+		return name##_addIndex(list, value, (list != NULL) ? list->size : 0); \
+	} \
+	\
+	static inline bool name##_remove(struct name##_list* list, uint32_t index){ \
+		bool completed = false; \
+		if((list != NULL) && (index < list->size)){ \
+			struct name##_node* node = name##_nodeAt(list, index); \
+			if(node->nextNode != NULL){ \
+				node->nextNode->prevNode = node->prevNode; \
+			} \
+			else{ \
+				list->tail = node->prevNode; \
+			} \
+			if(node->prevNode != NULL){ \
+				node->prevNode->nextNode = node->nextNode; \
+			} \
+			else{ \
+				list->head = node->nextNode; \
+			} \
+			list->size = list->size - 1; \
+			free(node); \
+			completed = true; \
+		} \
+		return completed; \
+	} \
+	\
+	static inline T* name##_get(struct name##_list* list, uint32_t index){ \
+		T* value = NULL; \
+		if((list != NULL) && (index < list->size)){ \
+			value = &name##_nodeAt(list, index)->value; \
+		} \
+		return value; \
+	} \
+	\
+	static inline void name##_clear(struct name##_list* list){ \
+		if(list != NULL){ \
+			struct name##_node* node = list->head; \
+			while(node != NULL){ \
+				struct name##_node* temp = node; \
+				node = node->nextNode; \
+				free(temp); \
+			} \
+			name##_init(list); \
+		} \
+	} \
+	\
+	static inline uint32_t name##_size(struct name##_list* list){ \
+		return (list != NULL) ? list->size : 0; \
+	} \
+	\
+	static inline struct name##_iterator name##_iter(struct name##_list* list){ \
+		struct name##_iterator iter; \
+		iter.current = (list != NULL) ? list->head : NULL; \
+		return iter; \
+	} \
+	\
+	static inline bool name##_hasNext(struct name##_iterator* iter){ \
+		return (iter != NULL) && (iter->current != NULL); \
+	} \
+	\
+	static inline T* name##_next(struct name##_iterator* iter){ \
+		T* value = NULL; \
+		if((iter != NULL) && (iter->current != NULL)){ \
+			value = &iter->current->value; \
+			iter->current = iter->current->nextNode; \
+		} \
+		return value; \
+	}
+
+#endif /*TYPEDLIST_H*/
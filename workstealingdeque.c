@@ -0,0 +1,257 @@
+/**
+ * This file contains the implementation of the work-stealing deque functions using the
+ * structures defined in the header file. The memory ordering follows "Correct and Efficient
+ * Work-Stealing for Weak Memory Models" by Le, Pop, Cohen and Zappa Nardelli.
+ * @file workstealingdeque.c
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#include "workstealingdeque.h"
+
+#include <stdlib.h>
+
+/**
+ * This structure is the circular array behind a work-stealing deque.
+ */
+struct workStealingArray {
+	int64_t capacity; // The number of slots, always a power of two
+	struct workStealingArray* previous; // The array this one replaced, used to free retired arrays
+	void* items[]; // The slots holding the items
+};
+
+/**
+ * This function allocates a circular array.
+ * @param capacity This is the number of slots, must be a power of two.
+ * @return This returns a pointer to the new array.
+ */
+static struct workStealingArray* wsd_newArray(int64_t capacity){
+	struct workStealingArray* array = (struct workStealingArray*)malloc(sizeof(struct workStealingArray) + (capacity * sizeof(void*)));
+
+	array->capacity = capacity;
+	array->previous = NULL;
+
+	return array;
+}
+
+/**
+ * This function reads an item from a circular array.
+ * @param array This is a pointer to the array.
+ * @param index This is the deque index of the item.
+ * @return This returns the item.
+ */
+static void* wsd_load(struct workStealingArray* array, int64_t index){
+	return __atomic_load_n(&array->items[index & (array->capacity - 1)], __ATOMIC_RELAXED);
+}
+
+/**
+ * This function writes an item into a circular array.
+ * @param array This is a pointer to the array.
+ * @param index This is the deque index of the item.
+ * @param item This is the item to store.
+ */
+static void wsd_store(struct workStealingArray* array, int64_t index, void* item){
+	__atomic_store_n(&array->items[index & (array->capacity - 1)], item, __ATOMIC_RELAXED);
+}
+
+/**
+ * This function replaces the array of a deque with one twice its size. Thieves may still be
+ * reading the old array, so it is kept on the retired chain until the deque is destroyed.
+ * @param deque This is a pointer to the deque to grow.
+ * @param top This is the current top index.
+ * @param bottom This is the current bottom index.
+ * @return This returns a pointer to the new array.
+ */
+static struct workStealingArray* wsd_grow(struct workStealingDeque* deque, int64_t top, int64_t bottom){
+	struct workStealingArray* old = deque->array;
+	struct workStealingArray* array = wsd_newArray(old->capacity * 2);
+
+	// Copy the live items to the same indexes in the bigger array
+	for(int64_t i = top; i < bottom; i++){
+		wsd_store(array, i, wsd_load(old, i));
+	}
+
+	old->previous = deque->retired;
+	deque->retired = old;
+	__atomic_store_n(&deque->array, array, __ATOMIC_RELEASE);
+
+	return array;
+}
+
+/**
+ * This function initializes a work-stealing deque.
+ * @param deque This is a pointer to the deque to initialize.
+ * @param capacity This is the number of items the deque holds before it has to grow.
+ * @return This returns true if the deque was initialized, false if it failed.
+ */
+bool wsd_init(struct workStealingDeque* deque, uint32_t capacity){
+	bool completed = false;
+
+	// Checks if the deque parameter is NULL to avoid a null pointer dereference
+	if(deque != NULL){
+		int64_t slots = 2;
+
+		// Round the capacity up to a power of two so indexes can be masked
+		while(slots < capacity){
+			slots = slots * 2;
+		}
+
+		deque->top = 0;
+		deque->bottom = 0;
+		deque->array = wsd_newArray(slots);
+		deque->retired = NULL;
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function frees the memory held by a work-stealing deque.
+ * @param deque This is a pointer to the deque to destroy.
+ */
+void wsd_destroy(struct workStealingDeque* deque){
+	// Checks if the deque parameter is NULL to avoid a null pointer dereference
+	if(deque != NULL){
+		struct workStealingArray* array = deque->retired;
+
+		while(array != NULL){
+			struct workStealingArray* temp = array;
+			array = array->previous;
+			free(temp);
+		}
+
+		free(deque->array);
+		deque->array = NULL;
+		deque->retired = NULL;
+		deque->top = 0;
+		deque->bottom = 0;
+	}
+}
+
+/**
+ * This function pushes an item onto the bottom of the deque.
+ * @param deque This is a pointer to the deque to push to.
+ * @param item This is the item to push, must not be NULL.
+ * @return This returns true if the push was successful, false if it failed.
+ */
+bool wsd_push(struct workStealingDeque* deque, void* item){
+	bool completed = false;
+
+	// Check the parameters for valid values, NULL is reserved to report an empty deque
+	if((deque != NULL) && (item != NULL)){
+		int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED);
+		int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+		struct workStealingArray* array = __atomic_load_n(&deque->array, __ATOMIC_RELAXED);
+
+		// Grow the array if it is full
+		if((bottom - top) > (array->capacity - 1)){
+			array = wsd_grow(deque, top, bottom);
+		}
+
+		wsd_store(array, bottom, item);
+
+		// Make the item visible before thieves can see the new bottom
+		__atomic_thread_fence(__ATOMIC_RELEASE);
+		__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+		completed = true;
+	}
+
+	return completed;
+}
+
+/**
+ * This function pops the most recently pushed item from the bottom of the deque.
+ * @param deque This is a pointer to the deque to pop from.
+ * @return This returns the item, or NULL if the deque is empty.
+ */
+void* wsd_pop(struct workStealingDeque* deque){
+	void* item = NULL;
+
+	// Checks if the deque parameter is NULL to avoid a null pointer dereference
+	if(deque != NULL){
+		int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED) - 1;
+		struct workStealingArray* array = __atomic_load_n(&deque->array, __ATOMIC_RELAXED);
+		int64_t top;
+
+		// Claim the bottom item before looking at what thieves have taken
+		__atomic_store_n(&deque->bottom, bottom, __ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		top = __atomic_load_n(&deque->top, __ATOMIC_RELAXED);
+
+		if(top <= bottom){
+			item = wsd_load(array, bottom);
+
+			// The last item is raced for with the thieves
+			if(top == bottom){
+				if(!__atomic_compare_exchange_n(&deque->top, &top, top + 1, false,
+						__ATOMIC_SEQ_CST, __ATOMIC_RELAXED)){
+					item = NULL;
+				}
+				__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+			}
+		}
+		else{
+			// The deque was empty, undo the claim
+			__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+		}
+	}
+
+	return item;
+}
+
+/**
+ * This function steals the oldest item from the top of the deque.
+ * @param deque This is a pointer to the deque to steal from.
+ * @return This returns the item, or NULL if the deque is empty or another thread took the item
+ *         first.
+ */
+void* wsd_steal(struct workStealingDeque* deque){
+	void* item = NULL;
+
+	// Checks if the deque parameter is NULL to avoid a null pointer dereference
+	if(deque != NULL){
+		int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+		int64_t bottom;
+
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		bottom = __atomic_load_n(&deque->bottom, __ATOMIC_ACQUIRE);
+
+		if(top < bottom){
+			struct workStealingArray* array = __atomic_load_n(&deque->array, __ATOMIC_ACQUIRE);
+
+			item = wsd_load(array, top);
+
+			// Another thief or the owner may have taken the item in the meantime
+			if(!__atomic_compare_exchange_n(&deque->top, &top, top + 1, false,
+					__ATOMIC_SEQ_CST, __ATOMIC_RELAXED)){
+				item = NULL;
+			}
+		}
+	}
+
+	return item;
+}
+
+/**
+ * This function returns the number of items in the deque.
+ * @param deque This is a pointer to the deque.
+ * @return This returns the number of items in the deque.
+ */
+uint32_t wsd_size(struct workStealingDeque* deque){
+	uint32_t num = 0;
+
+	// Checks if the deque parameter is NULL to avoid a null pointer dereference
+	if(deque != NULL){
+		int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_ACQUIRE);
+		int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+
+		if(bottom > top){
+			num = (uint32_t)(bottom - top);
+		}
+	}
+
+	return num;
+}
@@ -0,0 +1,78 @@
+/**
+ * This file contains the interface for the work-stealing deque. The deque belongs to one owner
+ * thread that pushes and pops items at the bottom, while any number of thief threads steal
+ * items from the top. It follows the Chase-Lev algorithm and never blocks.
+ * @file workstealingdeque.h
+ * @author Max Kallenberger
+ * @date October 18, 2026
+ */
+
+#ifndef WORKSTEALINGDEQUE_H
+#define WORKSTEALINGDEQUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct workStealingArray;
+
+/**
+ * This structure is a work-stealing deque of pointers. The top and bottom indexes are kept on
+ * separate cache lines because thieves write the top while the owner writes the bottom.
+ */
+struct workStealingDeque
+{
+  int64_t top __attribute__((aligned(64))); // The index thieves steal from
+  int64_t bottom __attribute__((aligned(64))); // The index the owner pushes to and pops from
+  struct workStealingArray* array; // The circular array holding the items
+  struct workStealingArray* retired; // Arrays replaced by growing, kept until the deque is destroyed
+};
+
+/**
+ * This function initializes a work-stealing deque.
+ * @param deque This is a pointer to the deque to initialize.
+ * @param capacity This is the number of items the deque holds before it has to grow, rounded
+ *                 up to a power of two.
+ * @return This returns true if the deque was initialized, false if it failed.
+ */
+bool wsd_init(struct workStealingDeque* deque, uint32_t capacity);
+
+/**
+ * This function frees the memory held by a work-stealing deque. No thread may use the deque
+ * while or after it is destroyed.
+ * @param deque This is a pointer to the deque to destroy.
+ */
+void wsd_destroy(struct workStealingDeque* deque);
+
+/**
+ * This function pushes an item onto the bottom of the deque. It may only be called by the owner.
+ * @param deque This is a pointer to the deque to push to.
+ * @param item This is the item to push, must not be NULL.
+ * @return This returns true if the push was successful, false if it failed.
+ */
+bool wsd_push(struct workStealingDeque* deque, void* item);
+
+/**
+ * This function pops the most recently pushed item from the bottom of the deque. It may only be
+ * called by the owner.
+ * @param deque This is a pointer to the deque to pop from.
+ * @return This returns the item, or NULL if the deque is empty.
+ */
+void* wsd_pop(struct workStealingDeque* deque);
+
+/**
+ * This function steals the oldest item from the top of the deque. It may be called by any thread.
+ * @param deque This is a pointer to the deque to steal from.
+ * @return This returns the item, or NULL if the deque is empty or another thread took the item
+ *         first, in which case the caller may try again.
+ */
+void* wsd_steal(struct workStealingDeque* deque);
+
+/**
+ * This function returns the number of items in the deque. The result is only a snapshot when
+ * other threads are using the deque.
+ * @param deque This is a pointer to the deque.
+ * @return This returns the number of items in the deque.
+ */
+uint32_t wsd_size(struct workStealingDeque* deque);
+
+#endif /*WORKSTEALINGDEQUE_H*/